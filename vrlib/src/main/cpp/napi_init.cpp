@@ -6,6 +6,7 @@
 #include <unordered_map>
 #include <string>
 #include <mutex>
+#include <vector>
 
 #undef LOG_DOMAIN
 #undef LOG_TAG
@@ -227,6 +228,32 @@ static napi_value RunCmd(napi_env env, napi_callback_info info) {
     return ret;
 }
 
+static napi_value Suspend(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1];
+    napi_value jsThis;
+    napi_get_cb_info(env, info, &argc, args, &jsThis, nullptr);
+
+    MD360PlayerWrapper* wrapper;
+    napi_unwrap(env, jsThis, (void**)&wrapper);
+
+    if (wrapper == nullptr || wrapper->impl == nullptr) {
+        return nullptr;
+    }
+
+    bool releaseGpuMemory = false;
+    if (argc >= 1) {
+        napi_get_value_bool(env, args[0], &releaseGpuMemory);
+    }
+
+    MD_LOGI("NAPI Suspend called: releaseGpuMemory=%d", releaseGpuMemory);
+    int result = wrapper->impl->Suspend(releaseGpuMemory);
+
+    napi_value ret;
+    napi_create_int32(env, result, &ret);
+    return ret;
+}
+
 static napi_value UpdateMVPMatrix(napi_env env, napi_callback_info info) {
     size_t argc = 1;
     napi_value args[1];
@@ -308,6 +335,32 @@ static napi_value GetVideoSurfaceId(napi_env env, napi_callback_info info) {
     return result;
 }
 
+static napi_value ShareVideoWith(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1];
+    napi_value jsThis;
+    napi_get_cb_info(env, info, &argc, args, &jsThis, nullptr);
+
+    MD360PlayerWrapper* wrapper;
+    napi_unwrap(env, jsThis, (void**)&wrapper);
+
+    MD360PlayerWrapper* other = nullptr;
+    if (argc >= 1) {
+        napi_unwrap(env, args[0], (void**)&other);
+    }
+
+    int result = -1;
+    if (wrapper == nullptr || wrapper->impl == nullptr || other == nullptr || other->impl == nullptr) {
+        MD_LOGE("ShareVideoWith: wrapper or other player is null");
+    } else {
+        result = wrapper->impl->ShareVideoFrom(other->impl);
+    }
+
+    napi_value ret;
+    napi_create_int32(env, result, &ret);
+    return ret;
+}
+
 static napi_value SetClearColor(napi_env env, napi_callback_info info) {
     size_t argc = 4;
     napi_value args[4];
@@ -504,6 +557,524 @@ static napi_value SetProjectionMode(napi_env env, napi_callback_info info) {
     return nullptr;
 }
 
+// flush 的 Promise：GL线程完成回调后通过线程安全函数回到JS线程 resolve
+struct FlushContext {
+    napi_deferred deferred = nullptr;
+    napi_threadsafe_function tsfn = nullptr;
+};
+
+static void ResolveFlushPromise(napi_env env, napi_value jsCallback, void* context, void* data) {
+    FlushContext* flushContext = reinterpret_cast<FlushContext*>(context);
+    if (env != nullptr) {
+        napi_value result;
+        napi_create_int32(env, static_cast<int32_t>(reinterpret_cast<intptr_t>(data)), &result);
+        napi_resolve_deferred(env, flushContext->deferred, result);
+    }
+    napi_release_threadsafe_function(flushContext->tsfn, napi_tsfn_release);
+}
+
+static void FinalizeFlushContext(napi_env env, void* finalizeData, void* finalizeHint) {
+    delete reinterpret_cast<FlushContext*>(finalizeData);
+}
+
+static napi_value Flush(napi_env env, napi_callback_info info) {
+    napi_value jsThis;
+    napi_get_cb_info(env, info, nullptr, nullptr, &jsThis, nullptr);
+
+    MD360PlayerWrapper* wrapper;
+    napi_unwrap(env, jsThis, (void**)&wrapper);
+
+    napi_value promise;
+    FlushContext* context = new FlushContext();
+    napi_create_promise(env, &context->deferred, &promise);
+
+    if (wrapper == nullptr || wrapper->impl == nullptr) {
+        MD_LOGE("Flush: wrapper or impl is null");
+        napi_value result;
+        napi_create_int32(env, -1, &result);
+        napi_resolve_deferred(env, context->deferred, result);
+        delete context;
+        return promise;
+    }
+
+    napi_value resourceName;
+    napi_create_string_utf8(env, "MD360PlayerFlush", NAPI_AUTO_LENGTH, &resourceName);
+    napi_create_threadsafe_function(env, nullptr, nullptr, resourceName, 0, 1, context, FinalizeFlushContext,
+                                    context, ResolveFlushPromise, &context->tsfn);
+    napi_threadsafe_function tsfn = context->tsfn;
+    wrapper->impl->Flush([tsfn](int result) {
+        napi_call_threadsafe_function(tsfn, reinterpret_cast<void*>(static_cast<intptr_t>(result)),
+                                      napi_tsfn_nonblocking);
+    });
+    return promise;
+}
+
+static napi_value SetRenderMode(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1];
+    napi_value jsThis;
+    napi_get_cb_info(env, info, &argc, args, &jsThis, nullptr);
+
+    MD360PlayerWrapper* wrapper;
+    napi_unwrap(env, jsThis, (void**)&wrapper);
+
+    if (wrapper == nullptr || wrapper->impl == nullptr || argc < 1) {
+        return nullptr;
+    }
+
+    int32_t mode;
+    napi_get_value_int32(env, args[0], &mode);
+
+    MD_LOGI("NAPI SetRenderMode called: mode=%d", mode);
+    wrapper->impl->SetRenderMode(mode);
+    return nullptr;
+}
+
+static napi_value RequestRender(napi_env env, napi_callback_info info) {
+    napi_value jsThis;
+    napi_get_cb_info(env, info, nullptr, nullptr, &jsThis, nullptr);
+
+    MD360PlayerWrapper* wrapper;
+    napi_unwrap(env, jsThis, (void**)&wrapper);
+
+    if (wrapper == nullptr || wrapper->impl == nullptr) {
+        return nullptr;
+    }
+
+    wrapper->impl->RequestRender();
+    return nullptr;
+}
+
+static napi_value GetSkippedFrameCount(napi_env env, napi_callback_info info) {
+    napi_value jsThis;
+    napi_get_cb_info(env, info, nullptr, nullptr, &jsThis, nullptr);
+
+    MD360PlayerWrapper* wrapper;
+    napi_unwrap(env, jsThis, (void**)&wrapper);
+
+    uint64_t count = 0;
+    if (wrapper != nullptr && wrapper->impl != nullptr) {
+        count = wrapper->impl->GetSkippedFrameCount();
+    }
+
+    napi_value result;
+    napi_create_double(env, (double)count, &result);
+    return result;
+}
+
+static void SetNamedDouble(napi_env env, napi_value object, const char* name, double value) {
+    napi_value js_value;
+    napi_create_double(env, value, &js_value);
+    napi_set_named_property(env, object, name, js_value);
+}
+
+static napi_value GetFrameStats(napi_env env, napi_callback_info info) {
+    napi_value jsThis;
+    napi_get_cb_info(env, info, nullptr, nullptr, &jsThis, nullptr);
+
+    MD360PlayerWrapper* wrapper;
+    napi_unwrap(env, jsThis, (void**)&wrapper);
+
+    if (wrapper == nullptr || wrapper->impl == nullptr) {
+        MD_LOGE("GetFrameStats: wrapper or impl is null");
+        napi_value nullValue;
+        napi_get_null(env, &nullValue);
+        return nullValue;
+    }
+
+    MDFrameSchedulerStats scheduler_stats = wrapper->impl->GetFrameSchedulerStats();
+    std::vector<MDStageStats> stages;
+    wrapper->impl->GetFrameStats(&stages);
+
+    napi_value result;
+    napi_create_object(env, &result);
+    SetNamedDouble(env, result, "frames", (double)scheduler_stats.frames);
+    SetNamedDouble(env, result, "missedDeadlines", (double)scheduler_stats.missed_deadlines);
+    SetNamedDouble(env, result, "skippedFrames", (double)wrapper->impl->GetSkippedFrameCount());
+    SetNamedDouble(env, result, "framePeriodMs", scheduler_stats.frame_period_ns / 1000000.0);
+    MDReprojectionStats reprojection_stats = wrapper->impl->GetReprojectionStats();
+    SetNamedDouble(env, result, "renderedFrames", (double)reprojection_stats.rendered_frames);
+    SetNamedDouble(env, result, "reprojectedFrames", (double)reprojection_stats.reprojected_frames);
+    MDResolutionStats resolution_stats = wrapper->impl->GetResolutionStats();
+    SetNamedDouble(env, result, "resolutionScale", resolution_stats.scale);
+    SetNamedDouble(env, result, "resolutionScaleUps", (double)resolution_stats.scale_up_count);
+    SetNamedDouble(env, result, "resolutionScaleDowns", (double)resolution_stats.scale_down_count);
+    SetNamedDouble(env, result, "scaledFrameMs", resolution_stats.frame_ms);
+    SetNamedDouble(env, result, "frameMsBeforeScaleChange", resolution_stats.frame_ms_before_change);
+    SetNamedDouble(env, result, "frameMsAfterScaleChange", resolution_stats.frame_ms_after_change);
+    napi_value gpuTimerSupported;
+    napi_get_boolean(env, resolution_stats.gpu_timer_supported, &gpuTimerSupported);
+    napi_set_named_property(env, result, "gpuTimerSupported", gpuTimerSupported);
+    MDVideoCadenceStats cadence_stats = wrapper->impl->GetVideoCadenceStats();
+    SetNamedDouble(env, result, "videoFps", cadence_stats.source_fps);
+    SetNamedDouble(env, result, "heldVsyncs", (double)cadence_stats.held_vsyncs);
+    napi_value videoCadenceActive;
+    napi_get_boolean(env, cadence_stats.active, &videoCadenceActive);
+    napi_set_named_property(env, result, "videoCadenceActive", videoCadenceActive);
+    MDSuspendStats suspend_stats = wrapper->impl->GetSuspendStats();
+    SetNamedDouble(env, result, "suspendCount", (double)suspend_stats.suspend_count);
+    SetNamedDouble(env, result, "resumeRebuildMs", suspend_stats.last_rebuild_ms);
+    SetNamedDouble(env, result, "resumeToFirstFrameMs", suspend_stats.last_resume_to_first_frame_ms);
+    SetNamedDouble(env, result, "programBinaryHits", (double)suspend_stats.program_binary_hits);
+    SetNamedDouble(env, result, "programBinaryMisses", (double)suspend_stats.program_binary_misses);
+    napi_value gpuReleased;
+    napi_get_boolean(env, suspend_stats.gpu_released, &gpuReleased);
+    napi_set_named_property(env, result, "gpuReleased", gpuReleased);
+    MDMeshLodStats lod_stats = wrapper->impl->GetMeshLodStats();
+    SetNamedDouble(env, result, "meshLodLevel", lod_stats.level);
+    SetNamedDouble(env, result, "meshTriangles", lod_stats.triangles);
+    SetNamedDouble(env, result, "meshLodSwitches", (double)lod_stats.switch_count);
+    napi_value meshLodAuto;
+    napi_get_boolean(env, lod_stats.auto_select, &meshLodAuto);
+    napi_set_named_property(env, result, "meshLodAuto", meshLodAuto);
+    MDCullingStats culling_stats = wrapper->impl->GetCullingStats();
+    SetNamedDouble(env, result, "meshCulledRatio", culling_stats.culled_ratio);
+    SetNamedDouble(env, result, "meshDrawCalls", culling_stats.draw_calls);
+    SetNamedDouble(env, result, "meshSubmittedTriangles", (double)culling_stats.submitted_triangles);
+    SetNamedDouble(env, result, "meshCulledTriangles", (double)culling_stats.culled_triangles);
+    napi_value frustumCulling;
+    napi_get_boolean(env, culling_stats.enabled, &frustumCulling);
+    napi_set_named_property(env, result, "frustumCulling", frustumCulling);
+    MDRayCastStats ray_cast_stats = wrapper->impl->GetRayCastStats();
+    SetNamedDouble(env, result, "rayCastModes", ray_cast_stats.mode_mask);
+    SetNamedDouble(env, result, "rayCastDraws", (double)ray_cast_stats.draws);
+    napi_value rayCastActive;
+    napi_get_boolean(env, ray_cast_stats.active, &rayCastActive);
+    napi_set_named_property(env, result, "rayCastActive", rayCastActive);
+
+    napi_value jsStages;
+    napi_create_array_with_length(env, stages.size(), &jsStages);
+    for (size_t i = 0; i < stages.size(); i++) {
+        const MDStageStats& stage = stages[i];
+        napi_value jsStage;
+        napi_create_object(env, &jsStage);
+        napi_value name;
+        napi_create_string_utf8(env, stage.name, NAPI_AUTO_LENGTH, &name);
+        napi_set_named_property(env, jsStage, "name", name);
+        SetNamedDouble(env, jsStage, "count", (double)stage.count);
+        SetNamedDouble(env, jsStage, "avgMs", stage.avg_ms);
+        SetNamedDouble(env, jsStage, "p50Ms", stage.p50_ms);
+        SetNamedDouble(env, jsStage, "p95Ms", stage.p95_ms);
+        SetNamedDouble(env, jsStage, "p99Ms", stage.p99_ms);
+        SetNamedDouble(env, jsStage, "maxMs", stage.max_ms);
+        napi_set_element(env, jsStages, i, jsStage);
+    }
+    napi_set_named_property(env, result, "stages", jsStages);
+    return result;
+}
+
+static napi_value ResetFrameStats(napi_env env, napi_callback_info info) {
+    napi_value jsThis;
+    napi_get_cb_info(env, info, nullptr, nullptr, &jsThis, nullptr);
+
+    MD360PlayerWrapper* wrapper;
+    napi_unwrap(env, jsThis, (void**)&wrapper);
+
+    if (wrapper == nullptr || wrapper->impl == nullptr) {
+        return nullptr;
+    }
+
+    wrapper->impl->ResetFrameStats();
+    return nullptr;
+}
+
+static napi_value SetReprojectionEnabled(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1];
+    napi_value jsThis;
+    napi_get_cb_info(env, info, &argc, args, &jsThis, nullptr);
+
+    MD360PlayerWrapper* wrapper;
+    napi_unwrap(env, jsThis, (void**)&wrapper);
+
+    if (wrapper == nullptr || wrapper->impl == nullptr || argc < 1) {
+        return nullptr;
+    }
+
+    bool enabled;
+    napi_get_value_bool(env, args[0], &enabled);
+
+    MD_LOGI("NAPI SetReprojectionEnabled called: enabled=%d", enabled);
+    wrapper->impl->SetReprojectionEnabled(enabled);
+    return nullptr;
+}
+
+static napi_value SetVideoCadenceEnabled(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1];
+    napi_value jsThis;
+    napi_get_cb_info(env, info, &argc, args, &jsThis, nullptr);
+
+    MD360PlayerWrapper* wrapper;
+    napi_unwrap(env, jsThis, (void**)&wrapper);
+
+    if (wrapper == nullptr || wrapper->impl == nullptr || argc < 1) {
+        return nullptr;
+    }
+
+    bool enabled;
+    napi_get_value_bool(env, args[0], &enabled);
+
+    MD_LOGI("NAPI SetVideoCadenceEnabled called: enabled=%d", enabled);
+    wrapper->impl->SetVideoCadenceEnabled(enabled);
+    return nullptr;
+}
+
+static napi_value SetDynamicResolution(napi_env env, napi_callback_info info) {
+    size_t argc = 3;
+    napi_value args[3];
+    napi_value jsThis;
+    napi_get_cb_info(env, info, &argc, args, &jsThis, nullptr);
+
+    MD360PlayerWrapper* wrapper;
+    napi_unwrap(env, jsThis, (void**)&wrapper);
+
+    if (wrapper == nullptr || wrapper->impl == nullptr || argc < 1) {
+        return nullptr;
+    }
+
+    bool enabled;
+    napi_get_value_bool(env, args[0], &enabled);
+    double minScale = 0.5;
+    double maxScale = 1.0;
+    if (argc >= 2) {
+        napi_get_value_double(env, args[1], &minScale);
+    }
+    if (argc >= 3) {
+        napi_get_value_double(env, args[2], &maxScale);
+    }
+
+    MD_LOGI("NAPI SetDynamicResolution called: enabled=%d, minScale=%f, maxScale=%f", enabled, minScale, maxScale);
+    wrapper->impl->SetDynamicResolution(enabled, static_cast<float>(minScale), static_cast<float>(maxScale));
+    return nullptr;
+}
+
+static napi_value SetMeshLodLevel(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1];
+    napi_value jsThis;
+    napi_get_cb_info(env, info, &argc, args, &jsThis, nullptr);
+
+    MD360PlayerWrapper* wrapper;
+    napi_unwrap(env, jsThis, (void**)&wrapper);
+
+    if (wrapper == nullptr || wrapper->impl == nullptr) {
+        return nullptr;
+    }
+
+    // 省略参数时恢复自动选择
+    int32_t level = -1;
+    if (argc >= 1) {
+        napi_get_value_int32(env, args[0], &level);
+    }
+
+    MD_LOGI("NAPI SetMeshLodLevel called: level=%d", level);
+    wrapper->impl->SetMeshLodLevel(level);
+    return nullptr;
+}
+
+static napi_value SetFrustumCullingEnabled(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1];
+    napi_value jsThis;
+    napi_get_cb_info(env, info, &argc, args, &jsThis, nullptr);
+
+    MD360PlayerWrapper* wrapper;
+    napi_unwrap(env, jsThis, (void**)&wrapper);
+
+    if (wrapper == nullptr || wrapper->impl == nullptr || argc < 1) {
+        return nullptr;
+    }
+
+    bool enabled;
+    napi_get_value_bool(env, args[0], &enabled);
+
+    MD_LOGI("NAPI SetFrustumCullingEnabled called: enabled=%d", enabled);
+    wrapper->impl->SetFrustumCullingEnabled(enabled);
+    return nullptr;
+}
+
+static napi_value SetRayCastEnabled(napi_env env, napi_callback_info info) {
+    size_t argc = 2;
+    napi_value args[2];
+    napi_value jsThis;
+    napi_get_cb_info(env, info, &argc, args, &jsThis, nullptr);
+
+    MD360PlayerWrapper* wrapper;
+    napi_unwrap(env, jsThis, (void**)&wrapper);
+
+    if (wrapper == nullptr || wrapper->impl == nullptr || argc < 2) {
+        return nullptr;
+    }
+
+    int32_t mode;
+    bool enabled;
+    napi_get_value_int32(env, args[0], &mode);
+    napi_get_value_bool(env, args[1], &enabled);
+
+    MD_LOGI("NAPI SetRayCastEnabled called: mode=%d, enabled=%d", mode, enabled);
+    wrapper->impl->SetRayCastEnabled(mode, enabled);
+    return nullptr;
+}
+
+static napi_value LoadMeshAsset(napi_env env, napi_callback_info info) {
+    size_t argc = 3;
+    napi_value args[3];
+    napi_value jsThis;
+    napi_get_cb_info(env, info, &argc, args, &jsThis, nullptr);
+
+    MD360PlayerWrapper* wrapper;
+    napi_unwrap(env, jsThis, (void**)&wrapper);
+
+    napi_value result;
+    if (wrapper == nullptr || wrapper->impl == nullptr || argc < 3) {
+        napi_create_int32(env, -1, &result);
+        return result;
+    }
+
+    int32_t fd;
+    int64_t offset;
+    int64_t length;
+    napi_get_value_int32(env, args[0], &fd);
+    napi_get_value_int64(env, args[1], &offset);
+    napi_get_value_int64(env, args[2], &length);
+
+    MD_LOGI("NAPI LoadMeshAsset called: fd=%d, offset=%lld, length=%lld", fd, (long long)offset, (long long)length);
+    napi_create_int32(env, wrapper->impl->LoadMeshAsset(fd, offset, length), &result);
+    return result;
+}
+
+static napi_value SetFisheyeLens(napi_env env, napi_callback_info info) {
+    size_t argc = 6;
+    napi_value args[6];
+    napi_value jsThis;
+    napi_get_cb_info(env, info, &argc, args, &jsThis, nullptr);
+
+    MD360PlayerWrapper* wrapper;
+    napi_unwrap(env, jsThis, (void**)&wrapper);
+
+    napi_value result;
+    if (wrapper == nullptr || wrapper->impl == nullptr || argc < 6) {
+        napi_create_int32(env, -1, &result);
+        return result;
+    }
+
+    int32_t index;
+    double params[5];
+    napi_get_value_int32(env, args[0], &index);
+    for (int i = 0; i < 5; i++) {
+        napi_get_value_double(env, args[i + 1], &params[i]);
+    }
+
+    MD_LOGI("NAPI SetFisheyeLens called: lens=%d, fov=%f", index, params[4]);
+    int ret = wrapper->impl->SetFisheyeLens(index, (float)params[0], (float)params[1], (float)params[2],
+                                            (float)params[3], (float)params[4]);
+    napi_create_int32(env, ret, &result);
+    return result;
+}
+
+static napi_value SetCubeLayout(napi_env env, napi_callback_info info) {
+    size_t argc = 3;
+    napi_value args[3];
+    napi_value jsThis;
+    napi_get_cb_info(env, info, &argc, args, &jsThis, nullptr);
+
+    MD360PlayerWrapper* wrapper;
+    napi_unwrap(env, jsThis, (void**)&wrapper);
+
+    napi_value result;
+    if (wrapper == nullptr || wrapper->impl == nullptr || argc < 3) {
+        napi_create_int32(env, -1, &result);
+        return result;
+    }
+
+    int32_t layout;
+    bool equi_angular;
+    double padding;
+    napi_get_value_int32(env, args[0], &layout);
+    napi_get_value_bool(env, args[1], &equi_angular);
+    napi_get_value_double(env, args[2], &padding);
+
+    MD_LOGI("NAPI SetCubeLayout called: layout=%d, equiAngular=%d, padding=%f", layout, equi_angular, padding);
+    napi_create_int32(env, wrapper->impl->SetCubeLayout(layout, equi_angular, (float)padding), &result);
+    return result;
+}
+
+static napi_value SetStereoEyeOffset(napi_env env, napi_callback_info info) {
+    size_t argc = 2;
+    napi_value args[2];
+    napi_value jsThis;
+    napi_get_cb_info(env, info, &argc, args, &jsThis, nullptr);
+
+    MD360PlayerWrapper* wrapper;
+    napi_unwrap(env, jsThis, (void**)&wrapper);
+
+    napi_value result;
+    if (wrapper == nullptr || wrapper->impl == nullptr || argc < 2) {
+        napi_create_int32(env, -1, &result);
+        return result;
+    }
+
+    double left_yaw;
+    double right_yaw;
+    napi_get_value_double(env, args[0], &left_yaw);
+    napi_get_value_double(env, args[1], &right_yaw);
+
+    MD_LOGI("NAPI SetStereoEyeOffset called: left=%f, right=%f", left_yaw, right_yaw);
+    napi_create_int32(env, wrapper->impl->SetStereoEyeOffset((float)left_yaw, (float)right_yaw), &result);
+    return result;
+}
+
+static napi_value SetPlaneOptions(napi_env env, napi_callback_info info) {
+    size_t argc = 2;
+    napi_value args[2];
+    napi_value jsThis;
+    napi_get_cb_info(env, info, &argc, args, &jsThis, nullptr);
+
+    MD360PlayerWrapper* wrapper;
+    napi_unwrap(env, jsThis, (void**)&wrapper);
+
+    napi_value result;
+    if (wrapper == nullptr || wrapper->impl == nullptr || argc < 2) {
+        napi_create_int32(env, -1, &result);
+        return result;
+    }
+
+    int32_t scale_type;
+    double curve_degree;
+    napi_get_value_int32(env, args[0], &scale_type);
+    napi_get_value_double(env, args[1], &curve_degree);
+
+    MD_LOGI("NAPI SetPlaneOptions called: scaleType=%d, curve=%f", scale_type, curve_degree);
+    napi_create_int32(env, wrapper->impl->SetPlaneOptions(scale_type, (float)curve_degree), &result);
+    return result;
+}
+
+static napi_value SetPosePrediction(napi_env env, napi_callback_info info) {
+    size_t argc = 2;
+    napi_value args[2];
+    napi_value jsThis;
+    napi_get_cb_info(env, info, &argc, args, &jsThis, nullptr);
+
+    MD360PlayerWrapper* wrapper;
+    napi_unwrap(env, jsThis, (void**)&wrapper);
+
+    if (wrapper == nullptr || wrapper->impl == nullptr || argc < 1) {
+        return nullptr;
+    }
+
+    bool enabled;
+    napi_get_value_bool(env, args[0], &enabled);
+    double latencyMs = -1.0;
+    if (argc >= 2) {
+        napi_get_value_double(env, args[1], &latencyMs);
+    }
+
+    MD_LOGI("NAPI SetPosePrediction called: enabled=%d, latencyMs=%f", enabled, latencyMs);
+    wrapper->impl->SetPosePrediction(enabled, static_cast<float>(latencyMs));
+    return nullptr;
+}
+
 // VR模式相关方法（新增）
 static napi_value SetVRModeEnabled(napi_env env, napi_callback_info info) {
     size_t argc = 1;
@@ -790,9 +1361,11 @@ static napi_value Init(napi_env env, napi_value exports)
     napi_property_descriptor desc[] = {
         { "setSurfaceId", nullptr, SetSurfaceId, nullptr, nullptr, nullptr, napi_default, nullptr },
         { "runCmd", nullptr, RunCmd, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "suspend", nullptr, Suspend, nullptr, nullptr, nullptr, napi_default, nullptr },
         { "updateMVPMatrix", nullptr, UpdateMVPMatrix, nullptr, nullptr, nullptr, napi_default, nullptr },
         { "updateTouchDelta", nullptr, UpdateTouchDelta, nullptr, nullptr, nullptr, napi_default, nullptr },
         { "getVideoSurfaceId", nullptr, GetVideoSurfaceId, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "shareVideoWith", nullptr, ShareVideoWith, nullptr, nullptr, nullptr, napi_default, nullptr },
         { "setClearColor", nullptr, SetClearColor, nullptr, nullptr, nullptr, napi_default, nullptr },
         { "setCullFaceEnabled", nullptr, SetCullFaceEnabled, nullptr, nullptr, nullptr, napi_default, nullptr },
         { "setDepthTestEnabled", nullptr, SetDepthTestEnabled, nullptr, nullptr, nullptr, napi_default, nullptr },
@@ -802,6 +1375,24 @@ static napi_value Init(napi_env env, napi_value exports)
         { "setBlendEnabled", nullptr, SetBlendEnabled, nullptr, nullptr, nullptr, napi_default, nullptr },
         { "setBlendFunc", nullptr, SetBlendFunc, nullptr, nullptr, nullptr, napi_default, nullptr },
         { "setProjectionMode", nullptr, SetProjectionMode, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "flush", nullptr, Flush, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "setRenderMode", nullptr, SetRenderMode, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "requestRender", nullptr, RequestRender, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "getSkippedFrameCount", nullptr, GetSkippedFrameCount, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "getFrameStats", nullptr, GetFrameStats, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "resetFrameStats", nullptr, ResetFrameStats, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "setVideoCadenceEnabled", nullptr, SetVideoCadenceEnabled, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "setDynamicResolution", nullptr, SetDynamicResolution, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "setMeshLodLevel", nullptr, SetMeshLodLevel, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "setFrustumCullingEnabled", nullptr, SetFrustumCullingEnabled, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "setRayCastEnabled", nullptr, SetRayCastEnabled, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "loadMeshAsset", nullptr, LoadMeshAsset, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "setFisheyeLens", nullptr, SetFisheyeLens, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "setCubeLayout", nullptr, SetCubeLayout, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "setStereoEyeOffset", nullptr, SetStereoEyeOffset, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "setPlaneOptions", nullptr, SetPlaneOptions, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "setPosePrediction", nullptr, SetPosePrediction, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "setReprojectionEnabled", nullptr, SetReprojectionEnabled, nullptr, nullptr, nullptr, napi_default, nullptr },
         // VR模式相关方法（新增）
         { "setVRModeEnabled", nullptr, SetVRModeEnabled, nullptr, nullptr, nullptr, napi_default, nullptr },
         { "setIPD", nullptr, SetIPD, nullptr, nullptr, nullptr, napi_default, nullptr },
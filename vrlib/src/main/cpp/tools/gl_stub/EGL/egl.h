@@ -0,0 +1,17 @@
+//
+// Created on 2026/10/16.
+//
+// 主机侧测试用的 EGL 头文件：当前上下文由测试代码通过 MDGLStub::SetCurrentContext 切换
+
+#ifndef MD360PLAYER4OH_GL_STUB_EGL_H
+#define MD360PLAYER4OH_GL_STUB_EGL_H
+
+typedef void* EGLContext;
+
+#define EGL_NO_CONTEXT ((EGLContext)0)
+
+extern "C" {
+EGLContext eglGetCurrentContext();
+}
+
+#endif //MD360PLAYER4OH_GL_STUB_EGL_H
@@ -0,0 +1,46 @@
+//
+// Created on 2026/10/16.
+//
+// 主机侧测试用的 GLES3 头文件：只声明渲染库用到的类型、常量和函数，实现见 md_gl_stub.cc
+
+#ifndef MD360PLAYER4OH_GL_STUB_GL3_H
+#define MD360PLAYER4OH_GL_STUB_GL3_H
+
+#include <cstddef>
+#include <cstdint>
+
+typedef unsigned int GLenum;
+typedef unsigned int GLuint;
+typedef int GLint;
+typedef int GLsizei;
+typedef unsigned char GLboolean;
+typedef float GLfloat;
+typedef void GLvoid;
+typedef std::ptrdiff_t GLsizeiptr;
+
+#define GL_FALSE                    0
+#define GL_TRUE                     1
+#define GL_TRIANGLES                0x0004
+#define GL_TRIANGLE_STRIP           0x0005
+#define GL_UNSIGNED_SHORT           0x1403
+#define GL_FLOAT                    0x1406
+#define GL_ARRAY_BUFFER             0x8892
+#define GL_ELEMENT_ARRAY_BUFFER     0x8893
+#define GL_STATIC_DRAW              0x88E4
+
+extern "C" {
+void glGenBuffers(GLsizei n, GLuint* buffers);
+void glDeleteBuffers(GLsizei n, const GLuint* buffers);
+void glBindBuffer(GLenum target, GLuint buffer);
+void glBufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage);
+void glGenVertexArrays(GLsizei n, GLuint* arrays);
+void glDeleteVertexArrays(GLsizei n, const GLuint* arrays);
+void glBindVertexArray(GLuint array);
+void glEnableVertexAttribArray(GLuint index);
+void glDisableVertexAttribArray(GLuint index);
+void glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride,
+                           const void* pointer);
+void glDrawElements(GLenum mode, GLsizei count, GLenum type, const void* indices);
+}
+
+#endif //MD360PLAYER4OH_GL_STUB_GL3_H
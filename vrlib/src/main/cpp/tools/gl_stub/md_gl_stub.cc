@@ -0,0 +1,185 @@
+//
+// Created on 2026/10/16.
+//
+
+#include "md_gl_stub.h"
+#include <mutex>
+
+namespace {
+
+// 每个上下文各自的名字空间，和真实的 GL 一样不同上下文的名字互不相干
+struct ContextObjects {
+    GLuint next_name = 1;
+    std::set<GLuint> buffers;
+    std::set<GLuint> vertex_arrays;
+};
+
+struct StubState {
+    std::mutex mutex;
+    std::map<std::string, int> calls;
+    int total_calls = 0;
+    size_t uploaded_bytes = 0;
+    EGLContext context = reinterpret_cast<EGLContext>(1);
+    std::map<EGLContext, ContextObjects> objects;
+};
+
+StubState& State() {
+    static StubState state;
+    return state;
+}
+
+ContextObjects& Record(StubState& state, const char* name) {
+    state.calls[name]++;
+    state.total_calls++;
+    return state.objects[state.context];
+}
+
+}
+
+namespace asha {
+namespace vrlib {
+
+void MDGLStub::ResetCalls() {
+    StubState& state = State();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.calls.clear();
+    state.total_calls = 0;
+    state.uploaded_bytes = 0;
+}
+
+int MDGLStub::TotalCalls() {
+    StubState& state = State();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.total_calls;
+}
+
+int MDGLStub::Calls(const std::string& name) {
+    StubState& state = State();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    auto it = state.calls.find(name);
+    return it != state.calls.end() ? it->second : 0;
+}
+
+std::map<std::string, int> MDGLStub::AllCalls() {
+    StubState& state = State();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.calls;
+}
+
+size_t MDGLStub::LiveBuffers() {
+    StubState& state = State();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.objects[state.context].buffers.size();
+}
+
+size_t MDGLStub::LiveVertexArrays() {
+    StubState& state = State();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.objects[state.context].vertex_arrays.size();
+}
+
+size_t MDGLStub::UploadedBytes() {
+    StubState& state = State();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.uploaded_bytes;
+}
+
+void MDGLStub::SetCurrentContext(EGLContext context) {
+    StubState& state = State();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.context = context;
+}
+
+}
+}
+
+extern "C" {
+
+EGLContext eglGetCurrentContext() {
+    StubState& state = State();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.context;
+}
+
+void glGenBuffers(GLsizei n, GLuint* buffers) {
+    StubState& state = State();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    auto& objects = Record(state, "glGenBuffers");
+    for (GLsizei i = 0; i < n; i++) {
+        buffers[i] = objects.next_name++;
+        objects.buffers.insert(buffers[i]);
+    }
+}
+
+void glDeleteBuffers(GLsizei n, const GLuint* buffers) {
+    StubState& state = State();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    auto& objects = Record(state, "glDeleteBuffers");
+    for (GLsizei i = 0; i < n; i++) {
+        objects.buffers.erase(buffers[i]);
+    }
+}
+
+void glBindBuffer(GLenum, GLuint) {
+    StubState& state = State();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    Record(state, "glBindBuffer");
+}
+
+void glBufferData(GLenum, GLsizeiptr size, const void*, GLenum) {
+    StubState& state = State();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    Record(state, "glBufferData");
+    state.uploaded_bytes += static_cast<size_t>(size);
+}
+
+void glGenVertexArrays(GLsizei n, GLuint* arrays) {
+    StubState& state = State();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    auto& objects = Record(state, "glGenVertexArrays");
+    for (GLsizei i = 0; i < n; i++) {
+        arrays[i] = objects.next_name++;
+        objects.vertex_arrays.insert(arrays[i]);
+    }
+}
+
+void glDeleteVertexArrays(GLsizei n, const GLuint* arrays) {
+    StubState& state = State();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    auto& objects = Record(state, "glDeleteVertexArrays");
+    for (GLsizei i = 0; i < n; i++) {
+        objects.vertex_arrays.erase(arrays[i]);
+    }
+}
+
+void glBindVertexArray(GLuint) {
+    StubState& state = State();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    Record(state, "glBindVertexArray");
+}
+
+void glEnableVertexAttribArray(GLuint) {
+    StubState& state = State();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    Record(state, "glEnableVertexAttribArray");
+}
+
+void glDisableVertexAttribArray(GLuint) {
+    StubState& state = State();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    Record(state, "glDisableVertexAttribArray");
+}
+
+void glVertexAttribPointer(GLuint, GLint, GLenum, GLboolean, GLsizei, const void*) {
+    StubState& state = State();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    Record(state, "glVertexAttribPointer");
+}
+
+void glDrawElements(GLenum, GLsizei, GLenum, const void*) {
+    StubState& state = State();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    Record(state, "glDrawElements");
+}
+
+}
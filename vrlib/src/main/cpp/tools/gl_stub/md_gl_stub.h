@@ -0,0 +1,42 @@
+//
+// Created on 2026/10/16.
+//
+// 主机侧测试用的 GL 桩：记录每个 GL 函数的调用次数，维护生成的缓冲和 VAO 名字，
+// 用来检查渲染代码的调用数、上传次数以及缓冲是否被释放
+
+#ifndef MD360PLAYER4OH_MD_GL_STUB_H
+#define MD360PLAYER4OH_MD_GL_STUB_H
+
+#include <cstddef>
+#include <map>
+#include <set>
+#include <string>
+#include <EGL/egl.h>
+#include <GLES3/gl3.h>
+
+namespace asha {
+namespace vrlib {
+
+class MDGLStub {
+public:
+    // 清零调用计数（已生成的缓冲和 VAO 保留）
+    static void ResetCalls();
+    // 所有 GL 函数的调用总数
+    static int TotalCalls();
+    // 某个 GL 函数的调用次数，name 为函数名（例如 "glBindBuffer"）
+    static int Calls(const std::string& name);
+    static std::map<std::string, int> AllCalls();
+
+    // 当前上下文生成了还没删除的缓冲和 VAO 个数
+    static size_t LiveBuffers();
+    static size_t LiveVertexArrays();
+    // glBufferData 上传的总字节数
+    static size_t UploadedBytes();
+
+    static void SetCurrentContext(EGLContext context);
+};
+
+}
+}
+
+#endif //MD360PLAYER4OH_MD_GL_STUB_H
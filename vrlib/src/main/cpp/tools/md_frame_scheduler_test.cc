@@ -0,0 +1,200 @@
+//
+// Created on 2026/10/16.
+//
+// 主机侧测试：用 MDFakeFrameClock 驱动 MDFrameScheduler，检查每帧的截止时间和剩余预算、
+// 超时帧计数、迟到唤醒时的vsync对齐、刷新率切换、按vsync间隔估计周期时跨过vsync不拉长周期，
+// 以及 Stop 能唤醒阻塞在 BeginFrame 的线程
+// 运行 md_frame_scheduler_test，全部通过时返回 0
+
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include "vrlib/md_defines.h"
+#include "vrlib/md_fake_frame_clock.h"
+#include "vrlib/md_frame_scheduler.h"
+#include "md_test_util.h"
+
+using namespace asha::vrlib;
+
+static const int64_t PERIOD_60HZ = MD_DEFAULT_FRAME_PERIOD_NS;
+static const int64_t PERIOD_120HZ = 8333333LL;
+static const int64_t MS = 1000000LL;
+
+// 按时完成的帧：截止时间是下一个vsync，预算随渲染耗时减少
+MD_TEST(TestOnTimeFrame) {
+    auto clock = std::make_shared<MDFakeFrameClock>(PERIOD_60HZ);
+    MDFrameScheduler scheduler(clock);
+    EXPECT_EQ(MD_OK, scheduler.Start());
+
+    clock->Tick();
+    EXPECT_EQ(MD_OK, scheduler.BeginFrame());
+    EXPECT_EQ(PERIOD_60HZ, scheduler.GetFrameStartNs());
+    EXPECT_EQ(PERIOD_60HZ * 2, scheduler.GetDeadlineNs());
+    EXPECT_EQ(PERIOD_60HZ, scheduler.GetRemainingBudgetNs());
+
+    clock->Advance(5 * MS);
+    EXPECT_EQ(PERIOD_60HZ - 5 * MS, scheduler.GetRemainingBudgetNs());
+    EXPECT_EQ(true, scheduler.EndFrame());
+
+    MDFrameSchedulerStats stats = scheduler.GetStats();
+    EXPECT_EQ(1, stats.frames);
+    EXPECT_EQ(0, stats.missed_deadlines);
+    EXPECT_EQ(PERIOD_60HZ, stats.frame_period_ns);
+}
+
+// 超时帧：预算变为负数并计入 missed_deadlines，下一帧对齐到之后的vsync
+MD_TEST(TestMissedDeadline) {
+    auto clock = std::make_shared<MDFakeFrameClock>(PERIOD_60HZ);
+    MDFrameScheduler scheduler(clock);
+    scheduler.Start();
+
+    clock->Tick();
+    scheduler.BeginFrame();
+    clock->Advance(20 * MS);
+    EXPECT_EQ(PERIOD_60HZ - 20 * MS, scheduler.GetRemainingBudgetNs());
+    EXPECT_EQ(false, scheduler.EndFrame());
+
+    // 超时的帧占用了第二个vsync，下一帧从第三个vsync开始
+    clock->Tick();
+    scheduler.BeginFrame();
+    EXPECT_EQ(PERIOD_60HZ * 3, scheduler.GetFrameStartNs());
+    EXPECT_EQ(PERIOD_60HZ * 4, scheduler.GetDeadlineNs());
+    clock->Advance(PERIOD_60HZ);
+    EXPECT_EQ(true, scheduler.EndFrame());
+
+    // 恰好在截止时间完成不算超时，晚 1ns 才算
+    clock->Tick();
+    scheduler.BeginFrame();
+    clock->Advance(PERIOD_60HZ + 1);
+    EXPECT_EQ(false, scheduler.EndFrame());
+
+    MDFrameSchedulerStats stats = scheduler.GetStats();
+    EXPECT_EQ(3, stats.frames);
+    EXPECT_EQ(2, stats.missed_deadlines);
+}
+
+// 大量超时帧只打印少量日志，但计数不丢
+MD_TEST(TestMissedDeadlineCount) {
+    auto clock = std::make_shared<MDFakeFrameClock>(PERIOD_60HZ);
+    MDFrameScheduler scheduler(clock);
+    scheduler.Start();
+    for (int i = 0; i < 100; i++) {
+        clock->Tick();
+        scheduler.BeginFrame();
+        clock->Advance(i % 2 == 0 ? PERIOD_60HZ * 3 / 2 : 4 * MS);
+        scheduler.EndFrame();
+    }
+    MDFrameSchedulerStats stats = scheduler.GetStats();
+    EXPECT_EQ(100, stats.frames);
+    EXPECT_EQ(50, stats.missed_deadlines);
+}
+
+// vsync回调排队导致唤醒迟到时，截止时间按当前所在周期计算
+MD_TEST(TestLateWakeup) {
+    auto clock = std::make_shared<MDFakeFrameClock>(PERIOD_60HZ);
+    MDFrameScheduler scheduler(clock);
+    scheduler.Start();
+
+    clock->Tick();
+    clock->Advance(PERIOD_60HZ * 2 + PERIOD_60HZ / 2);
+    scheduler.BeginFrame();
+    EXPECT_EQ(PERIOD_60HZ * 4, scheduler.GetDeadlineNs());
+    EXPECT_EQ(PERIOD_60HZ - PERIOD_60HZ / 2, scheduler.GetRemainingBudgetNs());
+    EXPECT_EQ(true, scheduler.EndFrame());
+}
+
+// 刷新率切换后预算按新的周期计算
+MD_TEST(TestFramePeriodChange) {
+    auto clock = std::make_shared<MDFakeFrameClock>(PERIOD_60HZ);
+    MDFrameScheduler scheduler(clock);
+    scheduler.Start();
+
+    clock->Tick();
+    scheduler.BeginFrame();
+    scheduler.EndFrame();
+
+    clock->SetFramePeriodNs(PERIOD_120HZ);
+    clock->Tick();
+    scheduler.BeginFrame();
+    EXPECT_EQ(PERIOD_120HZ, scheduler.GetFramePeriodNs());
+    EXPECT_EQ(PERIOD_60HZ + PERIOD_120HZ, scheduler.GetFrameStartNs());
+    EXPECT_EQ(PERIOD_60HZ + PERIOD_120HZ * 2, scheduler.GetDeadlineNs());
+    // 60Hz 下按时的渲染耗时在 120Hz 下超时
+    clock->Advance(10 * MS);
+    EXPECT_EQ(false, scheduler.EndFrame());
+
+    MDFrameSchedulerStats stats = scheduler.GetStats();
+    EXPECT_EQ(2, stats.frames);
+    EXPECT_EQ(1, stats.missed_deadlines);
+    EXPECT_EQ(PERIOD_120HZ, stats.frame_period_ns);
+}
+
+// 渲染线程阻塞在 BeginFrame 上，由另一个线程触发vsync和停止
+// 拿不到系统周期时按vsync间隔估计：长帧和空闲跨过多个vsync时周期不能被拉长
+MD_TEST(TestSkippedVsyncsKeepPeriod) {
+    auto clock = std::make_shared<MDFakeFrameClock>(PERIOD_60HZ);
+    clock->EnablePeriodEstimation(PERIOD_60HZ);
+    MDFrameScheduler scheduler(clock);
+    scheduler.Start();
+
+    // 渲染耗时依次为：按时、跨过1个vsync、跨过2个vsync（按需渲染空闲）、稍微超时
+    const int64_t render_ns[] = {5 * MS, 20 * MS, 40 * MS, 17 * MS};
+    for (int i = 0; i < 120; i++) {
+        clock->Tick();
+        scheduler.BeginFrame();
+        EXPECT_NEAR(PERIOD_60HZ, scheduler.GetFramePeriodNs(), 0.05 * MS);
+        clock->Advance(render_ns[i % 4]);
+        scheduler.EndFrame();
+    }
+    EXPECT_NEAR(PERIOD_60HZ, clock->GetFramePeriodNs(), 0.05 * MS);
+    EXPECT_EQ(90, scheduler.GetStats().missed_deadlines);
+}
+
+// 初始值与面板不符时（120Hz 面板按 60Hz 起步）收敛到真实周期，之后跨过vsync也不受影响
+MD_TEST(TestPeriodEstimationConverges) {
+    auto clock = std::make_shared<MDFakeFrameClock>(PERIOD_120HZ);
+    clock->EnablePeriodEstimation(PERIOD_60HZ);
+    MDFrameScheduler scheduler(clock);
+    scheduler.Start();
+
+    for (int i = 0; i < 60; i++) {
+        clock->Tick();
+        scheduler.BeginFrame();
+        clock->Advance(2 * MS);
+        scheduler.EndFrame();
+    }
+    EXPECT_NEAR(PERIOD_120HZ, scheduler.GetFramePeriodNs(), 0.05 * MS);
+
+    for (int i = 0; i < 60; i++) {
+        clock->Tick();
+        scheduler.BeginFrame();
+        clock->Advance(i % 2 == 0 ? 2 * MS : 20 * MS);
+        scheduler.EndFrame();
+    }
+    EXPECT_NEAR(PERIOD_120HZ, scheduler.GetFramePeriodNs(), 0.05 * MS);
+}
+
+MD_TEST(TestBlockingWait) {
+    auto clock = std::make_shared<MDFakeFrameClock>(PERIOD_60HZ);
+    MDFrameScheduler scheduler(clock);
+    scheduler.Start();
+
+    int ret = MD_ERR;
+    std::thread render_thread([&]() {
+        ret = scheduler.BeginFrame();
+    });
+    clock->Tick();
+    render_thread.join();
+    EXPECT_EQ(MD_OK, ret);
+    EXPECT_EQ(PERIOD_60HZ * 2, scheduler.GetDeadlineNs());
+
+    ret = MD_OK;
+    render_thread = std::thread([&]() {
+        ret = scheduler.BeginFrame();
+    });
+    scheduler.Stop();
+    render_thread.join();
+    EXPECT_EQ(MD_ERR, ret);
+}
+
+MD_TEST_MAIN("md_frame_scheduler_test")
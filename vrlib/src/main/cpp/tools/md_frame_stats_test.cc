@@ -0,0 +1,113 @@
+//
+// Created on 2026/10/16.
+//
+// 主机侧测试：MDLatencyHistogram 的分桶和桶上界，按已知耗时检查 p50/p95/p99、不超过最大值的截断，
+// 以及超出最后一段（约2.1s）的耗时计入最后一个桶、分位数取最大值
+// 运行 md_frame_stats_test，全部通过时返回 0
+
+#include <cstdint>
+#include "vrlib/md_frame_stats.h"
+#include "md_test_util.h"
+
+using namespace asha::vrlib;
+
+static const int64_t US = 1000LL;
+static const int64_t MS = 1000000LL;
+
+static void RecordRepeated(MDLatencyHistogram* histogram, int64_t duration_ns, int times) {
+    for (int i = 0; i < times; i++) {
+        histogram->Record(duration_ns);
+    }
+}
+
+// 8us 以下每微秒一个桶，上界为 值+1
+MD_TEST(TestLinearBuckets) {
+    MDLatencyHistogram histogram;
+    RecordRepeated(&histogram, 3 * US, 3);
+    histogram.Record(1 * MS);
+    MDStageStats stats;
+    histogram.GetStats(&stats);
+    EXPECT_EQ(4, stats.count);
+    EXPECT_NEAR(0.004, stats.p50_ms, 1e-9);
+}
+
+// 每段按最高位之后的3位细分：16/17us 同桶（上界18），18us 进下一个桶（上界20）
+MD_TEST(TestOctaveSubBuckets) {
+    MDLatencyHistogram histogram;
+    RecordRepeated(&histogram, 16 * US, 2);
+    RecordRepeated(&histogram, 17 * US, 2);
+    histogram.Record(1 * MS);
+    MDStageStats stats;
+    histogram.GetStats(&stats);
+    EXPECT_NEAR(0.018, stats.p50_ms, 1e-9);
+
+    histogram.Reset();
+    RecordRepeated(&histogram, 18 * US, 3);
+    histogram.Record(1 * MS);
+    histogram.GetStats(&stats);
+    EXPECT_NEAR(0.020, stats.p50_ms, 1e-9);
+}
+
+// 90 帧 1ms、8 帧 10ms、2 帧 100ms：p50/p95 取所在桶的上界（1.024ms、10.24ms），
+// p99 所在桶的上界 106.496ms 超过实际最大值，截断为 100ms
+MD_TEST(TestPercentiles) {
+    MDLatencyHistogram histogram;
+    RecordRepeated(&histogram, 1 * MS, 90);
+    RecordRepeated(&histogram, 10 * MS, 8);
+    RecordRepeated(&histogram, 100 * MS, 2);
+    MDStageStats stats;
+    histogram.GetStats(&stats);
+    EXPECT_EQ(100, stats.count);
+    EXPECT_NEAR(3.7, stats.avg_ms, 1e-9);
+    EXPECT_NEAR(1.024, stats.p50_ms, 1e-9);
+    EXPECT_NEAR(10.24, stats.p95_ms, 1e-9);
+    EXPECT_NEAR(100.0, stats.p99_ms, 1e-9);
+    EXPECT_NEAR(100.0, stats.max_ms, 1e-9);
+}
+
+// 同一个桶内的耗时，分位数截断到实际最大值，不报桶上界
+MD_TEST(TestPercentileClampedToMax) {
+    MDLatencyHistogram histogram;
+    RecordRepeated(&histogram, 5 * US, 10);
+    MDStageStats stats;
+    histogram.GetStats(&stats);
+    EXPECT_NEAR(0.005, stats.p50_ms, 1e-9);
+    EXPECT_NEAR(0.005, stats.p99_ms, 1e-9);
+    EXPECT_NEAR(0.005, stats.max_ms, 1e-9);
+}
+
+// 2s 仍在最后一段内（上界 2097.152ms）；3s、10s 超出最后一段，计入最后一个桶，分位数取最大值
+MD_TEST(TestBeyondLastOctave) {
+    MDLatencyHistogram histogram;
+    RecordRepeated(&histogram, 2000 * MS, 3);
+    histogram.Record(10000 * MS);
+    MDStageStats stats;
+    histogram.GetStats(&stats);
+    EXPECT_NEAR(2097.152, stats.p50_ms, 1e-9);
+    EXPECT_NEAR(10000.0, stats.p99_ms, 1e-9);
+    EXPECT_NEAR(10000.0, stats.max_ms, 1e-9);
+
+    histogram.Reset();
+    RecordRepeated(&histogram, 3000 * MS, 2);
+    histogram.Record(10000 * MS);
+    histogram.GetStats(&stats);
+    EXPECT_NEAR(10000.0, stats.p50_ms, 1e-9);
+}
+
+// 负的耗时按0记录；Reset 之后统计全部清零
+MD_TEST(TestNegativeAndReset) {
+    MDLatencyHistogram histogram;
+    histogram.Record(-5 * MS);
+    MDStageStats stats;
+    histogram.GetStats(&stats);
+    EXPECT_EQ(1, stats.count);
+    EXPECT_NEAR(0.0, stats.p50_ms, 1e-9);
+    EXPECT_NEAR(0.0, stats.max_ms, 1e-9);
+
+    histogram.Reset();
+    histogram.GetStats(&stats);
+    EXPECT_EQ(0, stats.count);
+    EXPECT_NEAR(0.0, stats.p99_ms, 1e-9);
+}
+
+MD_TEST_MAIN("md_frame_stats_test")
@@ -0,0 +1,100 @@
+//
+// Created on 2026/10/16.
+//
+// 主机侧测试：在 GL 桩上统计 MDObject3D 每次绘制的 GL 调用数，
+// 和改用交错 VBO + VAO 之前的绘制流程（LegacyDraw，按原实现逐条照搬）对比
+// 运行 md_gl_call_count_test，全部通过时返回 0
+
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include "gl_stub/md_gl_stub.h"
+#include "vrlib/md_object_3d.h"
+#include "md_test_util.h"
+
+using namespace asha::vrlib;
+
+// 原实现：位置和纹理坐标各一个 VBO，每次绘制都重新绑定缓冲、设置并关闭顶点属性
+static void LegacyDraw(GLuint vbo_vertices, GLuint vbo_texcoords, GLuint ibo_indices, int num_indices) {
+    glBindBuffer(GL_ARRAY_BUFFER, vbo_vertices);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, 0);
+
+    glBindBuffer(GL_ARRAY_BUFFER, vbo_texcoords);
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 0, 0);
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo_indices);
+    glDrawElements(GL_TRIANGLES, num_indices, GL_UNSIGNED_SHORT, 0);
+
+    glDisableVertexAttribArray(0);
+    glDisableVertexAttribArray(1);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+}
+
+static void WaitForMesh(MDObject3D* object) {
+    while (object->IsLoading()) {
+        object->PollPendingMesh();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+static void PrintCalls(const char* title) {
+    printf("  %s: %d calls\n", title, MDGLStub::TotalCalls());
+    for (const auto& entry : MDGLStub::AllCalls()) {
+        printf("    %-28s %d\n", entry.first.c_str(), entry.second);
+    }
+}
+
+MD_TEST(TestDrawCallCount) {
+    MDObject3D object;
+    object.LoadSphere();
+    WaitForMesh(&object);
+
+    // 第一次绘制时上传，上传的调用不计入每帧的绘制
+    MDGLStub::ResetCalls();
+    object.UploadData();
+    PrintCalls("upload (once per mesh and context)");
+    EXPECT_EQ(1, MDGLStub::Calls("glGenVertexArrays"));
+    EXPECT_EQ(2, MDGLStub::Calls("glBufferData"));
+
+    MDGLStub::ResetCalls();
+    int draw_calls = 0;
+    int triangles = object.Draw(nullptr, &draw_calls);
+    int vao_calls = MDGLStub::TotalCalls();
+    PrintCalls("Draw() with VAO");
+    EXPECT_EQ(3, vao_calls);
+    EXPECT_EQ(1, draw_calls);
+    EXPECT_EQ(1, MDGLStub::Calls("glDrawElements"));
+    EXPECT_EQ(object.GetTriangleCount(), triangles);
+
+    GLuint legacy_buffers[3];
+    glGenBuffers(3, legacy_buffers);
+    MDGLStub::ResetCalls();
+    LegacyDraw(legacy_buffers[0], legacy_buffers[1], legacy_buffers[2], triangles * 3);
+    int legacy_calls = MDGLStub::TotalCalls();
+    PrintCalls("Draw() before (separate VBOs, per-draw attribute setup)");
+    EXPECT_EQ(12, legacy_calls);
+    glDeleteBuffers(3, legacy_buffers);
+
+    // 传入 MVP 时按视锥剔除分块，每个可见区间一次 glDrawElements，VAO 绑定仍只有一对
+    const float forward_mvp[16] = {
+        1.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 1.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, -1.002f, -1.0f,
+        0.0f, 0.0f, -0.2002f, 0.0f,
+    };
+    MDGLStub::ResetCalls();
+    int culled_triangles = object.Draw(forward_mvp, &draw_calls);
+    int culled_calls = MDGLStub::TotalCalls();
+    EXPECT_EQ(draw_calls + 2, culled_calls);
+    EXPECT_EQ(2, MDGLStub::Calls("glBindVertexArray"));
+
+    printf("GL calls per draw: before %d, after %d; VR (two eyes) per frame: before %d, after %d\n",
+           legacy_calls, vao_calls, legacy_calls * 2, vao_calls * 2);
+    printf("with frustum culling: %d calls, %d draw ranges, %d of %d triangles submitted\n",
+           culled_calls, draw_calls, culled_triangles, triangles);
+}
+
+MD_TEST_MAIN("md_gl_call_count_test")
@@ -0,0 +1,215 @@
+//
+// Created on 2026/10/16.
+//
+// 主机侧测试：MDGLCommandQueue 的合并、队列已满、Close 取消，以及多个生产者并发入队、
+// GL线程不停 Drain、中途 Close 的压力场景下每个完成回调恰好调用一次，且结果与 Push 的返回值一致
+// 运行 md_gl_command_queue_test，全部通过时返回 0；cmake -DMD_TOOLS_TSAN=ON 另有 ThreadSanitizer 版本
+
+#include <atomic>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "vrlib/md_defines.h"
+#include "vrlib/md_gl_command_queue.h"
+#include "md_test_util.h"
+
+using namespace asha::vrlib;
+
+// 记录每个回调的调用次数和最后一次的结果
+struct CallbackLog {
+    explicit CallbackLog(size_t count) : calls(count), results(count) {
+        for (size_t i = 0; i < count; i++) {
+            calls[i] = 0;
+            results[i] = 0;
+        }
+    }
+
+    MDGLCommandCallback Make(size_t id) {
+        return [this, id](int result) {
+            results[id].store(result);
+            calls[id].fetch_add(1);
+        };
+    }
+
+    std::vector<std::atomic<int>> calls;
+    std::vector<std::atomic<int>> results;
+};
+
+static const int EXEC_RESULT = 7;
+
+// 同类型的可合并命令只执行一次（最后的参数），所有回调都拿到执行结果；FLUSH 不合并
+MD_TEST(TestCoalescing) {
+    MDGLCommandQueue queue;
+    CallbackLog log(7);
+    EXPECT_EQ(MD_OK, queue.Push(MD_GL_CMD_SURFACE_CHANGED, 0, log.Make(0)));
+    EXPECT_EQ(MD_OK, queue.Push(MD_GL_CMD_SET_PROJECTION_MODE, 201, log.Make(1)));
+    EXPECT_EQ(MD_OK, queue.Push(MD_GL_CMD_FLUSH, 0, log.Make(2)));
+    EXPECT_EQ(MD_OK, queue.Push(MD_GL_CMD_SURFACE_CHANGED, 0, log.Make(3)));
+    EXPECT_EQ(MD_OK, queue.Push(MD_GL_CMD_SET_PROJECTION_MODE, 212, log.Make(4)));
+    EXPECT_EQ(MD_OK, queue.Push(MD_GL_CMD_FLUSH, 0, log.Make(5)));
+    EXPECT_EQ(MD_OK, queue.Push(MD_GL_CMD_SET_PROJECTION_MODE, 207, log.Make(6)));
+    EXPECT_EQ(false, queue.IsEmpty());
+
+    std::vector<MDGLCommandType> executed;
+    int projection_mode = 0;
+    size_t count = queue.Drain([&](const MDGLCommand& command) {
+        executed.push_back(command.type);
+        if (command.type == MD_GL_CMD_SET_PROJECTION_MODE) {
+            projection_mode = command.arg;
+        }
+        return EXEC_RESULT;
+    });
+    // 合并后的命令保持第一次入队的位置
+    EXPECT_EQ(4, count);
+    EXPECT_EQ(4, executed.size());
+    if (executed.size() == 4) {
+        EXPECT_EQ(MD_GL_CMD_SURFACE_CHANGED, executed[0]);
+        EXPECT_EQ(MD_GL_CMD_SET_PROJECTION_MODE, executed[1]);
+        EXPECT_EQ(MD_GL_CMD_FLUSH, executed[2]);
+        EXPECT_EQ(MD_GL_CMD_FLUSH, executed[3]);
+    }
+    EXPECT_EQ(207, projection_mode);
+    for (size_t i = 0; i < log.calls.size(); i++) {
+        EXPECT_EQ(1, log.calls[i]);
+        EXPECT_EQ(EXEC_RESULT, log.results[i]);
+    }
+    EXPECT_EQ(true, queue.IsEmpty());
+    EXPECT_EQ(0, queue.Drain([](const MDGLCommand&) { return MD_OK; }));
+}
+
+// 队列已满时新命令立即以 MD_ERR_QUEUE_FULL 完成，但还能合并进已有的同类命令
+MD_TEST(TestFullQueue) {
+    MDGLCommandQueue queue(3);
+    CallbackLog log(5);
+    EXPECT_EQ(MD_OK, queue.Push(MD_GL_CMD_SURFACE_CHANGED, 0, log.Make(0)));
+    EXPECT_EQ(MD_OK, queue.Push(MD_GL_CMD_FLUSH, 0, log.Make(1)));
+    EXPECT_EQ(MD_OK, queue.Push(MD_GL_CMD_FLUSH, 0, log.Make(2)));
+    EXPECT_EQ(MD_ERR_QUEUE_FULL, queue.Push(MD_GL_CMD_FLUSH, 0, log.Make(3)));
+    EXPECT_EQ(1, log.calls[3]);
+    EXPECT_EQ(MD_ERR_QUEUE_FULL, log.results[3]);
+    EXPECT_EQ(MD_OK, queue.Push(MD_GL_CMD_SURFACE_CHANGED, 0, log.Make(4)));
+    EXPECT_EQ(0, log.calls[4]);
+    // 不带回调的命令同样会被拒绝
+    EXPECT_EQ(MD_ERR_QUEUE_FULL, queue.Push(MD_GL_CMD_RESET_VR_RESOURCES, 0));
+
+    EXPECT_EQ(3, queue.Drain([](const MDGLCommand&) { return MD_OK; }));
+    for (size_t i = 0; i < log.calls.size(); i++) {
+        EXPECT_EQ(1, log.calls[i]);
+    }
+    EXPECT_EQ(MD_OK, log.results[4]);
+    // 执行完之后又有空位
+    EXPECT_EQ(MD_OK, queue.Push(MD_GL_CMD_FLUSH, 0));
+}
+
+// Close 以给定结果完成所有未执行的命令，之后的 Push 直接失败
+MD_TEST(TestClose) {
+    MDGLCommandQueue queue;
+    CallbackLog log(4);
+    queue.Push(MD_GL_CMD_SET_PROJECTION_MODE, 201, log.Make(0));
+    queue.Push(MD_GL_CMD_SET_PROJECTION_MODE, 202, log.Make(1));
+    queue.Push(MD_GL_CMD_FLUSH, 0, log.Make(2));
+    queue.Close(MD_ERR_CANCELLED);
+    EXPECT_EQ(true, queue.IsEmpty());
+    for (int i = 0; i < 3; i++) {
+        EXPECT_EQ(1, log.calls[i]);
+        EXPECT_EQ(MD_ERR_CANCELLED, log.results[i]);
+    }
+    EXPECT_EQ(MD_ERR_CANCELLED, queue.Push(MD_GL_CMD_FLUSH, 0, log.Make(3)));
+    EXPECT_EQ(1, log.calls[3]);
+    EXPECT_EQ(MD_ERR_CANCELLED, log.results[3]);
+    int executed = 0;
+    EXPECT_EQ(0, queue.Drain([&](const MDGLCommand&) { executed++; return MD_OK; }));
+    EXPECT_EQ(0, executed);
+}
+
+// 回调里再入队的命令留到下一次 Drain，不会死锁
+MD_TEST(TestPushFromCallback) {
+    MDGLCommandQueue queue;
+    CallbackLog log(2);
+    queue.Push(MD_GL_CMD_FLUSH, 0, [&](int result) {
+        log.Make(0)(result);
+        queue.Push(MD_GL_CMD_FLUSH, 0, log.Make(1));
+    });
+    EXPECT_EQ(1, queue.Drain([](const MDGLCommand&) { return MD_OK; }));
+    EXPECT_EQ(1, log.calls[0]);
+    EXPECT_EQ(0, log.calls[1]);
+    EXPECT_EQ(1, queue.Drain([](const MDGLCommand&) { return MD_OK; }));
+    EXPECT_EQ(1, log.calls[1]);
+}
+
+// 多个生产者并发入队，GL线程不停 Drain，中途 Close：每个回调恰好调用一次，
+// 入队失败时回调结果等于 Push 的返回值
+MD_TEST(TestConcurrentStress) {
+    const int producer_count = 4;
+    const int pushes_per_producer = 20000;
+    const size_t total = (size_t)producer_count * pushes_per_producer;
+    MDGLCommandQueue queue(4);
+    CallbackLog log(total);
+    std::vector<int> push_results(total, 0);
+    std::atomic<int> producers_done{0};
+    std::atomic<bool> closed{false};
+
+    std::thread consumer([&]() {
+        while (producers_done.load() < producer_count) {
+            queue.Drain([](const MDGLCommand&) { return EXEC_RESULT; });
+            std::this_thread::yield();
+        }
+    });
+    std::vector<std::thread> producers;
+    for (int p = 0; p < producer_count; p++) {
+        producers.emplace_back([&, p]() {
+            for (int i = 0; i < pushes_per_producer; i++) {
+                size_t id = (size_t)p * pushes_per_producer + i;
+                MDGLCommandType type = (MDGLCommandType)((i + p) % MD_GL_CMD_COUNT);
+                push_results[id] = queue.Push(type, i, log.Make(id));
+                // 第一个生产者写到九成时关闭队列
+                if (p == 0 && i == pushes_per_producer * 9 / 10) {
+                    queue.Close(MD_ERR_CANCELLED);
+                    closed = true;
+                }
+                if (i % 8 == 0) {
+                    std::this_thread::yield();
+                }
+            }
+            producers_done.fetch_add(1);
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    consumer.join();
+    queue.Drain([](const MDGLCommand&) { return EXEC_RESULT; });
+
+    size_t wrong_calls = 0;
+    size_t wrong_results = 0;
+    size_t executed = 0;
+    size_t cancelled = 0;
+    size_t full = 0;
+    for (size_t id = 0; id < total; id++) {
+        if (log.calls[id] != 1) {
+            wrong_calls++;
+        }
+        int result = log.results[id];
+        if (push_results[id] != MD_OK && push_results[id] != result) {
+            wrong_results++;
+        }
+        if (result == EXEC_RESULT) {
+            executed++;
+        } else if (result == MD_ERR_CANCELLED) {
+            cancelled++;
+        } else if (result == MD_ERR_QUEUE_FULL) {
+            full++;
+        } else {
+            wrong_results++;
+        }
+    }
+    printf("md_gl_command_queue_test: stress %zu pushes, executed %zu, cancelled %zu, full %zu\n",
+           total, executed, cancelled, full);
+    EXPECT_EQ(true, closed.load());
+    EXPECT_EQ(0, wrong_calls);
+    EXPECT_EQ(0, wrong_results);
+    EXPECT_EQ(true, cancelled > 0);
+}
+
+MD_TEST_MAIN("md_gl_command_queue_test")
@@ -0,0 +1,37 @@
+//
+// Created on 2026/10/16.
+//
+// 主机侧工具用来替代 md_log.cc / md_frame_clock.cc 中依赖 OHOS SDK 的部分：
+// 日志输出到 stderr，MDNowNs 用 steady_clock，主机上没有 vsync 所以不提供 vsync 时钟
+
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include "vrlib/md_frame_clock.h"
+#include "vrlib/md_log.h"
+
+namespace asha {
+namespace vrlib {
+
+void MDLog::Log(MDLogLevel level, const char* tag, const char* fmt, ...) {
+    static const char* LEVEL_NAMES[] = {"D", "I", "W", "E", "F"};
+    fprintf(stderr, "%s/%s: ", LEVEL_NAMES[level], tag);
+    va_list arg;
+    va_start(arg, fmt);
+    vfprintf(stderr, fmt, arg);
+    va_end(arg);
+    fprintf(stderr, "\n");
+}
+
+int64_t MDNowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// 主机侧必须显式传入时钟（例如 MDFakeFrameClock）
+std::shared_ptr<MDFrameClock> MDFrameClock::CreateVsyncClock() {
+    return nullptr;
+}
+
+}
+}
@@ -0,0 +1,79 @@
+//
+// Created on 2026/10/16.
+//
+// 主机侧工具：把球面和半球投影网格（每个细分级别的三角形列表，可选再加一份三角形带）预先生成、分块、重排索引，
+// 写成 MDMeshAsset 资源文件。放进应用的 rawfile 后用 MDVRLibrary.loadMeshAsset 加载，
+// 启动和切换投影模式时直接映射上传，不再生成网格。立方体（只有24个顶点）和双鱼眼的网格随画面排列、镜头标定变化，
+// 运行时生成，不烘焙
+// 构建：cmake -S vrlib/src/main/cpp/tools -B build-tools，运行 md_mesh_bake <output> [--with-strips]
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include "vrlib/md_mesh_asset.h"
+#include "vrlib/md_mesh_culling.h"
+#include "vrlib/md_mesh_generator.h"
+#include "vrlib/md_mesh_lod.h"
+#include "vrlib/md_object_3d.h"
+
+using namespace asha::vrlib;
+
+// 与 MDObject3D::LoadSphere / LoadDome 的半径和网格键保持一致，否则运行时查不到资源里的网格
+static const float MESH_RADIUS = 18.0f;
+
+// 与 MDObject3D::OptimizeIndices 相同：记录三角形数后分块并按顶点缓存重排
+static void Finish(MDMeshData* mesh, bool triangle_strip) {
+    mesh->triangle_count = static_cast<int>(mesh->indices.size() / 3);
+    MDMeshCulling::BuildPatches(mesh, triangle_strip);
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <output> [--with-strips]\n", argv[0]);
+        return 1;
+    }
+    // 三角形带默认关闭（MDObject3D::SetTriangleStripsEnabled），只在用到时才烘焙，否则资源大一倍
+    bool with_strips = argc > 2 && strcmp(argv[2], "--with-strips") == 0;
+    const struct {
+        int type;
+        float degree;
+        bool upper;
+    } domes[] = {
+        {MDObject3D::DOME180, 180.0f, false},
+        {MDObject3D::DOME230, 230.0f, false},
+        {MDObject3D::DOME180_UPPER, 180.0f, true},
+        {MDObject3D::DOME230_UPPER, 230.0f, true},
+    };
+
+    MDMeshAssetWriter writer;
+    for (int strip = 0; strip < (with_strips ? 2 : 1); strip++) {
+        bool triangle_strip = strip == 1;
+        for (int level = 0; level < MD_MESH_LOD_COUNT; level++) {
+            MDMeshLodParams lod = MDMeshLod::GetParams(level);
+            MDMeshData sphere;
+            MDMeshGenerator::GenerateSphere(&sphere, MESH_RADIUS, lod.rings, lod.sectors);
+            Finish(&sphere, triangle_strip);
+            writer.AddMesh(MDObject3D::SPHERE, MESH_RADIUS, lod.rings, lod.sectors, 0.0f, sphere);
+            for (const auto& dome : domes) {
+                MDMeshData mesh;
+                MDMeshGenerator::GenerateDome(&mesh, MESH_RADIUS, lod.sectors, dome.degree, dome.upper);
+                Finish(&mesh, triangle_strip);
+                writer.AddMesh(dome.type, MESH_RADIUS, 0, lod.sectors, dome.degree, mesh);
+            }
+        }
+    }
+    if (!writer.Save(argv[1])) {
+        fprintf(stderr, "failed to write %s\n", argv[1]);
+        return 1;
+    }
+
+    // 读回来校验一遍
+    int error = 0;
+    std::shared_ptr<MDMeshAsset> asset = MDMeshAsset::Open(argv[1], &error);
+    if (asset == nullptr) {
+        fprintf(stderr, "failed to read back %s: %d\n", argv[1], error);
+        return 1;
+    }
+    printf("%s: %d meshes, %zu bytes\n", argv[1], asset->GetEntryCount(), asset->GetSize());
+    return 0;
+}
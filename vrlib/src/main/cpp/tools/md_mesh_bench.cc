@@ -0,0 +1,243 @@
+//
+// Created on 2026/10/16.
+//
+// 主机侧工具：对每种投影网格模拟顶点后变换缓存，输出索引优化前后的 ACMR / ATVR 和索引数，
+// 按角度分块后几个典型视角下被视锥剔除的三角形比例和绘制调用数，
+// 以及网格插值的纹理坐标相对射线投射（逐像素解析映射）的采样误差和顶点着色次数
+// 不测GPU耗时：射线投射省掉的顶点工作和多出的逐像素运算哪个更重取决于设备，只能在设备上对比 getFrameStats 的
+// drawFrame / gpuFrame，不在这个工具的范围内
+// 构建：cmake -DMD_BUILD_HOST_TOOLS=ON，运行 md_mesh_bench [cache_size...]
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include <vector>
+#include "vrlib/md_mesh_culling.h"
+#include "vrlib/md_mesh_generator.h"
+#include "vrlib/md_mesh_lod.h"
+#include "vrlib/md_ray_cast_mapping.h"
+#include "vrlib/md_mesh_optimizer.h"
+
+using namespace asha::vrlib;
+
+struct BenchMesh {
+    std::string name;
+    std::function<void(MDMeshData*)> generate;
+    float dome_degree;  // 0 表示球面
+    bool dome_upper;
+};
+
+static void PrintRow(const char* name, const char* layout, const std::vector<short>& indices, int vertex_count,
+                     bool strip, const std::vector<int>& cache_sizes) {
+    printf("%-14s %-16s %8zu", name, layout, indices.size());
+    for (int cache_size : cache_sizes) {
+        MDVertexCacheStats stats = MDMeshOptimizer::AnalyzeVertexCache(indices, vertex_count, strip, cache_size);
+        printf("   %6.3f %6.3f", stats.acmr, stats.atvr);
+    }
+    printf("\n");
+}
+
+// 列主序的 P × R，R 先绕 Y 轴转 yaw、再绕 X 轴转 pitch（度，pitch 为正时视线朝下），相机在原点
+static void BuildViewMatrix(float fov_y, float aspect, float yaw, float pitch, float* matrix) {
+    const float to_radians = static_cast<float>(M_PI) / 180.0f;
+    float f = 1.0f / tanf(fov_y * to_radians / 2.0f);
+    float near_plane = 0.1f;
+    float far_plane = 100.0f;
+    float projection[16] = {f / aspect, 0, 0, 0, 0, f, 0, 0, 0, 0, (far_plane + near_plane) / (near_plane - far_plane), -1,
+                            0, 0, 2 * far_plane * near_plane / (near_plane - far_plane), 0};
+    float cy = cosf(yaw * to_radians), sy = sinf(yaw * to_radians);
+    float cp = cosf(pitch * to_radians), sp = sinf(pitch * to_radians);
+    // R = Rx(pitch) × Ry(yaw)
+    float rotation[16] = {cy, sp * sy, -cp * sy, 0, 0, cp, sp, 0, sy, -sp * cy, cp * cy, 0, 0, 0, 0, 1};
+    for (int col = 0; col < 4; col++) {
+        for (int row = 0; row < 4; row++) {
+            float sum = 0.0f;
+            for (int k = 0; k < 4; k++) {
+                sum += projection[k * 4 + row] * rotation[col * 4 + k];
+            }
+            matrix[col * 4 + row] = sum;
+        }
+    }
+}
+
+static void PrintCulling(const BenchMesh& bench) {
+    struct View {
+        const char* name;
+        float fov_y;
+        float aspect;
+        float yaw;
+        float pitch;
+    };
+    static const View views[] = {
+        {"60@16:9", 60.0f, 16.0f / 9.0f, 30.0f, 0.0f},
+        {"60 down", 60.0f, 16.0f / 9.0f, 0.0f, 80.0f},
+        {"120 eye", 120.0f, 1.0f, 0.0f, 0.0f},
+        {"120 up", 120.0f, 1.0f, 45.0f, -60.0f},
+    };
+    MDMeshData mesh;
+    bench.generate(&mesh);
+    MDMeshCulling::BuildPatches(&mesh, false);
+    int total = static_cast<int>(mesh.indices.size() / 3);
+    printf("%-14s %4zu patches", bench.name.c_str(), mesh.patches.size());
+    std::vector<MDDrawRange> ranges;
+    for (const View& view : views) {
+        float matrix[16];
+        BuildViewMatrix(view.fov_y, view.aspect, view.yaw, view.pitch, matrix);
+        MDFrustum frustum;
+        frustum.SetMatrix(matrix);
+        int visible = MDMeshCulling::CullPatches(mesh, frustum, &ranges);
+        printf("   %-8s %5.1f%% %2zu", view.name, 100.0 * (total - visible) / total, ranges.size());
+    }
+    printf("\n");
+}
+
+// 纹理坐标反推视线方向（MDRayCastMapping 的逆映射）
+static void DirectionFromTexCoord(const BenchMesh& bench, const float* uv, float* direction) {
+    const float pi = static_cast<float>(M_PI);
+    float theta;
+    float phi;
+    float sign = 1.0f;
+    if (bench.dome_degree == 0.0f) {
+        theta = (1.0f - uv[1]) * pi;
+        phi = uv[0] * 2.0f * pi;
+    } else {
+        sign = bench.dome_upper ? 1.0f : -1.0f;
+        float cx = (uv[0] - 0.5f) * 2.0f;
+        float cy = (uv[1] - 0.5f) * 2.0f;
+        theta = sqrtf(cx * cx + cy * cy) * bench.dome_degree / 360.0f * pi;
+        phi = atan2f(cx, cy);
+    }
+    direction[0] = cosf(phi) * sinf(theta) * sign;
+    direction[1] = cosf(theta) * sign;
+    direction[2] = sinf(phi) * sinf(theta);
+}
+
+static float AngleBetween(const float* a, const float* b) {
+    float cross[3] = {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0]};
+    float sin_part = sqrtf(cross[0] * cross[0] + cross[1] * cross[1] + cross[2] * cross[2]);
+    return atan2f(sin_part, a[0] * b[0] + a[1] * b[1] + a[2] * b[2]);
+}
+
+// 网格路径：GPU 在三角形平面上按重心坐标插值纹理坐标，像素实际看向的是该点的方向；
+// 射线投射对这个方向解析求纹理坐标。误差为两者在球面上对应方向的夹角（角分），
+// 以及折算成 3840 宽的等距柱状视频上的纹素数
+static void PrintRayCastComparison(const BenchMesh& bench) {
+    MDMeshData mesh;
+    bench.generate(&mesh);
+    int vertex_count = static_cast<int>(mesh.vertices.size() / 3);
+    MDMeshCulling::BuildPatches(&mesh, false);
+    MDVertexCacheStats cache = MDMeshOptimizer::AnalyzeVertexCache(mesh.indices, vertex_count, false);
+    int triangles = static_cast<int>(mesh.indices.size() / 3);
+
+    const int samples = 200000;
+    double error_sum = 0.0;
+    float error_max = 0.0f;
+    unsigned int seed = 12345;
+    auto random01 = [&seed]() {
+        seed = seed * 1664525u + 1013904223u;
+        return (seed >> 8) / 16777216.0f;
+    };
+    for (int i = 0; i < samples; i++) {
+        int t = static_cast<int>(random01() * triangles) % triangles;
+        float b1 = random01();
+        float b2 = random01();
+        if (b1 + b2 > 1.0f) {
+            b1 = 1.0f - b1;
+            b2 = 1.0f - b2;
+        }
+        float weights[3] = {1.0f - b1 - b2, b1, b2};
+        float point[3] = {0.0f, 0.0f, 0.0f};
+        float uv[2] = {0.0f, 0.0f};
+        for (int k = 0; k < 3; k++) {
+            int v = static_cast<uint16_t>(mesh.indices[t * 3 + k]);
+            for (int c = 0; c < 3; c++) {
+                point[c] += weights[k] * mesh.vertices[v * 3 + c];
+            }
+            for (int c = 0; c < 2; c++) {
+                uv[c] += weights[k] * mesh.texcoords[v * 2 + c];
+            }
+        }
+        float sampled[3];
+        DirectionFromTexCoord(bench, uv, sampled);
+        float error = AngleBetween(point, sampled);
+        error_sum += error;
+        error_max = std::max(error_max, error);
+    }
+    const float arcmin = 180.0f / static_cast<float>(M_PI) * 60.0f;
+    const float texels = 3840.0f / 360.0f / 60.0f;
+    float error_mean = static_cast<float>(error_sum / samples);
+    printf("%-14s %8d %8.0f %8d   %7.2f %7.2f   %7.2f %7.2f\n", bench.name.c_str(), triangles,
+           triangles * cache.acmr, 3, error_mean * arcmin, error_max * arcmin, error_mean * arcmin * texels,
+           error_max * arcmin * texels);
+}
+
+int main(int argc, char** argv) {
+    std::vector<int> cache_sizes;
+    for (int i = 1; i < argc; i++) {
+        cache_sizes.push_back(atoi(argv[i]));
+    }
+    if (cache_sizes.empty()) {
+        cache_sizes = {16, 32};
+    }
+    // 球面和穹顶按每个细分级别各测一次，名称后缀为级别
+    std::vector<BenchMesh> meshes;
+    for (int level = 0; level < MD_MESH_LOD_COUNT; level++) {
+        MDMeshLodParams lod = MDMeshLod::GetParams(level);
+        std::string suffix = "@" + std::to_string(level);
+        meshes.push_back({"sphere" + suffix, [lod](MDMeshData* mesh) {
+            MDMeshGenerator::GenerateSphere(mesh, 18.0f, lod.rings, lod.sectors);
+        }, 0.0f, false});
+        meshes.push_back({"dome180" + suffix, [lod](MDMeshData* mesh) {
+            MDMeshGenerator::GenerateDome(mesh, 18.0f, lod.sectors, 180.0f, false);
+        }, 180.0f, false});
+        meshes.push_back({"dome230" + suffix, [lod](MDMeshData* mesh) {
+            MDMeshGenerator::GenerateDome(mesh, 18.0f, lod.sectors, 230.0f, false);
+        }, 230.0f, false});
+    }
+    meshes.push_back({"cube", [](MDMeshData* mesh) { MDMeshGenerator::GenerateCube(mesh, 18.0f); }, -1.0f, false});
+
+    printf("%-14s %-16s %8s", "mesh", "layout", "indices");
+    for (int cache_size : cache_sizes) {
+        printf("   acmr%-3d atvr%-3d", cache_size, cache_size);
+    }
+    printf("\n");
+    for (const BenchMesh& bench : meshes) {
+        MDMeshData mesh;
+        bench.generate(&mesh);
+        int vertex_count = static_cast<int>(mesh.vertices.size() / 3);
+        PrintRow(bench.name.c_str(), "list", mesh.indices, vertex_count, false, cache_sizes);
+        std::vector<short> strip = MDMeshOptimizer::ConvertToStrips(mesh.indices);
+        PrintRow(bench.name.c_str(), "strip", strip, vertex_count, true, cache_sizes);
+        std::vector<short> optimized = mesh.indices;
+        MDMeshOptimizer::OptimizeVertexCache(&optimized, vertex_count);
+        PrintRow(bench.name.c_str(), "list+forsyth", optimized, vertex_count, false, cache_sizes);
+        std::vector<short> optimized_strip = MDMeshOptimizer::ConvertToStrips(optimized);
+        PrintRow(bench.name.c_str(), "strip+forsyth", optimized_strip, vertex_count, true, cache_sizes);
+        MDMeshData patched = mesh;
+        MDMeshCulling::BuildPatches(&patched, false);
+        PrintRow(bench.name.c_str(), "patches", patched.indices, vertex_count, false, cache_sizes);
+        patched = mesh;
+        MDMeshCulling::BuildPatches(&patched, true);
+        PrintRow(bench.name.c_str(), "patches+strip", patched.indices, vertex_count, true, cache_sizes);
+    }
+
+    // 每个视角：被剔除的三角形比例、合并后的绘制调用数
+    printf("\n");
+    for (const BenchMesh& bench : meshes) {
+        PrintCulling(bench);
+    }
+
+    // 网格与射线投射：三角形数、顶点着色次数（整个网格按 ACMR 估计 / 射线投射固定3个），
+    // 网格插值相对逐像素解析映射的平均/最大误差（角分、3840 宽视频上的纹素）；立方体不支持射线投射
+    printf("\n%-14s %8s %8s %8s   %7s %7s   %7s %7s\n", "mesh", "tris", "vs mesh", "vs ray", "avg'", "max'",
+           "avg px", "max px");
+    for (const BenchMesh& bench : meshes) {
+        if (bench.dome_degree >= 0.0f) {
+            PrintRayCastComparison(bench);
+        }
+    }
+    return 0;
+}
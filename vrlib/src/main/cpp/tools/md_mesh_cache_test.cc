@@ -0,0 +1,213 @@
+//
+// Created on 2026/10/16.
+//
+// 主机侧测试：在 GL 桩上检查 MDMeshCache 每个网格只生成一次、每个 (上下文, 网格) 只上传一次，
+// 还有人使用的缓冲不会被释放，没人使用后 ReleaseUnusedBuffers 把缓冲和 VAO 全部删除，
+// 以及换了参数的网格（立方体排列）上传新缓冲时删除旧参数的闲置缓冲，丢掉还在生成的网格不会阻塞
+// 运行 md_mesh_cache_test，全部通过时返回 0
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+#include "gl_stub/md_gl_stub.h"
+#include "vrlib/md_mesh_cache.h"
+#include "vrlib/md_object_3d.h"
+#include "md_test_util.h"
+
+using namespace asha::vrlib;
+
+static const EGLContext CONTEXT_A = reinterpret_cast<EGLContext>(1);
+static const EGLContext CONTEXT_B = reinterpret_cast<EGLContext>(2);
+
+static void WaitForMesh(MDObject3D* object) {
+    while (object->IsLoading()) {
+        object->PollPendingMesh();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+// 多个线程同时请求同一个网格，生成函数只调用一次，所有人拿到同一份数据
+MD_TEST(TestSingleGeneration) {
+    MDMeshCache& cache = MDMeshCache::GetInstance();
+    MDMeshCacheStats before = cache.GetStats();
+    std::atomic<int> generations{0};
+    MDMeshKey key;
+    key.type = 9001;
+    key.rings = 8;
+    key.sectors = 16;
+
+    const int thread_count = 8;
+    std::vector<std::shared_ptr<const MDMeshData>> meshes(thread_count);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < thread_count; i++) {
+        threads.emplace_back([&, i]() {
+            MDMeshCache::MeshFuture future = cache.AcquireMesh(key, [&generations](MDMeshData* mesh) {
+                generations.fetch_add(1);
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                MDMeshGenerator::GenerateSphere(mesh, 1.0f, 8, 16);
+            });
+            meshes[i] = future.get();
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    MDMeshCacheStats after = cache.GetStats();
+    EXPECT_EQ(1, generations.load());
+    EXPECT_EQ(1, after.mesh_misses - before.mesh_misses);
+    EXPECT_EQ(thread_count - 1, after.mesh_hits - before.mesh_hits);
+    for (int i = 1; i < thread_count; i++) {
+        EXPECT_EQ(true, meshes[i] == meshes[0]);
+    }
+}
+
+// 两个渲染器用同一个投影：一次生成、一次上传，缓冲在两者都放手之后才删除
+MD_TEST(TestSharedUploadAndRelease) {
+    MDMeshCache& cache = MDMeshCache::GetInstance();
+    MDGLStub::SetCurrentContext(CONTEXT_A);
+    MDMeshCacheStats before = cache.GetStats();
+    MDGLStub::ResetCalls();
+
+    MDObject3D first;
+    MDObject3D second;
+    first.LoadSphere();
+    WaitForMesh(&first);
+    second.LoadSphere();
+    WaitForMesh(&second);
+    first.UploadData();
+    second.UploadData();
+
+    MDMeshCacheStats after = cache.GetStats();
+    EXPECT_EQ(1, after.mesh_misses - before.mesh_misses);
+    EXPECT_EQ(1, after.mesh_hits - before.mesh_hits);
+    EXPECT_EQ(1, after.buffer_uploads - before.buffer_uploads);
+    EXPECT_EQ(1, after.buffer_hits - before.buffer_hits);
+    EXPECT_EQ(1, MDGLStub::Calls("glGenVertexArrays"));
+    EXPECT_EQ(2, MDGLStub::Calls("glGenBuffers"));
+    EXPECT_EQ(2, MDGLStub::Calls("glBufferData"));
+    EXPECT_EQ(2, MDGLStub::LiveBuffers());
+    EXPECT_EQ(1, MDGLStub::LiveVertexArrays());
+
+    // 每帧绘制不再上传
+    MDGLStub::ResetCalls();
+    first.Draw();
+    second.Draw();
+    EXPECT_EQ(0, MDGLStub::Calls("glBufferData"));
+
+    // 还有人在用时不释放
+    first.Destroy();
+    cache.ReleaseUnusedBuffers();
+    EXPECT_EQ(2, MDGLStub::LiveBuffers());
+    EXPECT_EQ(1, MDGLStub::LiveVertexArrays());
+
+    second.Destroy();
+    cache.ReleaseUnusedBuffers();
+    EXPECT_EQ(0, MDGLStub::LiveBuffers());
+    EXPECT_EQ(0, MDGLStub::LiveVertexArrays());
+    EXPECT_EQ(1, MDGLStub::Calls("glDeleteVertexArrays"));
+    EXPECT_EQ(2, MDGLStub::Calls("glDeleteBuffers"));
+
+    // 释放后再用：网格数据还在缓存里，不重新生成，只重新上传
+    before = cache.GetStats();
+    first.UploadData();
+    after = cache.GetStats();
+    EXPECT_EQ(0, after.mesh_misses - before.mesh_misses);
+    EXPECT_EQ(1, after.buffer_uploads - before.buffer_uploads);
+    first.Destroy();
+    cache.ReleaseUnusedBuffers();
+    EXPECT_EQ(0, MDGLStub::LiveBuffers());
+}
+
+// 每个上下文各自上传一次，释放只影响当前上下文
+MD_TEST(TestPerContextBuffers) {
+    MDMeshCache& cache = MDMeshCache::GetInstance();
+    MDObject3D object_a;
+    MDObject3D object_b;
+
+    MDGLStub::SetCurrentContext(CONTEXT_A);
+    object_a.LoadDome(180.0f, false);
+    WaitForMesh(&object_a);
+    MDMeshCacheStats before = cache.GetStats();
+    object_a.UploadData();
+
+    MDGLStub::SetCurrentContext(CONTEXT_B);
+    object_b.LoadDome(180.0f, false);
+    WaitForMesh(&object_b);
+    object_b.UploadData();
+    MDMeshCacheStats after = cache.GetStats();
+    EXPECT_EQ(2, after.buffer_uploads - before.buffer_uploads);
+    EXPECT_EQ(2, MDGLStub::LiveBuffers());
+
+    object_b.Destroy();
+    cache.ReleaseUnusedBuffers();
+    EXPECT_EQ(0, MDGLStub::LiveBuffers());
+    MDGLStub::SetCurrentContext(CONTEXT_A);
+    EXPECT_EQ(2, MDGLStub::LiveBuffers());
+
+    object_a.Destroy();
+    cache.ReleaseUnusedBuffers();
+    EXPECT_EQ(0, MDGLStub::LiveBuffers());
+    EXPECT_EQ(0, MDGLStub::LiveVertexArrays());
+}
+
+// 立方体换排列后生成新网格，上传新缓冲时删除旧排列的闲置缓冲，不需要等 ReleaseUnusedBuffers
+MD_TEST(TestParamsReplacement) {
+    MDMeshCache& cache = MDMeshCache::GetInstance();
+    MDGLStub::SetCurrentContext(CONTEXT_A);
+    MDObject3D object;
+    object.LoadCube();
+    WaitForMesh(&object);
+    object.UploadData();
+    EXPECT_EQ(2, MDGLStub::LiveBuffers());
+
+    MDMeshCacheStats before = cache.GetStats();
+    object.SetCubeLayout(MD_CUBE_LAYOUT_6X1, 0.0f);
+    WaitForMesh(&object);
+    object.UploadData();
+    MDMeshCacheStats after = cache.GetStats();
+    EXPECT_EQ(1, after.mesh_misses - before.mesh_misses);
+    EXPECT_EQ(1, after.buffer_uploads - before.buffer_uploads);
+    EXPECT_EQ(2, MDGLStub::LiveBuffers());
+    EXPECT_EQ(1, MDGLStub::LiveVertexArrays());
+
+    object.Destroy();
+    cache.ReleaseUnusedBuffers();
+    EXPECT_EQ(0, MDGLStub::LiveBuffers());
+}
+
+// 带参数的网格还在生成时换参数：缓存丢掉旧 future，渲染器也丢掉自己的，两者都不能等旧网格生成完
+static std::atomic<int> g_slow_generations_done{0};
+
+MD_TEST(TestDroppingPendingMeshDoesNotBlock) {
+    MDMeshCache& cache = MDMeshCache::GetInstance();
+    MDMeshKey old_key;
+    old_key.type = 9002;
+    old_key.params = {1.0f};
+    MDMeshKey new_key = old_key;
+    new_key.params = {2.0f};
+    auto slow_generate = [](MDMeshData* mesh) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));
+        MDMeshGenerator::GenerateSphere(mesh, 1.0f, 4, 8);
+        g_slow_generations_done.fetch_add(1);
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    MDMeshCache::MeshFuture pending = cache.AcquireMesh(old_key, slow_generate);
+    // 换参数：缓存里旧参数的 future 被丢掉，这里 pending 是最后一个引用
+    MDMeshCache::MeshFuture replacement = cache.AcquireMesh(new_key, slow_generate);
+    pending = replacement;
+    auto elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start).count();
+    EXPECT_EQ(true, elapsed_ms < 100);
+    EXPECT_EQ(0, g_slow_generations_done.load());
+
+    // 新参数的网格照常生成
+    EXPECT_EQ(true, pending.get() != nullptr);
+    while (g_slow_generations_done.load() < 2) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+MD_TEST_MAIN("md_mesh_cache_test")
@@ -0,0 +1,215 @@
+//
+// Created on 2026/10/16.
+//
+// 主机侧工具：每种投影网格的生成耗时，查表生成（MDMeshGenerator）对比逐顶点调用三角函数的原实现，
+// 以及工作线程里生成后分块、重排索引（MDMeshCulling::BuildPatches）的耗时和两种实现的最大差异
+// 构建：cmake -S vrlib/src/main/cpp/tools -B build-tools，运行 md_mesh_gen_bench [iterations]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include <vector>
+#include "vrlib/md_mesh_culling.h"
+#include "vrlib/md_mesh_generator.h"
+#include "vrlib/md_mesh_lod.h"
+
+using namespace asha::vrlib;
+
+// 原实现：每个顶点单独计算 sin / cos（穹顶的纹理坐标再算两次）
+static void ReferenceSphere(MDMeshData* mesh, float radius, int rings, int sectors) {
+    const float PI = 3.14159265358979323846f;
+    const float PI_2 = PI / 2.0f;
+    float R = 1.0f / (float)rings;
+    float S = 1.0f / (float)sectors;
+    int numPoint = (rings + 1) * (sectors + 1);
+    mesh->vertices.resize(numPoint * 3);
+    mesh->texcoords.resize(numPoint * 2);
+    mesh->indices.resize(rings * sectors * 6);
+
+    int t = 0, v = 0;
+    for (int r = 0; r < rings + 1; r++) {
+        for (int s = 0; s < sectors + 1; s++) {
+            float x = (float)(cos(2 * PI * s * S) * sin(PI * r * R));
+            float y = -(float)sin(-PI_2 + PI * r * R);
+            float z = (float)(sin(2 * PI * s * S) * sin(PI * r * R));
+            mesh->texcoords[t++] = s * S;
+            mesh->texcoords[t++] = 1 - r * R;
+            mesh->vertices[v++] = x * radius;
+            mesh->vertices[v++] = y * radius;
+            mesh->vertices[v++] = z * radius;
+        }
+    }
+    int counter = 0;
+    int sectorsPlusOne = sectors + 1;
+    for (int r = 0; r < rings; r++) {
+        for (int s = 0; s < sectors; s++) {
+            mesh->indices[counter++] = (short)(r * sectorsPlusOne + s);
+            mesh->indices[counter++] = (short)((r + 1) * sectorsPlusOne + s);
+            mesh->indices[counter++] = (short)(r * sectorsPlusOne + (s + 1));
+            mesh->indices[counter++] = (short)(r * sectorsPlusOne + (s + 1));
+            mesh->indices[counter++] = (short)((r + 1) * sectorsPlusOne + s);
+            mesh->indices[counter++] = (short)((r + 1) * sectorsPlusOne + (s + 1));
+        }
+    }
+}
+
+static void ReferenceDome(MDMeshData* mesh, float radius, int sectors, float degreeY, bool isUpper) {
+    const float PI = 3.14159265358979323846f;
+    const float PI_2 = PI / 2.0f;
+    float percent = degreeY / 360.0f;
+    int rings = sectors >> 1;
+    float R = 1.0f / (float)rings;
+    float S = 1.0f / (float)sectors;
+    int lenRings = (int)(rings * percent) + 1;
+    int lenSectors = sectors + 1;
+    int numPoint = lenRings * lenSectors;
+    mesh->vertices.resize(numPoint * 3);
+    mesh->texcoords.resize(numPoint * 2);
+    mesh->indices.resize((lenRings - 1) * (lenSectors - 1) * 6);
+    int upper = isUpper ? 1 : -1;
+
+    int t = 0, v = 0;
+    for (int r = 0; r < lenRings; r++) {
+        for (int s = 0; s < lenSectors; s++) {
+            float x = (float)(cos(2 * PI * s * S) * sin(PI * r * R)) * upper;
+            float y = (float)sin(-PI_2 + PI * r * R) * -upper;
+            float z = (float)(sin(2 * PI * s * S) * sin(PI * r * R));
+            float a = (float)(cos(2 * PI * s * S) * r * R / percent) / 2.0f + 0.5f;
+            float b = (float)(sin(2 * PI * s * S) * r * R / percent) / 2.0f + 0.5f;
+            mesh->texcoords[t++] = b;
+            mesh->texcoords[t++] = a;
+            mesh->vertices[v++] = x * radius;
+            mesh->vertices[v++] = y * radius;
+            mesh->vertices[v++] = z * radius;
+        }
+    }
+    int counter = 0;
+    for (int r = 0; r < lenRings - 1; r++) {
+        for (int s = 0; s < lenSectors - 1; s++) {
+            mesh->indices[counter++] = (short)(r * lenSectors + s);
+            mesh->indices[counter++] = (short)((r + 1) * lenSectors + s);
+            mesh->indices[counter++] = (short)(r * lenSectors + (s + 1));
+            mesh->indices[counter++] = (short)(r * lenSectors + (s + 1));
+            mesh->indices[counter++] = (short)((r + 1) * lenSectors + s);
+            mesh->indices[counter++] = (short)((r + 1) * lenSectors + (s + 1));
+        }
+    }
+}
+
+struct GenBench {
+    std::string name;
+    std::function<void(MDMeshData*)> generate;
+    std::function<void(MDMeshData*)> reference;  // 为空表示没有对照实现（立方体、双鱼眼）
+};
+
+// 多次运行取中位数（毫秒）
+static double MedianMs(const std::function<void()>& run, int iterations) {
+    std::vector<double> samples;
+    samples.reserve(iterations);
+    for (int i = 0; i < iterations; i++) {
+        auto start = std::chrono::steady_clock::now();
+        run();
+        samples.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+    }
+    std::sort(samples.begin(), samples.end());
+    return samples[samples.size() / 2];
+}
+
+static float MaxDifference(const std::vector<float>& a, const std::vector<float>& b) {
+    if (a.size() != b.size()) {
+        return INFINITY;
+    }
+    float result = 0.0f;
+    for (size_t i = 0; i < a.size(); i++) {
+        result = std::max(result, fabsf(a[i] - b[i]));
+    }
+    return result;
+}
+
+static void PrintBench(const GenBench& bench, int iterations) {
+    MDMeshData mesh;
+    bench.generate(&mesh);
+    double table_ms = MedianMs([&bench]() {
+        MDMeshData generated;
+        bench.generate(&generated);
+    }, iterations);
+    // 工作线程里的全部工作：生成后分块并按顶点缓存重排
+    double patch_ms = MedianMs([&mesh]() {
+        MDMeshData patched = mesh;
+        MDMeshCulling::BuildPatches(&patched, false);
+    }, iterations);
+    printf("%-18s %8zu", bench.name.c_str(), mesh.vertices.size() / 3);
+    if (bench.reference) {
+        MDMeshData reference;
+        bench.reference(&reference);
+        double reference_ms = MedianMs([&bench]() {
+            MDMeshData generated;
+            bench.reference(&generated);
+        }, iterations);
+        printf("   %8.3f %8.3f %7.1fx", reference_ms, table_ms, reference_ms / std::max(table_ms, 1e-6));
+        printf("   %8.3f", patch_ms);
+        printf("   %9.2e %9.2e %s\n", MaxDifference(mesh.vertices, reference.vertices),
+               MaxDifference(mesh.texcoords, reference.texcoords),
+               mesh.indices == reference.indices ? "same" : "DIFF");
+    } else {
+        printf("   %8s %8.3f %8s   %8.3f\n", "-", table_ms, "-", patch_ms);
+    }
+}
+
+int main(int argc, char** argv) {
+    int iterations = argc > 1 ? std::max(1, atoi(argv[1])) : 50;
+    // 每种投影按每个细分级别各测一次，名称后缀为级别
+    std::vector<GenBench> benches;
+    for (int level = 0; level < MD_MESH_LOD_COUNT; level++) {
+        MDMeshLodParams lod = MDMeshLod::GetParams(level);
+        std::string suffix = "@" + std::to_string(level);
+        benches.push_back({"sphere" + suffix, [lod](MDMeshData* mesh) {
+            MDMeshGenerator::GenerateSphere(mesh, 18.0f, lod.rings, lod.sectors);
+        }, [lod](MDMeshData* mesh) {
+            ReferenceSphere(mesh, 18.0f, lod.rings, lod.sectors);
+        }});
+        const struct {
+            const char* name;
+            float degree;
+            bool upper;
+        } domes[] = {
+            {"dome180", 180.0f, false},
+            {"dome230", 230.0f, false},
+            {"dome180_upper", 180.0f, true},
+            {"dome230_upper", 230.0f, true},
+        };
+        for (const auto& dome : domes) {
+            float degree = dome.degree;
+            bool upper = dome.upper;
+            benches.push_back({dome.name + suffix, [lod, degree, upper](MDMeshData* mesh) {
+                MDMeshGenerator::GenerateDome(mesh, 18.0f, lod.sectors, degree, upper);
+            }, [lod, degree, upper](MDMeshData* mesh) {
+                ReferenceDome(mesh, 18.0f, lod.sectors, degree, upper);
+            }});
+        }
+        // 双鱼眼没有对照实现：生成两组纹理坐标和混合权重，比球面多接缝带两端的两个环
+        benches.push_back({"dual_fisheye" + suffix, [lod](MDMeshData* mesh) {
+            MDFisheyeLens lenses[MDDualFisheye::LENS_COUNT] = {MDDualFisheye::DefaultLens(false, 0),
+                                                               MDDualFisheye::DefaultLens(false, 1)};
+            MDMeshGenerator::GenerateDualFisheye(mesh, 18.0f, lod.rings, lod.sectors, lenses);
+        }, nullptr});
+    }
+    benches.push_back({"cube", [](MDMeshData* mesh) { MDMeshGenerator::GenerateCube(mesh, 18.0f); }, nullptr});
+    benches.push_back({"cube_eac", [](MDMeshData* mesh) {
+        MDMeshGenerator::GenerateCube(mesh, 18.0f, MD_CUBE_LAYOUT_EAC, 0.01f);
+    }, nullptr});
+    benches.push_back({"plane_curved", [](MDMeshData* mesh) { MDMeshGenerator::GeneratePlane(mesh, 100.0f, 40); },
+                       nullptr});
+
+    // 耗时为中位数（毫秒）；差异为与原实现相比位置 / 纹理坐标的最大绝对误差（半径18）
+    printf("%-18s %8s   %8s %8s %8s   %8s   %9s %9s %s\n", "mesh", "verts", "ref ms", "table ms", "speedup",
+           "patch ms", "max dpos", "max duv", "indices");
+    for (const GenBench& bench : benches) {
+        PrintBench(bench, iterations);
+    }
+    return 0;
+}
@@ -0,0 +1,234 @@
+//
+// Created on 2026/10/16.
+//
+// 主机侧工具：回放陀螺仪数据，把积分得到的姿态按采样时间投递给 MDPoseMailbox，
+// 模拟GL线程按帧率 Latch 并用 MDPosePredictor 外推到 “当前帧 + 预测时长”，
+// 与该时刻的真实姿态比较，输出各预测时长下不预测（直接用最新姿态）和预测后的角度误差
+// 数据格式：每行 timestamp_ns,wx,wy,wz（设备坐标系角速度 rad/s），# 开头为注释
+// 运行 md_pose_replay [trace.csv] [frame_hz]，默认（或传空路径）回放 data/gyro_head_motion.csv、60Hz
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include "vrlib/md_pose_mailbox.h"
+#include "vrlib/md_pose_predictor.h"
+
+using namespace asha::vrlib;
+
+#ifndef MD_TOOLS_DATA_DIR
+#define MD_TOOLS_DATA_DIR "data"
+#endif
+
+struct GyroSample {
+    int64_t timestamp_ns;
+    double w[3];
+};
+
+// 真实姿态：逐个采样积分出的旋转矩阵（行主序 3x3，设备坐标到世界坐标）
+struct TruePose {
+    int64_t timestamp_ns;
+    double r[9];
+};
+
+static bool LoadTrace(const char* path, std::vector<GyroSample>* samples) {
+    FILE* file = fopen(path, "r");
+    if (file == nullptr) {
+        return false;
+    }
+    char line[256];
+    while (fgets(line, sizeof(line), file) != nullptr) {
+        if (line[0] == '#' || line[0] == '\n') {
+            continue;
+        }
+        GyroSample sample;
+        long long timestamp = 0;
+        if (sscanf(line, "%lld,%lf,%lf,%lf", &timestamp, &sample.w[0], &sample.w[1], &sample.w[2]) == 4) {
+            sample.timestamp_ns = timestamp;
+            samples->push_back(sample);
+        }
+    }
+    fclose(file);
+    return !samples->empty();
+}
+
+// 绕单位轴旋转 angle 的矩阵（Rodrigues）
+static void AxisAngle(const double* w, double dt, double* out) {
+    double speed = std::sqrt(w[0] * w[0] + w[1] * w[1] + w[2] * w[2]);
+    double angle = speed * dt;
+    if (angle < 1e-12) {
+        const double identity[9] = {1, 0, 0, 0, 1, 0, 0, 0, 1};
+        std::copy(identity, identity + 9, out);
+        return;
+    }
+    double x = w[0] / speed;
+    double y = w[1] / speed;
+    double z = w[2] / speed;
+    double s = std::sin(angle);
+    double c = 1.0 - std::cos(angle);
+    const double r[9] = {
+        1.0 - c * (y * y + z * z), -s * z + c * x * y, s * y + c * x * z,
+        s * z + c * x * y, 1.0 - c * (x * x + z * z), -s * x + c * y * z,
+        -s * y + c * x * z, s * x + c * y * z, 1.0 - c * (x * x + y * y),
+    };
+    std::copy(r, r + 9, out);
+}
+
+static void Multiply3(const double* a, const double* b, double* out) {
+    double result[9];
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            result[i * 3 + j] = a[i * 3 + 0] * b[0 * 3 + j] + a[i * 3 + 1] * b[1 * 3 + j] + a[i * 3 + 2] * b[2 * 3 + j];
+        }
+    }
+    std::copy(result, result + 9, out);
+}
+
+// 设备坐标系角速度：R(t + dt) = R(t) * exp(w * dt)，采样 k 的角速度作用于 (t[k-1], t[k]]
+static std::vector<TruePose> Integrate(const std::vector<GyroSample>& samples) {
+    std::vector<TruePose> poses(samples.size());
+    const double identity[9] = {1, 0, 0, 0, 1, 0, 0, 0, 1};
+    poses[0].timestamp_ns = samples[0].timestamp_ns;
+    std::copy(identity, identity + 9, poses[0].r);
+    for (size_t k = 1; k < samples.size(); k++) {
+        double step[9];
+        AxisAngle(samples[k].w, (samples[k].timestamp_ns - samples[k - 1].timestamp_ns) / 1e9, step);
+        poses[k].timestamp_ns = samples[k].timestamp_ns;
+        Multiply3(poses[k - 1].r, step, poses[k].r);
+    }
+    return poses;
+}
+
+// 任意时刻的真实姿态：从它之前的最后一个采样按下一个采样的角速度继续积分
+static void TruePoseAt(const std::vector<GyroSample>& samples, const std::vector<TruePose>& poses,
+                       int64_t t_ns, double* out) {
+    auto it = std::upper_bound(poses.begin(), poses.end(), t_ns,
+                               [](int64_t t, const TruePose& pose) { return t < pose.timestamp_ns; });
+    size_t k = it == poses.begin() ? 0 : (it - poses.begin()) - 1;
+    if (k + 1 >= samples.size()) {
+        std::copy(poses[k].r, poses[k].r + 9, out);
+        return;
+    }
+    double step[9];
+    AxisAngle(samples[k + 1].w, (t_ns - poses[k].timestamp_ns) / 1e9, step);
+    Multiply3(poses[k].r, step, out);
+}
+
+static void ToMatrix4(const double* r, float* m) {
+    const float identity[16] = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1};
+    std::copy(identity, identity + 16, m);
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            m[i * 4 + j] = (float)r[i * 3 + j];
+        }
+    }
+}
+
+// 两个姿态之间的夹角（度）：trace(A * B^T) = 1 + 2cos(angle)
+static double AngleErrorDegrees(const float* m, const double* r) {
+    double trace = 0.0;
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            trace += m[i * 4 + j] * r[i * 3 + j];
+        }
+    }
+    double cos_angle = std::max(-1.0, std::min(1.0, (trace - 1.0) * 0.5));
+    return std::acos(cos_angle) * 180.0 / M_PI;
+}
+
+struct ErrorStats {
+    std::vector<double> all;
+    std::vector<double> moving;  // 真实角速度超过 MOVING_SPEED 的帧
+
+    void Add(double error, bool is_moving) {
+        all.push_back(error);
+        if (is_moving) {
+            moving.push_back(error);
+        }
+    }
+};
+
+static double Mean(const std::vector<double>& values) {
+    double sum = 0.0;
+    for (double value : values) {
+        sum += value;
+    }
+    return values.empty() ? 0.0 : sum / values.size();
+}
+
+static double Percentile(std::vector<double> values, int percent) {
+    if (values.empty()) {
+        return 0.0;
+    }
+    std::sort(values.begin(), values.end());
+    return values[std::min(values.size() - 1, values.size() * percent / 100)];
+}
+
+// 超过这个角速度（约 20 度/秒）的帧计入 “运动中” 统计
+static const double MOVING_SPEED = 0.35;
+
+int main(int argc, char** argv) {
+    std::string path = std::string(MD_TOOLS_DATA_DIR) + "/gyro_head_motion.csv";
+    if (argc > 1 && argv[1][0] != '\0') {
+        path = argv[1];
+    }
+    double frame_hz = argc > 2 ? atof(argv[2]) : 60.0;
+    if (frame_hz <= 0) {
+        frame_hz = 60.0;
+    }
+    std::vector<GyroSample> samples;
+    if (!LoadTrace(path.c_str(), &samples)) {
+        fprintf(stderr, "md_pose_replay: failed to load %s\n", path.c_str());
+        return 1;
+    }
+    std::vector<TruePose> poses = Integrate(samples);
+    int64_t frame_period_ns = (int64_t)(1e9 / frame_hz);
+    int64_t start_ns = samples.front().timestamp_ns;
+    int64_t end_ns = samples.back().timestamp_ns - MD_MAX_PREDICTION_HORIZON_NS;
+
+    printf("trace %s: %zu samples, %.1f s, frames @ %.0f Hz, error in degrees\n", path.c_str(), samples.size(),
+           (samples.back().timestamp_ns - start_ns) / 1e9, frame_hz);
+    printf("%-10s | %-28s | %-28s | %-28s\n", "", "hold (no prediction)", "predicted", "moving frames mean");
+    printf("%-10s | %8s %8s %8s | %8s %8s %8s | %8s %8s %8s\n", "horizon_ms", "mean", "p95", "max", "mean", "p95",
+           "max", "hold", "pred", "gain");
+
+    const double horizons_ms[] = {0.0, 8.3, 16.7, 25.0, 33.3, 50.0};
+    for (double horizon_ms : horizons_ms) {
+        int64_t horizon_ns = (int64_t)(horizon_ms * 1e6);
+        MDPoseMailbox mailbox;
+        ErrorStats hold;
+        ErrorStats predicted;
+        size_t next_sample = 0;
+        for (int64_t frame_ns = start_ns + frame_period_ns; frame_ns < end_ns; frame_ns += frame_period_ns) {
+            // 传感器线程：投递这一帧之前到达的所有采样
+            while (next_sample < samples.size() && samples[next_sample].timestamp_ns <= frame_ns) {
+                float matrix[16];
+                ToMatrix4(poses[next_sample].r, matrix);
+                mailbox.Publish(matrix, poses[next_sample].timestamp_ns);
+                next_sample++;
+            }
+            // GL线程：取最新姿态，外推到预计上屏时间
+            MDPose pose = mailbox.Latch();
+            int64_t target_ns = frame_ns + horizon_ns;
+            double truth[9];
+            TruePoseAt(samples, poses, target_ns, truth);
+            float predicted_matrix[16];
+            MDPosePredictor::Predict(pose, target_ns, MD_MAX_PREDICTION_HORIZON_NS, predicted_matrix);
+
+            const double* w = samples[std::min(next_sample, samples.size() - 1)].w;
+            bool is_moving = std::sqrt(w[0] * w[0] + w[1] * w[1] + w[2] * w[2]) > MOVING_SPEED;
+            hold.Add(AngleErrorDegrees(pose.matrix, truth), is_moving);
+            predicted.Add(AngleErrorDegrees(predicted_matrix, truth), is_moving);
+        }
+        double hold_moving = Mean(hold.moving);
+        double predicted_moving = Mean(predicted.moving);
+        printf("%10.1f | %8.3f %8.3f %8.3f | %8.3f %8.3f %8.3f | %8.3f %8.3f %7.0f%%\n", horizon_ms,
+               Mean(hold.all), Percentile(hold.all, 95), Percentile(hold.all, 100),
+               Mean(predicted.all), Percentile(predicted.all, 95), Percentile(predicted.all, 100),
+               hold_moving, predicted_moving,
+               hold_moving > 0.0 ? (1.0 - predicted_moving / hold_moving) * 100.0 : 0.0);
+    }
+    return 0;
+}
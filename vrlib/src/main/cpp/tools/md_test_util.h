@@ -0,0 +1,91 @@
+//
+// Created on 2026/10/16.
+//
+// 主机侧测试的公共断言和入口：MD_TEST 定义的测试按定义顺序运行，失败的断言打印位置和两边的值后继续，
+// MD_TEST_MAIN 生成 main，有失败时返回 1
+
+#ifndef MD360PLAYER4OH_MD_TEST_UTIL_H
+#define MD360PLAYER4OH_MD_TEST_UTIL_H
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+namespace asha {
+namespace vrlib {
+
+using MDTestFunction = void (*)();
+
+struct MDTestCase {
+    const char* name;
+    MDTestFunction function;
+};
+
+inline std::vector<MDTestCase>& MDTestCases() {
+    static std::vector<MDTestCase> cases;
+    return cases;
+}
+
+inline int& MDTestFailures() {
+    static int failures = 0;
+    return failures;
+}
+
+struct MDTestRegistrar {
+    MDTestRegistrar(const char* name, MDTestFunction function) {
+        MDTestCases().push_back({name, function});
+    }
+};
+
+inline int MDRunTests(const char* program) {
+    for (const MDTestCase& test : MDTestCases()) {
+        int failures_before = MDTestFailures();
+        test.function();
+        if (MDTestFailures() != failures_before) {
+            printf("%s: %s failed\n", program, test.name);
+        }
+    }
+    if (MDTestFailures() > 0) {
+        printf("%s: %d failure(s)\n", program, MDTestFailures());
+        return 1;
+    }
+    printf("%s: all passed\n", program);
+    return 0;
+}
+
+}
+}
+
+#define MD_TEST(name)                                                                       \
+    static void name();                                                                     \
+    static asha::vrlib::MDTestRegistrar name##_registrar(#name, name);                      \
+    static void name()
+
+#define MD_TEST_MAIN(program)                                                               \
+    int main() {                                                                            \
+        return asha::vrlib::MDRunTests(program);                                            \
+    }
+
+#define EXPECT_EQ(expected, actual)                                                                   \
+    do {                                                                                              \
+        long long e_ = (long long)(expected);                                                         \
+        long long a_ = (long long)(actual);                                                           \
+        if (e_ != a_) {                                                                               \
+            printf("FAILED %s:%d: %s == %s (%lld vs %lld)\n", __FILE__, __LINE__, #expected, #actual, \
+                   e_, a_);                                                                           \
+            asha::vrlib::MDTestFailures()++;                                                          \
+        }                                                                                             \
+    } while (0)
+
+#define EXPECT_NEAR(expected, actual, tolerance)                                                      \
+    do {                                                                                              \
+        double e_ = (double)(expected);                                                               \
+        double a_ = (double)(actual);                                                                 \
+        if (!(std::fabs(e_ - a_) <= (double)(tolerance))) {                                           \
+            printf("FAILED %s:%d: %s ~= %s (%g vs %g, tolerance %g)\n", __FILE__, __LINE__, #expected, \
+                   #actual, e_, a_, (double)(tolerance));                                             \
+            asha::vrlib::MDTestFailures()++;                                                          \
+        }                                                                                             \
+    } while (0)
+
+#endif //MD360PLAYER4OH_MD_TEST_UTIL_H
@@ -0,0 +1,227 @@
+//
+// Created on 2026/10/16.
+//
+// 主机侧工具：对比渲染状态的两种发布方式在高频写入下的延迟
+//   mutex  - 原实现：所有状态由一把 mutex_ 保护，GL线程每帧多次加锁读取，
+//            每只眼睛的 MVP 计算（CalculateEyeMVPMatrix）也在锁内完成
+//   triple - MDTripleBuffer：写者串行发布快照，GL线程每帧无锁 Read 一次
+// 两个写者线程（传感器、触摸）各以 1kHz 写入，一个读者线程以 60/120Hz 模拟渲染帧
+// 输出写入延迟和每帧读取状态耗时的 p50 / p99 / max（微秒）
+// 运行 md_triple_buffer_bench [seconds]
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "vrlib/md_triple_buffer.h"
+
+using namespace asha::vrlib;
+using BenchClock = std::chrono::steady_clock;
+
+// 与 md_renderer.cc 中 RenderState 大小相近的状态
+struct BenchState {
+    float clear_color[4] = {0.0f, 0.0f, 0.0f, 1.0f};
+    float mvp_matrix[16] = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1};
+    float sensor_matrix[16] = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1};
+    float touch_delta_x = 0.0f;
+    float touch_delta_y = 0.0f;
+    int viewport[4] = {0, 0, 1920, 1080};
+    int scissor[4] = {0, 0, 0, 0};
+    int projection_mode = 201;
+    uint32_t projection_mode_serial = 0;
+    uint32_t vr_mode_serial = 0;
+    bool flags[8] = {false};
+};
+
+// 原实现每帧加锁的次数：状态快照、投影模式、VR清理、表面尺寸、触摸矩阵、渲染参数
+static const int MUTEX_SECTIONS_PER_FRAME = 6;
+static const int EYE_COUNT = 2;
+
+static void MultiplyMatrix(float* result, const float* a, const float* b) {
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 4; j++) {
+            float sum = 0.0f;
+            for (int k = 0; k < 4; k++) {
+                sum += a[k * 4 + j] * b[i * 4 + k];
+            }
+            result[i * 4 + j] = sum;
+        }
+    }
+}
+
+// 模拟 CalculateEyeMVPMatrix：透视矩阵 + 触摸旋转 + 传感器矩阵
+static void CalculateEyeMVP(const BenchState& state, int eye, float* mvp) {
+    float projection[16] = {0};
+    float f = 1.0f / tanf(60.0f * (float)M_PI / 180.0f);
+    projection[0] = f / (state.viewport[2] * 0.5f / state.viewport[3]);
+    projection[5] = f;
+    projection[10] = -100.1f / 99.9f;
+    projection[11] = -1.0f;
+    projection[14] = -20.0f / 99.9f;
+    float rotation[16] = {0};
+    float c = cosf(state.touch_delta_x + eye * 0.01f);
+    float s = sinf(state.touch_delta_x + eye * 0.01f);
+    rotation[0] = c;
+    rotation[2] = -s;
+    rotation[5] = 1.0f;
+    rotation[8] = s;
+    rotation[10] = c;
+    rotation[15] = 1.0f;
+    float view[16];
+    MultiplyMatrix(view, state.sensor_matrix, rotation);
+    MultiplyMatrix(mvp, projection, view);
+}
+
+// 防止编译器把读到的状态和算出的矩阵优化掉
+static volatile float g_sink = 0.0f;
+
+static int64_t ElapsedNs(BenchClock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(BenchClock::now() - start).count();
+}
+
+struct LatencyStats {
+    double p50_us;
+    double p99_us;
+    double max_us;
+};
+
+static LatencyStats Summarize(std::vector<int64_t>& samples) {
+    LatencyStats stats = {0, 0, 0};
+    if (samples.empty()) {
+        return stats;
+    }
+    std::sort(samples.begin(), samples.end());
+    stats.p50_us = samples[samples.size() / 2] / 1000.0;
+    stats.p99_us = samples[std::min(samples.size() - 1, samples.size() * 99 / 100)] / 1000.0;
+    stats.max_us = samples.back() / 1000.0;
+    return stats;
+}
+
+// 两种发布方式的公共接口：写者修改状态，读者每帧取状态并算出两只眼睛的 MVP
+class MutexPublisher {
+public:
+    template <typename F>
+    void Update(F&& fn) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        fn(state_);
+    }
+
+    void RenderFrame(float* eye_mvp) {
+        BenchState frame;
+        for (int i = 0; i < MUTEX_SECTIONS_PER_FRAME; i++) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            frame = state_;
+        }
+        g_sink = g_sink + frame.touch_delta_y;
+        for (int eye = 0; eye < EYE_COUNT; eye++) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            CalculateEyeMVP(state_, eye, eye_mvp + eye * 16);
+        }
+    }
+
+private:
+    std::mutex mutex_;
+    BenchState state_;
+};
+
+class TriplePublisher {
+public:
+    template <typename F>
+    void Update(F&& fn) {
+        buffer_.Update(fn);
+    }
+
+    void RenderFrame(float* eye_mvp) {
+        const BenchState& frame = buffer_.Read();
+        for (int eye = 0; eye < EYE_COUNT; eye++) {
+            CalculateEyeMVP(frame, eye, eye_mvp + eye * 16);
+        }
+    }
+
+private:
+    MDTripleBuffer<BenchState> buffer_;
+};
+
+template <typename Publisher>
+static void RunBench(const char* name, int reader_hz, double seconds) {
+    Publisher publisher;
+    std::atomic<bool> running{true};
+    std::vector<int64_t> write_samples[2];
+    std::vector<int64_t> read_samples;
+
+    auto writer = [&](int writer_index) {
+        auto period = std::chrono::microseconds(1000);
+        auto next = BenchClock::now();
+        int seq = 0;
+        while (running.load(std::memory_order_relaxed)) {
+            next += period;
+            std::this_thread::sleep_until(next);
+            seq++;
+            auto start = BenchClock::now();
+            if (writer_index == 0) {
+                publisher.Update([seq](BenchState& state) {
+                    float angle = seq * 0.001f;
+                    state.sensor_matrix[0] = cosf(angle);
+                    state.sensor_matrix[2] = sinf(angle);
+                    state.sensor_matrix[8] = -sinf(angle);
+                    state.sensor_matrix[10] = cosf(angle);
+                });
+            } else {
+                publisher.Update([](BenchState& state) {
+                    state.touch_delta_x += 0.001f;
+                    state.touch_delta_y += 0.0005f;
+                });
+            }
+            write_samples[writer_index].push_back(ElapsedNs(start));
+        }
+    };
+
+    std::thread sensor_thread(writer, 0);
+    std::thread touch_thread(writer, 1);
+    auto frame_period = std::chrono::nanoseconds(1000000000LL / reader_hz);
+    auto end = BenchClock::now() + std::chrono::duration_cast<BenchClock::duration>(
+        std::chrono::duration<double>(seconds));
+    auto next = BenchClock::now();
+    float eye_mvp[EYE_COUNT * 16];
+    while (BenchClock::now() < end) {
+        next += frame_period;
+        std::this_thread::sleep_until(next);
+        auto start = BenchClock::now();
+        publisher.RenderFrame(eye_mvp);
+        read_samples.push_back(ElapsedNs(start));
+        g_sink = g_sink + eye_mvp[0] + eye_mvp[16];
+    }
+    running = false;
+    sensor_thread.join();
+    touch_thread.join();
+
+    std::vector<int64_t> all_writes = write_samples[0];
+    all_writes.insert(all_writes.end(), write_samples[1].begin(), write_samples[1].end());
+    LatencyStats write_stats = Summarize(all_writes);
+    LatencyStats read_stats = Summarize(read_samples);
+    printf("%-8s %5d %8zu %8.2f %8.2f %8.2f %7zu %8.2f %8.2f %8.2f\n", name, reader_hz, all_writes.size(),
+           write_stats.p50_us, write_stats.p99_us, write_stats.max_us, read_samples.size(),
+           read_stats.p50_us, read_stats.p99_us, read_stats.max_us);
+}
+
+int main(int argc, char** argv) {
+    double seconds = argc > 1 ? atof(argv[1]) : 3.0;
+    if (seconds <= 0) {
+        seconds = 3.0;
+    }
+    printf("2 writers @ 1kHz, %.1f s per run, latency in us\n", seconds);
+    printf("%-8s %5s %8s %8s %8s %8s %7s %8s %8s %8s\n", "path", "hz", "writes", "w_p50", "w_p99", "w_max",
+           "frames", "r_p50", "r_p99", "r_max");
+    const int reader_rates[] = {60, 120};
+    for (int hz : reader_rates) {
+        RunBench<MutexPublisher>("mutex", hz, seconds);
+        RunBench<TriplePublisher>("triple", hz, seconds);
+    }
+    return 0;
+}
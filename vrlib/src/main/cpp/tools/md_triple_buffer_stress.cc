@@ -0,0 +1,103 @@
+//
+// Created on 2026/10/16.
+//
+// 主机侧压力测试：两个写者不停地通过 MDTripleBuffer 发布状态，一个读者不停地 Read，
+// 检查读到的快照没有被撕裂（各字段属于同一次发布），且每个写者的序号不会倒退，
+// 写者结束后读者能拿到最后一次发布的状态
+// 建议配合 ThreadSanitizer 运行：cmake -DMD_TOOLS_TSAN=ON，运行 md_triple_buffer_stress_tsan
+// 运行 md_triple_buffer_stress [updates_per_writer]，全部通过时返回 0
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include "vrlib/md_triple_buffer.h"
+
+using namespace asha::vrlib;
+
+static const int WRITER_COUNT = 2;
+static const int PAYLOAD_SIZE = 32;
+
+struct StressState {
+    uint64_t seq[WRITER_COUNT] = {0, 0};
+    uint64_t payload[PAYLOAD_SIZE] = {0};
+};
+
+static uint64_t PayloadValue(const StressState& state, int index) {
+    return state.seq[0] * 1000003ULL + state.seq[1] * 31ULL + index;
+}
+
+int main(int argc, char** argv) {
+    uint64_t updates = argc > 1 ? strtoull(argv[1], nullptr, 10) : 200000;
+    if (updates == 0) {
+        updates = 200000;
+    }
+
+    MDTripleBuffer<StressState> buffer;
+    std::atomic<int> writers_done{0};
+    std::thread writers[WRITER_COUNT];
+    for (int w = 0; w < WRITER_COUNT; w++) {
+        writers[w] = std::thread([&buffer, &writers_done, w, updates]() {
+            for (uint64_t i = 1; i <= updates; i++) {
+                buffer.Update([w, i](StressState& state) {
+                    state.seq[w] = i;
+                    for (int k = 0; k < PAYLOAD_SIZE; k++) {
+                        state.payload[k] = PayloadValue(state, k);
+                    }
+                });
+                // 核数少的机器上让出时间片，让读者和另一个写者穿插执行
+                if (i % 16 == 0) {
+                    std::this_thread::yield();
+                }
+            }
+            writers_done.fetch_add(1, std::memory_order_release);
+        });
+    }
+
+    uint64_t reads = 0;
+    uint64_t updated_reads = 0;
+    uint64_t torn = 0;
+    uint64_t out_of_order = 0;
+    uint64_t last_seq[WRITER_COUNT] = {0, 0};
+    while (writers_done.load(std::memory_order_acquire) < WRITER_COUNT) {
+        bool updated = false;
+        const StressState& state = buffer.Read(&updated);
+        reads++;
+        if (!updated) {
+            std::this_thread::yield();
+            continue;
+        }
+        updated_reads++;
+        for (int k = 0; k < PAYLOAD_SIZE; k++) {
+            if (state.payload[k] != PayloadValue(state, k)) {
+                torn++;
+                break;
+            }
+        }
+        for (int w = 0; w < WRITER_COUNT; w++) {
+            if (state.seq[w] < last_seq[w]) {
+                out_of_order++;
+            }
+            last_seq[w] = state.seq[w];
+        }
+    }
+    for (int w = 0; w < WRITER_COUNT; w++) {
+        writers[w].join();
+    }
+
+    // 写者全部结束后，最后一次发布的快照必须可见
+    const StressState& final_state = buffer.Read();
+    bool final_ok = true;
+    for (int w = 0; w < WRITER_COUNT; w++) {
+        if (final_state.seq[w] != updates) {
+            final_ok = false;
+        }
+    }
+
+    printf("md_triple_buffer_stress: %d writers x %llu updates, %llu reads (%llu with new data), "
+           "torn %llu, out of order %llu, final %s\n", WRITER_COUNT, (unsigned long long)updates,
+           (unsigned long long)reads, (unsigned long long)updated_reads, (unsigned long long)torn,
+           (unsigned long long)out_of_order, final_ok ? "ok" : "stale");
+    return (torn == 0 && out_of_order == 0 && final_ok) ? 0 : 1;
+}
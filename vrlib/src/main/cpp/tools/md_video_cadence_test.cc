@@ -0,0 +1,148 @@
+//
+// Created on 2026/10/16.
+//
+// 主机侧测试：MDFrameRateEstimator 按帧间隔中位数估计片源帧率并吸附到最近的标准帧率，
+// MDPresentCadence 在 60Hz 上给 24fps 交替保持 3/2 个vsync、30fps 稳定保持 2 个，间隔超过4个片源周期时重新开始
+// 运行 md_video_cadence_test，全部通过时返回 0
+
+#include <cstdint>
+#include <vector>
+#include "vrlib/md_video_cadence.h"
+#include "md_test_util.h"
+
+using namespace asha::vrlib;
+
+static const int64_t DISPLAY_60HZ = 16666667LL;
+static const int64_t PERIOD_23_976 = 41708333LL;
+static const int64_t PERIOD_24 = 41666667LL;
+static const int64_t PERIOD_30 = 33333333LL;
+
+// 按给定间隔喂时间戳，每 5 帧有一帧晚 0.5ms（解码和 buffer 时间戳的抖动），中位数不受影响
+static int64_t EstimatePeriod(double interval_ns, int frames) {
+    MDFrameRateEstimator estimator;
+    int64_t base_ns = 1000000000LL;
+    for (int i = 0; i < frames; i++) {
+        int64_t jitter_ns = (i % 5 == 2) ? 500000 : 0;
+        estimator.AddTimestamp(base_ns + static_cast<int64_t>(i * interval_ns) + jitter_ns);
+    }
+    return estimator.GetFramePeriodNs();
+}
+
+MD_TEST(TestFrameRateSnapping) {
+    EXPECT_EQ(PERIOD_23_976, EstimatePeriod(1001000000000.0 / 24000.0, 32));
+    EXPECT_EQ(PERIOD_24, EstimatePeriod(1000000000.0 / 24.0, 32));
+    EXPECT_EQ(PERIOD_30, EstimatePeriod(1000000000.0 / 30.0, 32));
+    // 容差内吸附到最接近的标准值，而不是列表里第一个在容差内的（24 和 23.976 只差 0.1%）
+    EXPECT_EQ(PERIOD_24, EstimatePeriod(1000000000.0 / 24.2, 32));
+    EXPECT_EQ(PERIOD_30, EstimatePeriod(1000000000.0 / 30.2, 32));
+    EXPECT_EQ(PERIOD_23_976, EstimatePeriod(1000000000.0 / 23.8, 32));
+    // 不接近任何标准帧率时保留测得的周期
+    EXPECT_NEAR(50000000LL, EstimatePeriod(1000000000.0 / 20.0, 32), 600000);
+    // 样本不足时没有估计
+    EXPECT_EQ(0, EstimatePeriod(1000000000.0 / 24.0, MDFrameRateEstimator::MIN_SAMPLES));
+}
+
+MD_TEST(TestFrameRateReset) {
+    MDFrameRateEstimator estimator;
+    for (int i = 0; i < 20; i++) {
+        estimator.AddTimestamp(1000000000LL + i * PERIOD_24);
+    }
+    EXPECT_EQ(PERIOD_24, estimator.GetFramePeriodNs());
+    // seek 造成的时间戳跳变不计入样本
+    estimator.AddTimestamp(5000000000LL);
+    EXPECT_EQ(PERIOD_24, estimator.GetFramePeriodNs());
+    estimator.Reset();
+    EXPECT_EQ(0, estimator.GetFramePeriodNs());
+}
+
+// 逐个vsync调用 Tick，返回相邻两次取帧之间保持的vsync数
+static std::vector<int> HoldPattern(MDPresentCadence* cadence, int64_t start_ns, int vsyncs, int64_t content_ns,
+                                    bool* first_presented = nullptr) {
+    std::vector<int> holds;
+    int hold = 0;
+    bool presented_any = false;
+    for (int i = 0; i < vsyncs; i++) {
+        bool present = cadence->Tick(start_ns + i * DISPLAY_60HZ, DISPLAY_60HZ, content_ns);
+        if (i == 0 && first_presented != nullptr) {
+            *first_presented = present;
+        }
+        hold++;
+        if (present) {
+            if (presented_any) {
+                holds.push_back(hold);
+            }
+            presented_any = true;
+            hold = 0;
+        }
+    }
+    return holds;
+}
+
+MD_TEST(TestPulldown24On60) {
+    MDPresentCadence cadence;
+    std::vector<int> holds = HoldPattern(&cadence, 1000000000LL, 600, PERIOD_24);
+    EXPECT_EQ(239, holds.size());
+    int total = 0;
+    for (size_t i = 0; i < holds.size(); i++) {
+        EXPECT_EQ(true, holds[i] == 2 || holds[i] == 3);
+        if (i > 0) {
+            EXPECT_EQ(true, holds[i] != holds[i - 1]);
+        }
+        total += holds[i];
+    }
+    // 平均每帧 2.5 个vsync
+    EXPECT_NEAR(2.5, (double)total / holds.size(), 0.01);
+}
+
+MD_TEST(TestSteady30On60) {
+    MDPresentCadence cadence;
+    std::vector<int> holds = HoldPattern(&cadence, 1000000000LL, 600, PERIOD_30);
+    EXPECT_EQ(299, holds.size());
+    for (int hold : holds) {
+        EXPECT_EQ(2, hold);
+    }
+}
+
+// 片源帧率接近或高于刷新率时每个vsync都取帧
+MD_TEST(TestHighFrameRatePresentsEveryVsync) {
+    MDPresentCadence cadence;
+    for (int i = 0; i < 10; i++) {
+        EXPECT_EQ(true, cadence.Tick(1000000000LL + i * DISPLAY_60HZ, DISPLAY_60HZ, DISPLAY_60HZ));
+    }
+    EXPECT_EQ(true, cadence.Tick(2000000000LL, DISPLAY_60HZ, 0));
+}
+
+// 间隔超过4个片源周期（宿主休眠、暂停）后立即取帧，并且和刚开始播放时的节奏一样
+MD_TEST(TestPhaseResetAfterGap) {
+    MDPresentCadence fresh;
+    bool fresh_first = false;
+    std::vector<int> expected = HoldPattern(&fresh, 1000000000LL, 60, PERIOD_24, &fresh_first);
+    EXPECT_EQ(true, fresh_first);
+
+    MDPresentCadence cadence;
+    int64_t start_ns = 1000000000LL;
+    // 停在相位中间（这一帧不取帧的位置）
+    HoldPattern(&cadence, start_ns, 31, PERIOD_24);
+    int64_t resume_ns = start_ns + 30 * DISPLAY_60HZ + PERIOD_24 * 4 + DISPLAY_60HZ;
+    bool resumed_first = false;
+    std::vector<int> resumed = HoldPattern(&cadence, resume_ns, 60, PERIOD_24, &resumed_first);
+    EXPECT_EQ(true, resumed_first);
+    EXPECT_EQ(expected.size(), resumed.size());
+    for (size_t i = 0; i < expected.size() && i < resumed.size(); i++) {
+        EXPECT_EQ(expected[i], resumed[i]);
+    }
+}
+
+// 不超过4个片源周期的间隔按经过的时间累加相位，不重新开始
+MD_TEST(TestShortGapKeepsPhase) {
+    MDPresentCadence cadence;
+    int64_t start_ns = 1000000000LL;
+    HoldPattern(&cadence, start_ns, 30, PERIOD_24);
+    // 跳过 3 个vsync，相位已经越过下一个片源帧，恢复后的第一个vsync取帧
+    int64_t resume_ns = start_ns + 29 * DISPLAY_60HZ + 4 * DISPLAY_60HZ;
+    EXPECT_EQ(true, cadence.Tick(resume_ns, DISPLAY_60HZ, PERIOD_24));
+    // 紧接着的vsync不取帧（没有重新开始，相位没有回到满周期）
+    EXPECT_EQ(false, cadence.Tick(resume_ns + DISPLAY_60HZ, DISPLAY_60HZ, PERIOD_24));
+}
+
+MD_TEST_MAIN("md_video_cadence_test")
@@ -11,15 +11,67 @@ export enum MD360PlayerCmd {
   SET_BARREL_DISTORTION_PARAMS = 8
 }
 
+// 单个渲染阶段的耗时统计（毫秒）
+export interface MDFrameStageStats {
+  name: string;
+  count: number;
+  avgMs: number;
+  p50Ms: number;
+  p95Ms: number;
+  p99Ms: number;
+  maxMs: number;
+}
+
+export interface MDFrameStats {
+  frames: number;
+  missedDeadlines: number;
+  skippedFrames: number;
+  framePeriodMs: number;
+  renderedFrames: number;
+  reprojectedFrames: number;
+  resolutionScale: number;
+  resolutionScaleUps: number;
+  resolutionScaleDowns: number;
+  scaledFrameMs: number;
+  frameMsBeforeScaleChange: number;
+  frameMsAfterScaleChange: number;
+  gpuTimerSupported: boolean;
+  videoFps: number;
+  videoCadenceActive: boolean;
+  heldVsyncs: number;
+  suspendCount: number;
+  gpuReleased: boolean;
+  resumeRebuildMs: number;
+  resumeToFirstFrameMs: number;
+  programBinaryHits: number;
+  programBinaryMisses: number;
+  meshLodAuto: boolean;
+  meshLodLevel: number;
+  meshTriangles: number;
+  meshLodSwitches: number;
+  frustumCulling: boolean;
+  meshCulledRatio: number;
+  meshDrawCalls: number;
+  meshSubmittedTriangles: number;
+  meshCulledTriangles: number;
+  rayCastModes: number;
+  rayCastActive: boolean;
+  rayCastDraws: number;
+  stages: MDFrameStageStats[];
+}
+
 export declare class MD360Player {
   constructor()
 
   // 基础方法（已实现）
   setSurfaceId(surfaceId : string) : number;
   runCmd(cmd: MD360PlayerCmd): number;
+  // 挂起渲染（RESUME 恢复），releaseGpuMemory 为 true 时释放着色器程序、顶点缓冲和离屏缓冲，恢复时快速重建
+  suspend(releaseGpuMemory?: boolean): number;
   updateMVPMatrix(matrix: number[]): void;
   updateTouchDelta(deltaX: number, deltaY: number): void;
   getVideoSurfaceId(): string;
+  shareVideoWith(other: MD360Player): number;
   setClearColor(r: number, g: number, b: number, a: number): void;
   setCullFaceEnabled(enabled: boolean): void;
   setDepthTestEnabled(enabled: boolean): void;
@@ -35,6 +87,55 @@ export declare class MD360Player {
   
   // 投影模式方法（已实现）
   setProjectionMode(mode: number): void;
+  flush(): Promise<number>;
+
+  // 按需渲染方法：0 = 仅在内容变化时重绘，1 = 连续重绘
+  setRenderMode(mode: number): void;
+  requestRender(): void;
+  getSkippedFrameCount(): number;
+
+  // 帧耗时统计方法
+  getFrameStats(): MDFrameStats | null;
+  resetFrameStats(): void;
+
+  // 头部姿态预测：latencyMs 为 vsync 之后的管线延迟，省略或小于0时使用一个帧周期
+  setPosePrediction(enabled: boolean, latencyMs?: number): void;
+
+  // VR模式下的重投影：视频帧或渲染来不及时按最新姿态重投影上一帧
+  setReprojectionEnabled(enabled: boolean): void;
+
+  // 没有头部跟踪时按片源帧率出图（24fps@60Hz 为 3:2 pulldown），默认开启
+  setVideoCadenceEnabled(enabled: boolean): void;
+
+  // 动态分辨率：按GPU耗时在 [minScale, maxScale] 之间调整渲染分辨率，默认 0.5 ~ 1
+  setDynamicResolution(enabled: boolean, minScale?: number, maxScale?: number): void;
+
+  // 球面/穹顶网格的细分级别：0 ~ 3 由粗到细，省略或 -1 时按输出分辨率和视野自动选择（默认）
+  setMeshLodLevel(level?: number): void;
+
+  // 视锥剔除：网格按 22.5 度分块，每只眼睛只绘制视野内的分块，默认开启
+  setFrustumCullingEnabled(enabled: boolean): void;
+
+  // 射线投射渲染：指定投影模式（球面/穹顶，立方体不支持）不用网格，逐像素求视线采样视频纹理，默认关闭
+  setRayCastEnabled(projectionMode: number, enabled: boolean): void;
+
+  // 加载预先烘焙的网格资源（md_mesh_bake 生成，例如 rawfile 的 fd / offset / length），返回0表示成功
+  loadMeshAsset(fd: number, offset: number, length: number): number;
+
+  // 双鱼眼投影（210 / 211）的镜头标定：lens 为0（朝前）或1（朝后），圆心和半径按帧宽高归一化，fov 为视场角（度）
+  // fov 小于等于0时恢复默认值，返回0表示成功
+  setFisheyeLens(lens: number, centerX: number, centerY: number, radiusX: number, radiusY: number, fov: number): number;
+
+  // 立方体贴图投影（214）的画面排列：layout 0 为 3x2、1 为 6x1、2 为 YouTube EAC 排列，equiAngular 为 EAC 等角变换，
+  // padding 为每个面四边的边距（按面的宽高比例，0 ~ 0.25），返回0表示成功
+  setCubeLayout(layout: number, equiAngular: boolean, padding: number): number;
+
+  // 立体球面投影（206 / 213 上下，212 左右）每只眼睛的球面偏转角度（度，-180 ~ 180），返回0表示成功
+  setStereoEyeOffset(leftYaw: number, rightYaw: number): number;
+
+  // 平面投影（207 / 208 / 209）的缩放方式：0 按投影模式、1 完整显示、2 宽贴满、3 高贴满、4 裁剪铺满、5 拉伸铺满；
+  // curveDegree 为眼镜模式下弧形屏幕的水平弧度（度，0 ~ 180，0 为平面屏幕），返回0表示成功
+  setPlaneOptions(scaleType: number, curveDegree: number): number;
 
   // VR模式相关接口（新增）
   setVRModeEnabled(enabled: boolean): number;
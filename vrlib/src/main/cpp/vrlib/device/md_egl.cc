@@ -69,75 +69,12 @@ static EGLDisplay GetPlatformEglDisplay(EGLenum platform, void *native_display,
 }
 
 
-class MDEglV1 : public MDEgl {
+class MDEglContextV1 : public MDEglContext {
 public:
-    virtual ~MDEglV1() = default;
+    virtual ~MDEglContextV1() = default;
+
     virtual int Prepare() override {
-        InitContextInternal();
-        InitWindowInternal();
-        return MD_OK;
-    }
-    
-    virtual int SetRenderWindow(std::shared_ptr<MDNativeWindowRef> window_ref) override {
-        std::lock_guard<std::mutex> lock(window_mutex_);
-        window_for_render_ = window_ref;
-        return MD_OK;
-    }
-    
-    virtual int MakeCurrent(bool current) override {
-        if (IsEglValidateContext()) {
-            if (current) {
-                EGLSurface surface = eglSurface_ != EGL_NO_SURFACE ? eglSurface_ : eglPbSurface_;
-                eglMakeCurrent(eglDisplay_, surface, surface, eglContext_);
-            } else {
-                // make nope
-                eglMakeCurrent(eglDisplay_, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
-            }
-        }
-        return MD_OK;
-    }
-    
-    virtual int SwapBuffer() override {
-        if (IsEglValid()) {
-            eglSwapBuffers(eglDisplay_, eglSurface_);    
-        }
-        return MD_OK;
-    }
-    
-    virtual bool IsEglValid() override {
-        return IsEglValidateContext() && IsEglValidateWindow();
-    }
-    
-    virtual int Terminate() override {
-        TerminateWindowInternal();
-        TerminateContextInternal();
-        return MD_OK;
-    }
-    
-     virtual bool QuerySurface(EGLint attribute, EGLint* value) override {
-        if (!IsEglValid() || value == nullptr) {
-            return false;
-        }
-        
-        EGLSurface surface = eglSurface_ != EGL_NO_SURFACE ? eglSurface_ : eglPbSurface_;
-        if (surface == EGL_NO_SURFACE) {
-            return false;
-        }
-        
-        return eglQuerySurface(eglDisplay_, surface, attribute, value) == EGL_TRUE;
-    }
-    
-private:
-    bool IsEglValidateContext() {
-        return eglContext_ != EGL_NO_CONTEXT && eglDisplay_ != EGL_NO_DISPLAY && config_ != EGL_NO_CONFIG_KHR && eglPbSurface_ != EGL_NO_SURFACE;
-    }
-    
-    bool IsEglValidateWindow() {
-        return eglSurface_ != EGL_NO_SURFACE;
-    }
-    
-    int InitContextInternal() {
-        if (IsEglValidateContext()) {
+        if (IsValid()) {
             return MD_OK;
         }
         // 获取当前的显示设备
@@ -205,18 +142,9 @@ private:
         MD_LOGI("MDEglV1::Init Create EGL context successfully, version %d.%d", major, minor);
         return MD_OK;
     }
-    
-    int TerminateWindowInternal() {
-        if (IsEglValidateContext()) {
-            eglMakeCurrent(eglDisplay_, EGL_NO_SURFACE, EGL_NO_SURFACE, eglContext_);
-            eglDestroySurface(eglDisplay_, eglSurface_);
-            eglSurface_ = EGL_NO_SURFACE;
-        }
-        return MD_OK;
-    }
-    
-    int TerminateContextInternal() {
-        if (IsEglValidateContext()) {
+
+    virtual int Terminate() override {
+        if (IsValid()) {
             if (eglPbSurface_ != EGL_NO_SURFACE) {
                 eglMakeCurrent(eglDisplay_, EGL_NO_SURFACE, EGL_NO_SURFACE, eglContext_);
                 eglDestroySurface(eglDisplay_, eglPbSurface_);
@@ -230,15 +158,124 @@ private:
             eglTerminate(eglDisplay_);
             eglDisplay_ = EGL_NO_DISPLAY;
             config_ = EGL_NO_CONFIG_KHR;
-            window_used_ = nullptr;
-            {
-                std::lock_guard<std::mutex> lock(window_mutex_);
-                window_for_render_ = nullptr;
+        }
+        return MD_OK;
+    }
+
+    virtual bool IsValid() override {
+        return eglContext_ != EGL_NO_CONTEXT && eglDisplay_ != EGL_NO_DISPLAY && config_ != EGL_NO_CONFIG_KHR && eglPbSurface_ != EGL_NO_SURFACE;
+    }
+
+    virtual EGLDisplay GetDisplay() override { return eglDisplay_; }
+    virtual EGLConfig GetConfig() override { return config_; }
+    virtual EGLContext GetContext() override { return eglContext_; }
+    virtual EGLSurface GetPbufferSurface() override { return eglPbSurface_; }
+
+private:
+    EGLContext eglContext_ = EGL_NO_CONTEXT;
+    EGLDisplay eglDisplay_ = EGL_NO_DISPLAY;
+    EGLConfig config_ = EGL_NO_CONFIG_KHR;
+    EGLSurface eglPbSurface_ = EGL_NO_SURFACE;
+};
+
+class MDEglV1 : public MDEgl {
+public:
+    virtual ~MDEglV1() = default;
+    virtual int SetSharedContext(std::shared_ptr<MDEglContext> context) override {
+        if (context_ != nullptr && context_->IsValid()) {
+            MD_LOGW("MDEglV1::SetSharedContext: context already prepared, ignored");
+            return MD_ERR;
+        }
+        context_ = context;
+        owns_context_ = false;
+        return MD_OK;
+    }
+
+    virtual int Prepare() override {
+        if (context_ == nullptr) {
+            context_ = MDEglContext::CreateEglContext();
+            owns_context_ = true;
+        }
+        context_->Prepare();
+        InitWindowInternal();
+        return MD_OK;
+    }
+    
+    virtual int SetRenderWindow(std::shared_ptr<MDNativeWindowRef> window_ref) override {
+        std::lock_guard<std::mutex> lock(window_mutex_);
+        window_for_render_ = window_ref;
+        return MD_OK;
+    }
+    
+    virtual int MakeCurrent(bool current) override {
+        if (IsEglValidateContext()) {
+            if (current) {
+                EGLSurface surface = eglSurface_ != EGL_NO_SURFACE ? eglSurface_ : context_->GetPbufferSurface();
+                eglMakeCurrent(context_->GetDisplay(), surface, surface, context_->GetContext());
+            } else {
+                // make nope
+                eglMakeCurrent(context_->GetDisplay(), EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
             }
         }
         return MD_OK;
     }
     
+    virtual int SwapBuffer() override {
+        if (IsEglValid()) {
+            eglSwapBuffers(context_->GetDisplay(), eglSurface_);    
+        }
+        return MD_OK;
+    }
+    
+    virtual bool IsEglValid() override {
+        return IsEglValidateContext() && IsEglValidateWindow();
+    }
+    
+    virtual int Terminate() override {
+        TerminateWindowInternal();
+        // 共享的上下文由创建者负责销毁
+        if (owns_context_ && context_ != nullptr) {
+            context_->Terminate();
+        }
+        window_used_ = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(window_mutex_);
+            window_for_render_ = nullptr;
+        }
+        return MD_OK;
+    }
+    
+     virtual bool QuerySurface(EGLint attribute, EGLint* value) override {
+        if (!IsEglValid() || value == nullptr) {
+            return false;
+        }
+        
+        EGLSurface surface = eglSurface_ != EGL_NO_SURFACE ? eglSurface_ : context_->GetPbufferSurface();
+        if (surface == EGL_NO_SURFACE) {
+            return false;
+        }
+        
+        return eglQuerySurface(context_->GetDisplay(), surface, attribute, value) == EGL_TRUE;
+    }
+    
+private:
+    bool IsEglValidateContext() {
+        return context_ != nullptr && context_->IsValid();
+    }
+    
+    bool IsEglValidateWindow() {
+        return eglSurface_ != EGL_NO_SURFACE;
+    }
+    
+    int TerminateWindowInternal() {
+        if (IsEglValidateContext() && eglSurface_ != EGL_NO_SURFACE) {
+            eglMakeCurrent(context_->GetDisplay(), EGL_NO_SURFACE, EGL_NO_SURFACE, context_->GetContext());
+            eglDestroySurface(context_->GetDisplay(), eglSurface_);
+            eglSurface_ = EGL_NO_SURFACE;
+        }
+        return MD_OK;
+    }
+    
     int InitWindowInternal() {
         std::shared_ptr<MDNativeWindowRef> window_ref = nullptr;
         {
@@ -255,7 +292,7 @@ private:
         if (window_ref != nullptr && window_ref->IsValid()) {
             // 创建eglSurface
             EGLNativeWindowType nativeWindow = reinterpret_cast<EGLNativeWindowType>(window_ref->GetNativeWindow());
-            eglSurface_ = eglCreateWindowSurface(eglDisplay_, config_, nativeWindow, NULL);
+            eglSurface_ = eglCreateWindowSurface(context_->GetDisplay(), context_->GetConfig(), nativeWindow, NULL);
             if (eglSurface_ == EGL_NO_SURFACE) {
                 MD_LOGE("MDEglV1::Init Failed to create egl surface, error:%d window:%p", eglGetError(), window_ref->GetNativeWindow());
             }
@@ -264,17 +301,18 @@ private:
         return MD_OK;
     }
 private:
-    EGLContext eglContext_ = EGL_NO_CONTEXT;
-    EGLDisplay eglDisplay_ = EGL_NO_DISPLAY;
-    EGLConfig config_ = EGL_NO_CONFIG_KHR;
+    std::shared_ptr<MDEglContext> context_ = nullptr;
+    bool owns_context_ = false;
     EGLSurface eglSurface_ = EGL_NO_SURFACE;
-    EGLSurface eglPbSurface_ = EGL_NO_SURFACE;
     std::shared_ptr<MDNativeWindowRef> window_used_ = nullptr;
     // 上屏window
     std::shared_ptr<MDNativeWindowRef> window_for_render_ = nullptr;
     std::mutex window_mutex_;
 };
 
+std::shared_ptr<MDEglContext> MDEglContext::CreateEglContext() {
+    return std::make_shared<MDEglContextV1>();
+}
 
 std::shared_ptr<MDEgl> MDEgl::CreateEgl() {
     auto egl = std::make_shared<MDEglV1>();
@@ -11,8 +11,27 @@
 namespace asha {
 namespace vrlib {
 
+// EGL 上下文：display/config/context 以及没有窗口时使用的 pbuffer，可以被多个 MDEgl 窗口共享
+// 只能在GL线程中 Prepare/Terminate
+class MDEglContext {
+public:
+    virtual ~MDEglContext() = default;
+    virtual int Prepare() = 0;
+    virtual int Terminate() = 0;
+    virtual bool IsValid() = 0;
+    virtual EGLDisplay GetDisplay() = 0;
+    virtual EGLConfig GetConfig() = 0;
+    virtual EGLContext GetContext() = 0;
+    virtual EGLSurface GetPbufferSurface() = 0;
+public:
+    static std::shared_ptr<MDEglContext> CreateEglContext();
+};
+
+// 一个上屏窗口的 EGLSurface；默认独占一个上下文，SetSharedContext 后多个窗口共用同一个上下文
 class MDEgl {
 public:
+    // 必须在第一次 Prepare 之前调用；共享的上下文由外部负责 Terminate
+    virtual int SetSharedContext(std::shared_ptr<MDEglContext> context) = 0;
     virtual int Prepare() = 0;
     virtual int MakeCurrent(bool current) = 0;
     virtual int SetRenderWindow(std::shared_ptr<MDNativeWindowRef> window_ref) = 0;
@@ -30,6 +30,10 @@ MDNativeImageRef::MDNativeImageRef(int texture_id) {
 }
 
 MDNativeImageRef::~MDNativeImageRef() {
+    if (oh_image_ && frame_listener_set_) {
+        OH_NativeImage_UnsetOnFrameAvailableListener(oh_image_);
+        frame_listener_set_ = false;
+    }
     if (oh_image_) {
         OH_NativeImage_Destroy(&oh_image_);
     }
@@ -106,6 +110,8 @@ int MDNativeImageRef::UpdateSurface(float* matrix) {
         return MD_ERR;
     }
     
+    has_new_frame_ = false;
+
     // 更新 Surface 图像
     // 注意：需要确保有视频源连接到这个 surface，否则可能会失败
     int ret = OH_NativeImage_UpdateSurfaceImage(oh_image_);
@@ -145,6 +151,7 @@ int MDNativeImageRef::UpdateSurface(float* matrix) {
     
     // 更新成功
     g_has_ever_succeeded = true; // 标记曾经成功过
+    has_new_frame_ = true;
     
     // 如果成功，重置错误计数
     if (g_update_surface_error_count > 0) {
@@ -174,6 +181,65 @@ int MDNativeImageRef::UpdateSurface(float* matrix) {
     return MD_OK;
 }
 
+bool MDNativeImageRef::SetOnFrameAvailableListener(std::function<void()> listener) {
+    if (!oh_image_) {
+        return false;
+    }
+    frame_listener_ = listener;
+    OH_OnFrameAvailableListener oh_listener;
+    oh_listener.context = this;
+    oh_listener.onFrameAvailable = MDNativeImageRef::OnFrameAvailable;
+    int ret = OH_NativeImage_SetOnFrameAvailableListener(oh_image_, oh_listener);
+    if (ret != 0) {
+        MD_LOGW("MDNativeImageRef::SetOnFrameAvailableListener failed: %d", ret);
+        frame_listener_ = nullptr;
+        return false;
+    }
+    frame_listener_set_ = true;
+    return true;
+}
+
+void MDNativeImageRef::OnFrameAvailable(void* context) {
+    auto ref = reinterpret_cast<MDNativeImageRef*>(context);
+    if (ref == nullptr) {
+        return;
+    }
+    if (ref->frame_listener_) {
+        ref->frame_listener_();
+    }
+}
+
+bool MDNativeImageRef::HasNewFrame() {
+    return has_new_frame_;
+}
+
+int64_t MDNativeImageRef::GetTimestamp() {
+    if (!oh_image_) {
+        return 0;
+    }
+    return OH_NativeImage_GetTimestamp(oh_image_);
+}
+
+bool MDNativeImageRef::GetBufferSize(int* width, int* height) {
+    if (!oh_image_) {
+        return false;
+    }
+    // NativeImage 持有的生产者窗口，不需要释放；GET_BUFFER_GEOMETRY 的参数顺序是先高后宽
+    OHNativeWindow* window = OH_NativeImage_AcquireNativeWindow(oh_image_);
+    if (window == nullptr) {
+        return false;
+    }
+    int32_t buffer_height = 0;
+    int32_t buffer_width = 0;
+    int ret = OH_NativeWindow_NativeWindowHandleOpt(window, GET_BUFFER_GEOMETRY, &buffer_height, &buffer_width);
+    if (ret != 0 || buffer_width <= 0 || buffer_height <= 0) {
+        return false;
+    }
+    *width = buffer_width;
+    *height = buffer_height;
+    return true;
+}
+
 int MDNativeImageRef::GetTextureId() {
     return texture_id_;
 }
@@ -6,8 +6,10 @@
 #define MD360PLAYER4OH_MD_NATIVEIMAGE_REF_H
 
 #include <native_image/native_image.h>
+#include <native_window/external_window.h>
 
 #include <memory>
+#include <functional>
 
 namespace asha {
 namespace vrlib {
@@ -21,8 +23,21 @@ public:
     bool IsValid();
     int UpdateSurface(float* matrix);
     int GetTextureId();
+    // 注册新帧到达回调（在生产者线程中调用），返回是否注册成功
+    bool SetOnFrameAvailableListener(std::function<void()> listener);
+    // 最近一次 UpdateSurface 是否取到了新的视频帧
+    bool HasNewFrame();
+    // 最近一次取到的视频帧的时间戳（纳秒），失败时返回0
+    int64_t GetTimestamp();
+    // 生产者（解码器）设置的缓冲区尺寸，还不知道时返回 false
+    bool GetBufferSize(int* width, int* height);
+private:
+    static void OnFrameAvailable(void* context);
 private:
     OH_NativeImage* oh_image_ = nullptr;
+    std::function<void()> frame_listener_;
+    bool frame_listener_set_ = false;
+    bool has_new_frame_ = false;
     uint64_t surface_id_ = 0;
     int texture_id_ = 0;
 };
@@ -0,0 +1,60 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#include "md_cube_layout.h"
+#include <cmath>
+
+namespace asha {
+namespace vrlib {
+
+// 按 MDCubeFace 的顺序：右 左 上 下 前 后
+static const MDCubeFaceCell CELLS[MD_CUBE_LAYOUT_COUNT][MD_CUBE_FACE_COUNT] = {
+    // MD_CUBE_LAYOUT_3X2
+    {{0, 0, 0}, {1, 0, 0}, {2, 0, 0}, {0, 1, 0}, {1, 1, 0}, {2, 1, 0}},
+    // MD_CUBE_LAYOUT_6X1
+    {{0, 0, 0}, {1, 0, 0}, {2, 0, 0}, {3, 0, 0}, {4, 0, 0}, {5, 0, 0}},
+    // MD_CUBE_LAYOUT_EAC：后面的上方朝右，下面和上面与它相接的边分别朝右、朝左
+    {{2, 0, 0}, {0, 0, 0}, {2, 1, 3}, {0, 1, 3}, {1, 0, 0}, {1, 1, 1}},
+};
+
+bool MDCubeLayout::IsValid(int layout, float padding) {
+    return layout >= 0 && layout < MD_CUBE_LAYOUT_COUNT && padding >= 0.0f && padding < MAX_PADDING;
+}
+
+void MDCubeLayout::GetGrid(int layout, int* columns, int* rows) {
+    *columns = layout == MD_CUBE_LAYOUT_6X1 ? 6 : 3;
+    *rows = layout == MD_CUBE_LAYOUT_6X1 ? 1 : 2;
+}
+
+MDCubeFaceCell MDCubeLayout::GetCell(int layout, int face) {
+    if (layout < 0 || layout >= MD_CUBE_LAYOUT_COUNT || face < 0 || face >= MD_CUBE_FACE_COUNT) {
+        return MDCubeFaceCell();
+    }
+    return CELLS[layout][face];
+}
+
+void MDCubeLayout::FaceTexCoord(int layout, int face, float padding, float x, float y, float* s, float* t) {
+    MDCubeFaceCell cell = GetCell(layout, face);
+    // 每顺时针转四分之一圈，面内朝上的方向变成朝右：(x, y) -> (y, 1 - x)
+    for (int i = 0; i < cell.rotation; i++) {
+        float rotated_x = y;
+        y = 1.0f - x;
+        x = rotated_x;
+    }
+    int columns = 0;
+    int rows = 0;
+    GetGrid(layout, &columns, &rows);
+    float scale = 1.0f - 2.0f * padding;
+    *s = (cell.column + padding + x * scale) / columns;
+    *t = (rows - 1 - cell.row + padding + y * scale) / rows;
+}
+
+float MDCubeLayout::EquiAngular(float c) {
+    return atanf(c) * (4.0f / 3.14159265358979323846f);
+}
+
+}
+}
@@ -0,0 +1,60 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef MD360PLAYER4OH_MD_CUBE_LAYOUT_H
+#define MD360PLAYER4OH_MD_CUBE_LAYOUT_H
+
+namespace asha {
+namespace vrlib {
+
+// 立方体贴图视频的画面排列（面名称按观看方向：前为经纬图中心，右、后、左依次向右转）
+enum MDCubeLayoutType {
+    MD_CUBE_LAYOUT_3X2 = 0,  // 上排 右 左 上，下排 下 前 后，都不旋转（与 ffmpeg v360 的 c3x2 相同）
+    MD_CUBE_LAYOUT_6X1,      // 右 左 上 下 前 后 排成一行（c6x1）
+    MD_CUBE_LAYOUT_EAC,      // YouTube EAC 的排列：上排 左 前 右；下排 下 后 上，各自顺时针转90 / 270 / 270度，
+                             // 连成绕到背后的一条
+    MD_CUBE_LAYOUT_COUNT
+};
+
+enum MDCubeFace {
+    MD_CUBE_FACE_RIGHT = 0,
+    MD_CUBE_FACE_LEFT,
+    MD_CUBE_FACE_UP,
+    MD_CUBE_FACE_DOWN,
+    MD_CUBE_FACE_FRONT,
+    MD_CUBE_FACE_BACK,
+    MD_CUBE_FACE_COUNT
+};
+
+// 面在画面中的格子：列、行（从上往下）和顺时针旋转的四分之一圈数
+struct MDCubeFaceCell {
+    int column = 0;
+    int row = 0;
+    int rotation = 0;
+};
+
+// 立方体贴图的纹理坐标（不依赖GL，也用于主机侧的网格工具）
+// padding 为每个面的格子四边留出的边距，按格子宽高的比例（0 ~ MAX_PADDING），编码时向外多画的一圈像素
+// 放在边距里，双线性过滤不会采到相邻的面
+class MDCubeLayout {
+public:
+    static constexpr float MAX_PADDING = 0.25f;
+
+    static bool IsValid(int layout, float padding);
+    static void GetGrid(int layout, int* columns, int* rows);
+    static MDCubeFaceCell GetCell(int layout, int face);
+
+    // 面内坐标 (x, y)（0 ~ 1，面朝观看者时 x 向右、y 向上）对应的画面纹理坐标（GL纹理坐标，t 向上）
+    static void FaceTexCoord(int layout, int face, float padding, float x, float y, float* s, float* t);
+
+    // EAC 的面内坐标：立方体面上的切线坐标 c（-1 ~ 1）按角度等分，与着色器中的变换相同
+    static float EquiAngular(float c);
+};
+
+}
+}
+
+#endif //MD360PLAYER4OH_MD_CUBE_LAYOUT_H
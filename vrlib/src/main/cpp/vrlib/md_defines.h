@@ -19,6 +19,14 @@
 // 添加着色器相关错误码
 #define MD_ERR_SHADER_COMPILE       MD_ERR_BASE - 4
 #define MD_ERR_SHADER_LINK          MD_ERR_BASE - 5
+// GL命令队列已满 / 渲染器已销毁，命令被丢弃
+#define MD_ERR_QUEUE_FULL           MD_ERR_BASE - 6
+#define MD_ERR_CANCELLED            MD_ERR_BASE - 7
+// 网格资源文件读取 / 映射失败，格式、版本或校验和不对
+#define MD_ERR_ASSET_IO             MD_ERR_BASE - 8
+#define MD_ERR_ASSET_INVALID        MD_ERR_BASE - 9
+// 参数超出范围
+#define MD_ERR_INVALID_PARAM        MD_ERR_BASE - 10
 
 #endif //MD360PLAYER4OH_MD_DEFINES_H
 
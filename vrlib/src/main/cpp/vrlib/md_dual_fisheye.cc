@@ -0,0 +1,68 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#include "md_dual_fisheye.h"
+#include <cmath>
+
+namespace asha {
+namespace vrlib {
+
+static const float PI = 3.14159265358979323846f;
+static const float DEFAULT_FOV = 190.0f;
+
+MDFisheyeLens MDDualFisheye::DefaultLens(bool vertical, int index) {
+    MDFisheyeLens lens;
+    float offset = index == 0 ? 0.25f : 0.75f;
+    lens.center_x = vertical ? 0.5f : offset;
+    lens.center_y = vertical ? offset : 0.5f;
+    lens.radius_x = vertical ? 0.5f : 0.25f;
+    lens.radius_y = vertical ? 0.25f : 0.5f;
+    lens.fov = DEFAULT_FOV;
+    return lens;
+}
+
+bool MDDualFisheye::IsValidLens(const MDFisheyeLens& lens) {
+    return lens.center_x >= 0.0f && lens.center_x <= 1.0f && lens.center_y >= 0.0f && lens.center_y <= 1.0f &&
+           lens.radius_x > 0.0f && lens.radius_y > 0.0f && lens.fov > 0.0f && lens.fov < 360.0f;
+}
+
+MDFisheyeLens MDDualFisheye::ResolveLens(const MDFisheyeLens& lens, bool vertical, int index) {
+    return lens.fov > 0.0f ? lens : DefaultLens(vertical, index);
+}
+
+void MDDualFisheye::Project(const MDFisheyeLens& lens, int index, float sin_phi, float cos_phi, float theta,
+                            float* s, float* t) {
+    // 镜头1朝后：到它光轴的夹角为 PI - theta，它的右方是 -X，所以水平方向取反
+    float lens_theta = index == 0 ? theta : PI - theta;
+    float r = lens_theta / (lens.fov * PI / 360.0f);
+    float x = index == 0 ? cos_phi : -cos_phi;
+    *s = lens.center_x + r * x * lens.radius_x;
+    *t = (1.0f - lens.center_y) + r * sin_phi * lens.radius_y;
+}
+
+void MDDualFisheye::BlendRange(const MDFisheyeLens lenses[LENS_COUNT], float* begin, float* end) {
+    // 镜头1的视场从 PI - 半视场 开始，镜头0的视场到 半视场 结束
+    float first = PI - lenses[1].fov * PI / 360.0f;
+    float last = lenses[0].fov * PI / 360.0f;
+    if (first > last) {
+        first = last = (first + last) * 0.5f;
+    }
+    *begin = first;
+    *end = last;
+}
+
+float MDDualFisheye::BlendWeight(float begin, float end, float theta) {
+    if (theta < begin) {
+        return 1.0f;
+    }
+    if (theta >= end) {
+        return 0.0f;
+    }
+    return (end - theta) / (end - begin);
+}
+
+}
+}
@@ -0,0 +1,57 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef MD360PLAYER4OH_MD_DUAL_FISHEYE_H
+#define MD360PLAYER4OH_MD_DUAL_FISHEYE_H
+
+namespace asha {
+namespace vrlib {
+
+// 双鱼眼镜头的标定参数。圆心按整帧宽高归一化，原点在图像左上角（与标定工具输出的像素坐标除以帧宽高一致）
+// fov 小于等于0表示没有标定，使用画面排列的默认值（MDDualFisheye::DefaultLens）
+struct MDFisheyeLens {
+    float center_x = 0.0f;
+    float center_y = 0.0f;
+    float radius_x = 0.0f;  // 镜头圆（视场边缘）的半径，分别按帧宽、帧高归一化
+    float radius_y = 0.0f;
+    float fov = 0.0f;       // 镜头圆覆盖的视场角（度），超过180度时两个镜头在接缝处有重叠
+
+    bool operator==(const MDFisheyeLens& other) const {
+        return center_x == other.center_x && center_y == other.center_y && radius_x == other.radius_x &&
+               radius_y == other.radius_y && fov == other.fov;
+    }
+    bool operator!=(const MDFisheyeLens& other) const { return !(*this == other); }
+};
+
+// 双鱼眼（两个背靠背的鱼眼镜头画面左右或上下排列在一帧里）的等距投影映射，不依赖GL，也用于主机侧的网格工具
+// 镜头0朝前（-Z，默认视角方向），镜头1朝后（+Z），两个镜头的上方都是 +Y；
+// 两个视场重叠的接缝带里按到各自视场边缘的角距离线性混合，没有重叠时在两个视场边缘的中间硬切换
+class MDDualFisheye {
+public:
+    static constexpr int LENS_COUNT = 2;
+
+    // 画面排列的默认标定：左右排列时镜头0在左半幅，上下排列时在上半幅，镜头圆内切半幅，视场190度
+    static MDFisheyeLens DefaultLens(bool vertical, int index);
+    // 标定参数在合理范围内：圆心在帧内，半径大于0，视场在 (0, 360) 度之间
+    static bool IsValidLens(const MDFisheyeLens& lens);
+    // 没有标定的镜头换成默认值
+    static MDFisheyeLens ResolveLens(const MDFisheyeLens& lens, bool vertical, int index);
+
+    // 与镜头0光轴夹角为 theta、方位角为 phi（绕光轴从 +X 向 +Y）的方向在镜头 index 画面里的纹理坐标
+    // （GL纹理坐标，t 向上）；超出镜头圆时按同一公式外推，保证跨过视场边缘的三角形插值连续
+    static void Project(const MDFisheyeLens& lens, int index, float sin_phi, float cos_phi, float theta,
+                        float* s, float* t);
+
+    // 接缝带在镜头0光轴夹角上的范围 [begin, end]（弧度），没有重叠时 begin == end
+    static void BlendRange(const MDFisheyeLens lenses[LENS_COUNT], float* begin, float* end);
+    // 镜头0的混合权重：接缝带之前为1，之后为0，带内线性过渡（镜头1的权重为 1 - w）
+    static float BlendWeight(float begin, float end, float theta);
+};
+
+}
+}
+
+#endif //MD360PLAYER4OH_MD_DUAL_FISHEYE_H
@@ -0,0 +1,124 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#include "md_dual_fisheye_program.h"
+#include <GLES2/gl2ext.h>
+#include <string>
+#include "md_defines.h"
+#include "md_log.h"
+#include "md_program_cache.h"
+
+namespace asha {
+namespace vrlib {
+
+// 属性位置与 MDMeshCache 上传时配置的 VAO 一致：0 位置、1 镜头0纹理坐标、2 镜头1纹理坐标、3 镜头0的权重
+static const char* DUAL_FISHEYE_VERTEX_SHADER = R"(
+    attribute vec4 a_Position;
+    attribute vec2 a_TexCoordinate;
+    attribute vec2 a_TexCoordinate2;
+    attribute float a_BlendWeight;
+    uniform mat4 u_MVPMatrix;
+    uniform mat4 u_STMatrix;
+    varying vec2 vTexCoord0;
+    varying vec2 vTexCoord1;
+    varying float vWeight;
+    void main() {
+        vTexCoord0 = (u_STMatrix * vec4(a_TexCoordinate, 0, 1)).xy;
+        vTexCoord1 = (u_STMatrix * vec4(a_TexCoordinate2, 0, 1)).xy;
+        vWeight = a_BlendWeight;
+        gl_Position = u_MVPMatrix * a_Position;
+    }
+)";
+
+// 权重在接缝带之外恒为0或1（网格在带的两端各有一个环），这些片元只采样一个镜头；MD_DISTORTION 由 GetProgram 定义
+static const char* DUAL_FISHEYE_FRAGMENT_SHADER = R"(
+    #extension GL_OES_EGL_image_external : require
+    precision mediump float;
+    varying vec2 vTexCoord0;
+    varying vec2 vTexCoord1;
+    varying float vWeight;
+    uniform samplerExternalOES u_Texture;
+    uniform vec4 u_DistortionParams;
+
+    vec4 Sample(vec2 texCoord) {
+    #ifdef MD_DISTORTION
+        if (u_DistortionParams.y != 0.0) {
+            vec2 coords = texCoord - vec2(0.5);
+            float rSq = coords.x * coords.x + coords.y * coords.y;
+            texCoord = coords * (u_DistortionParams.x + u_DistortionParams.y * rSq) + vec2(0.5);
+        }
+        if (texCoord.x < 0.0 || texCoord.x > 1.0 || texCoord.y < 0.0 || texCoord.y > 1.0) {
+            return vec4(0.0, 0.0, 0.0, 1.0);
+        }
+    #endif
+        return texture2D(u_Texture, texCoord);
+    }
+
+    void main() {
+        if (vWeight >= 0.999) {
+            gl_FragColor = Sample(vTexCoord0);
+        } else if (vWeight <= 0.001) {
+            gl_FragColor = Sample(vTexCoord1);
+        } else {
+            gl_FragColor = mix(Sample(vTexCoord1), Sample(vTexCoord0), vWeight);
+        }
+    }
+)";
+
+MDDualFisheyeProgram::Program* MDDualFisheyeProgram::GetProgram(bool vr) {
+    Program* program = &programs_[vr ? 1 : 0];
+    if (program->program != 0) {
+        return program;
+    }
+    std::string fragment_source;
+    if (vr) {
+        fragment_source += "#define MD_DISTORTION\n";
+    }
+    fragment_source += DUAL_FISHEYE_FRAGMENT_SHADER;
+    program->program = MDProgramCache::GetInstance().CreateProgram(
+        DUAL_FISHEYE_VERTEX_SHADER, fragment_source.c_str(),
+        {"a_Position", "a_TexCoordinate", "a_TexCoordinate2", "a_BlendWeight"});
+    if (program->program == 0) {
+        MD_LOGE("MDDualFisheyeProgram: create program failed, vr=%d", vr);
+        return nullptr;
+    }
+    program->mvp_matrix_loc = glGetUniformLocation(program->program, "u_MVPMatrix");
+    program->st_matrix_loc = glGetUniformLocation(program->program, "u_STMatrix");
+    program->texture_loc = glGetUniformLocation(program->program, "u_Texture");
+    program->distortion_params_loc = glGetUniformLocation(program->program, "u_DistortionParams");
+    return program;
+}
+
+int MDDualFisheyeProgram::Use(const float* mvp_matrix, const float* st_matrix, GLuint texture_id,
+                              const float* distortion_params) {
+    Program* program = GetProgram(distortion_params != nullptr);
+    if (program == nullptr) {
+        return MD_ERR;
+    }
+    glUseProgram(program->program);
+    glUniformMatrix4fv(program->mvp_matrix_loc, 1, GL_FALSE, mvp_matrix);
+    glUniformMatrix4fv(program->st_matrix_loc, 1, GL_FALSE, st_matrix);
+    if (distortion_params != nullptr) {
+        glUniform4f(program->distortion_params_loc, distortion_params[0], distortion_params[1],
+                    distortion_params[2], distortion_params[3]);
+    }
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_EXTERNAL_OES, texture_id);
+    glUniform1i(program->texture_loc, 0);
+    return MD_OK;
+}
+
+void MDDualFisheyeProgram::Destroy() {
+    for (Program& program : programs_) {
+        if (program.program != 0) {
+            glDeleteProgram(program.program);
+        }
+        program = Program();
+    }
+}
+
+}
+}
@@ -0,0 +1,47 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef MD360PLAYER4OH_MD_DUAL_FISHEYE_PROGRAM_H
+#define MD360PLAYER4OH_MD_DUAL_FISHEYE_PROGRAM_H
+
+#include <GLES3/gl3.h>
+
+namespace asha {
+namespace vrlib {
+
+// 双鱼眼网格的着色器程序：顶点带两个镜头的纹理坐标和镜头0的混合权重（MDMeshGenerator::GenerateDualFisheye），
+// 只在一个镜头视场内的片元采样一次，接缝带里采样两个镜头按权重混合；所有接口只能在GL线程调用
+class MDDualFisheyeProgram {
+public:
+    MDDualFisheyeProgram() = default;
+    ~MDDualFisheyeProgram() = default;
+
+    // 启用程序并设置 uniform，之后由 MDObject3D::Draw 绘制网格。distortion_params 非空时（VR模式）
+    // 与VR着色器一样对两组纹理坐标做桶形畸变
+    int Use(const float* mvp_matrix, const float* st_matrix, GLuint texture_id, const float* distortion_params);
+
+    void Destroy();
+
+private:
+    // 程序按 [VR] 区分，用到时再创建
+    struct Program {
+        GLuint program = 0;
+        GLint mvp_matrix_loc = -1;
+        GLint st_matrix_loc = -1;
+        GLint texture_loc = -1;
+        GLint distortion_params_loc = -1;
+    };
+
+    Program* GetProgram(bool vr);
+
+private:
+    Program programs_[2];
+};
+
+}
+}
+
+#endif //MD360PLAYER4OH_MD_DUAL_FISHEYE_PROGRAM_H
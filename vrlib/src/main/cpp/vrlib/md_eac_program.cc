@@ -0,0 +1,122 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#include "md_eac_program.h"
+#include <GLES2/gl2ext.h>
+#include <string>
+#include "md_cube_layout.h"
+#include "md_defines.h"
+#include "md_log.h"
+#include "md_program_cache.h"
+
+namespace asha {
+namespace vrlib {
+
+// 纹理坐标变换（u_STMatrix）要在等角变换之后做，顶点着色器只传画面坐标
+static const char* EAC_VERTEX_SHADER = R"(
+    attribute vec4 a_Position;
+    attribute vec2 a_TexCoordinate;
+    uniform mat4 u_MVPMatrix;
+    varying vec2 vFrameCoord;
+    void main() {
+        vFrameCoord = a_TexCoordinate;
+        gl_Position = u_MVPMatrix * a_Position;
+    }
+)";
+
+// u_CubeParams：列数、行数、边距（MDCubeLayout）。面内坐标先换回切线坐标 [-1, 1]，按 atan 等分角度后放回格子；
+// 等角变换在每个轴上是奇函数，面的旋转只交换、翻转轴，所以不需要知道是哪个面。格子边界（切线坐标 ±1）变换后不变，
+// 插值落到相邻格子里也是同一条边。MD_DISTORTION 由 GetProgram 定义；找格子和变换需要 highp
+static const char* EAC_FRAGMENT_SHADER = R"(
+    #extension GL_OES_EGL_image_external : require
+    precision highp float;
+    varying vec2 vFrameCoord;
+    uniform samplerExternalOES u_Texture;
+    uniform mat4 u_STMatrix;
+    uniform vec3 u_CubeParams;
+    uniform vec4 u_DistortionParams;
+    const float PI = 3.14159265;
+
+    void main() {
+        vec2 grid = u_CubeParams.xy;
+        float halfSize = 0.5 - u_CubeParams.z;
+        vec2 cell = clamp(floor(vFrameCoord * grid), vec2(0.0), grid - 1.0);
+        vec2 tangent = clamp((vFrameCoord * grid - cell - 0.5) / halfSize, -1.0, 1.0);
+        vec2 local = atan(tangent) * (4.0 / PI) * halfSize + 0.5;
+        vec2 texCoord = (u_STMatrix * vec4((cell + local) / grid, 0.0, 1.0)).xy;
+    #ifdef MD_DISTORTION
+        if (u_DistortionParams.y != 0.0) {
+            vec2 coords = texCoord - vec2(0.5);
+            float rSq = coords.x * coords.x + coords.y * coords.y;
+            texCoord = coords * (u_DistortionParams.x + u_DistortionParams.y * rSq) + vec2(0.5);
+        }
+        if (texCoord.x < 0.0 || texCoord.x > 1.0 || texCoord.y < 0.0 || texCoord.y > 1.0) {
+            gl_FragColor = vec4(0.0, 0.0, 0.0, 1.0);
+            return;
+        }
+    #endif
+        gl_FragColor = texture2D(u_Texture, texCoord);
+    }
+)";
+
+MDEacProgram::Program* MDEacProgram::GetProgram(bool vr) {
+    Program* program = &programs_[vr ? 1 : 0];
+    if (program->program != 0) {
+        return program;
+    }
+    std::string fragment_source;
+    if (vr) {
+        fragment_source += "#define MD_DISTORTION\n";
+    }
+    fragment_source += EAC_FRAGMENT_SHADER;
+    program->program = MDProgramCache::GetInstance().CreateProgram(EAC_VERTEX_SHADER, fragment_source.c_str(),
+                                                                   {"a_Position", "a_TexCoordinate"});
+    if (program->program == 0) {
+        MD_LOGE("MDEacProgram: create program failed, vr=%d", vr);
+        return nullptr;
+    }
+    program->mvp_matrix_loc = glGetUniformLocation(program->program, "u_MVPMatrix");
+    program->st_matrix_loc = glGetUniformLocation(program->program, "u_STMatrix");
+    program->texture_loc = glGetUniformLocation(program->program, "u_Texture");
+    program->cube_params_loc = glGetUniformLocation(program->program, "u_CubeParams");
+    program->distortion_params_loc = glGetUniformLocation(program->program, "u_DistortionParams");
+    return program;
+}
+
+int MDEacProgram::Use(const float* mvp_matrix, const float* st_matrix, GLuint texture_id, int layout, float padding,
+                      const float* distortion_params) {
+    Program* program = GetProgram(distortion_params != nullptr);
+    if (program == nullptr) {
+        return MD_ERR;
+    }
+    int columns = 0;
+    int rows = 0;
+    MDCubeLayout::GetGrid(layout, &columns, &rows);
+    glUseProgram(program->program);
+    glUniformMatrix4fv(program->mvp_matrix_loc, 1, GL_FALSE, mvp_matrix);
+    glUniformMatrix4fv(program->st_matrix_loc, 1, GL_FALSE, st_matrix);
+    glUniform3f(program->cube_params_loc, static_cast<float>(columns), static_cast<float>(rows), padding);
+    if (distortion_params != nullptr) {
+        glUniform4f(program->distortion_params_loc, distortion_params[0], distortion_params[1],
+                    distortion_params[2], distortion_params[3]);
+    }
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_EXTERNAL_OES, texture_id);
+    glUniform1i(program->texture_loc, 0);
+    return MD_OK;
+}
+
+void MDEacProgram::Destroy() {
+    for (Program& program : programs_) {
+        if (program.program != 0) {
+            glDeleteProgram(program.program);
+        }
+        program = Program();
+    }
+}
+
+}
+}
@@ -0,0 +1,49 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef MD360PLAYER4OH_MD_EAC_PROGRAM_H
+#define MD360PLAYER4OH_MD_EAC_PROGRAM_H
+
+#include <GLES3/gl3.h>
+
+namespace asha {
+namespace vrlib {
+
+// EAC（等角立方体贴图）的着色器程序：立方体网格的纹理坐标在面内与切线坐标成线性（MDMeshGenerator::GenerateCube），
+// 片元着色器找出所在的格子，把面内坐标按 MDCubeLayout::EquiAngular 变换后再采样；所有接口只能在GL线程调用
+class MDEacProgram {
+public:
+    MDEacProgram() = default;
+    ~MDEacProgram() = default;
+
+    // 启用程序并设置 uniform，之后由 MDObject3D::Draw 绘制网格。layout、padding 与生成网格时相同；
+    // distortion_params 非空时（VR模式）与VR着色器一样做桶形畸变
+    int Use(const float* mvp_matrix, const float* st_matrix, GLuint texture_id, int layout, float padding,
+            const float* distortion_params);
+
+    void Destroy();
+
+private:
+    // 程序按 [VR] 区分，用到时再创建
+    struct Program {
+        GLuint program = 0;
+        GLint mvp_matrix_loc = -1;
+        GLint st_matrix_loc = -1;
+        GLint texture_loc = -1;
+        GLint cube_params_loc = -1;
+        GLint distortion_params_loc = -1;
+    };
+
+    Program* GetProgram(bool vr);
+
+private:
+    Program programs_[2];
+};
+
+}
+}
+
+#endif //MD360PLAYER4OH_MD_EAC_PROGRAM_H
@@ -0,0 +1,86 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#include "md_fake_frame_clock.h"
+#include "md_defines.h"
+
+namespace asha {
+namespace vrlib {
+
+MDFakeFrameClock::MDFakeFrameClock(int64_t period_ns) : period_ns_(period_ns) {
+}
+
+int MDFakeFrameClock::Start() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    running_ = true;
+    return MD_OK;
+}
+
+void MDFakeFrameClock::Stop() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    running_ = false;
+    cv_.notify_all();
+}
+
+int MDFakeFrameClock::WaitForNextFrame(int64_t* vsync_ns) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this]() { return !running_ || vsync_serial_ != consumed_serial_; });
+    if (!running_) {
+        return MD_ERR;
+    }
+    consumed_serial_ = vsync_serial_;
+    if (vsync_ns != nullptr) {
+        *vsync_ns = last_vsync_ns_;
+    }
+    return MD_OK;
+}
+
+int64_t MDFakeFrameClock::GetFramePeriodNs() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return estimate_period_ ? estimator_.GetPeriodNs() : period_ns_;
+}
+
+int64_t MDFakeFrameClock::NowNs() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return now_ns_;
+}
+
+void MDFakeFrameClock::Advance(int64_t delta_ns) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    now_ns_ += delta_ns;
+}
+
+void MDFakeFrameClock::Tick() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // 下一个vsync对齐到周期网格上，且不早于当前时间
+    int64_t next = last_vsync_ns_ + period_ns_;
+    while (next < now_ns_) {
+        next += period_ns_;
+    }
+    last_vsync_ns_ = next;
+    now_ns_ = next;
+    if (estimate_period_) {
+        estimator_.OnVsync(next);
+    }
+    vsync_serial_++;
+    cv_.notify_all();
+}
+
+void MDFakeFrameClock::SetFramePeriodNs(int64_t period_ns) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (period_ns > 0) {
+        period_ns_ = period_ns;
+    }
+}
+
+void MDFakeFrameClock::EnablePeriodEstimation(int64_t initial_period_ns) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    estimate_period_ = true;
+    estimator_.Reset(initial_period_ns);
+}
+
+}
+}
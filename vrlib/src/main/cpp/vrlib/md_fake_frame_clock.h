@@ -0,0 +1,52 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef MD360PLAYER4OH_MD_FAKE_FRAME_CLOCK_H
+#define MD360PLAYER4OH_MD_FAKE_FRAME_CLOCK_H
+
+#include <cstdint>
+#include <mutex>
+#include <condition_variable>
+#include "md_frame_clock.h"
+#include "md_vsync_period_estimator.h"
+
+namespace asha {
+namespace vrlib {
+
+// 用于主机侧测试的假时钟：时间和vsync都由测试代码手动推进
+class MDFakeFrameClock : public MDFrameClock {
+public:
+    explicit MDFakeFrameClock(int64_t period_ns = MD_DEFAULT_FRAME_PERIOD_NS);
+    int Start() override;
+    void Stop() override;
+    int WaitForNextFrame(int64_t* vsync_ns) override;
+    int64_t GetFramePeriodNs() override;
+    int64_t NowNs() override;
+public:
+    // 推进当前时间（模拟渲染耗时）
+    void Advance(int64_t delta_ns);
+    // 触发下一个vsync，唤醒等待中的渲染线程
+    void Tick();
+    void SetFramePeriodNs(int64_t period_ns);
+    // 模拟拿不到 GetPeriod 的设备：上报的周期由vsync间隔估计，initial_period_ns 为估计的初始值
+    void EnablePeriodEstimation(int64_t initial_period_ns);
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    int64_t now_ns_ = 0;
+    int64_t period_ns_ = MD_DEFAULT_FRAME_PERIOD_NS;
+    int64_t last_vsync_ns_ = 0;
+    uint64_t vsync_serial_ = 0;
+    uint64_t consumed_serial_ = 0;
+    bool running_ = false;
+    bool estimate_period_ = false;
+    MDVsyncPeriodEstimator estimator_;
+};
+
+}
+}
+
+#endif //MD360PLAYER4OH_MD_FAKE_FRAME_CLOCK_H
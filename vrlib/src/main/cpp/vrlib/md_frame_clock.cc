@@ -0,0 +1,158 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#include "md_frame_clock.h"
+#include "md_log.h"
+#include "md_defines.h"
+#include "md_vsync_period_estimator.h"
+#include <native_vsync/native_vsync.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <cstring>
+#include <thread>
+
+namespace asha {
+namespace vrlib {
+
+int64_t MDNowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static const char* VSYNC_NAME = "MDVRLibrary";
+// 等待vsync的超时倍数，超时后按周期合成vsync，避免渲染线程永久阻塞
+static const int VSYNC_TIMEOUT_PERIODS = 4;
+
+class MDVsyncFrameClock : public MDFrameClock {
+public:
+    virtual ~MDVsyncFrameClock() {
+        Stop();
+    }
+
+    virtual int Start() override {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (vsync_ != nullptr) {
+            return MD_OK;
+        }
+        vsync_ = OH_NativeVSync_Create(VSYNC_NAME, strlen(VSYNC_NAME));
+        if (vsync_ == nullptr) {
+            MD_LOGW("MDVsyncFrameClock::Start: OH_NativeVSync_Create failed, fallback to timer pacing");
+            return MD_ERR;
+        }
+        long long period = 0;
+        system_period_ = OH_NativeVSync_GetPeriod(vsync_, &period) == 0 && period > 0;
+        if (system_period_) {
+            period_ns_ = period;
+        } else {
+            estimator_.Reset(period_ns_);
+        }
+        MD_LOGI("MDVsyncFrameClock::Start: vsync period=%lld ns (%s)", (long long)period_ns_,
+                system_period_ ? "system" : "estimated");
+        return MD_OK;
+    }
+
+    virtual void Stop() override {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (vsync_ == nullptr) {
+            return;
+        }
+        // 等待已发出的请求回调完成，避免回调访问已销毁的对象
+        cv_.wait_for(lock, std::chrono::nanoseconds(period_ns_ * VSYNC_TIMEOUT_PERIODS),
+                     [this]() { return !request_pending_; });
+        OH_NativeVSync_Destroy(vsync_);
+        vsync_ = nullptr;
+        request_pending_ = false;
+    }
+
+    virtual int WaitForNextFrame(int64_t* vsync_ns) override {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (vsync_ == nullptr) {
+            lock.unlock();
+            return WaitForTimerFrame(vsync_ns);
+        }
+        uint64_t serial = vsync_serial_;
+        if (!request_pending_) {
+            if (OH_NativeVSync_RequestFrame(vsync_, MDVsyncFrameClock::OnVsync, this) != 0) {
+                lock.unlock();
+                return WaitForTimerFrame(vsync_ns);
+            }
+            request_pending_ = true;
+        }
+        bool signaled = cv_.wait_for(lock, std::chrono::nanoseconds(period_ns_ * VSYNC_TIMEOUT_PERIODS),
+                                     [this, serial]() { return vsync_serial_ != serial; });
+        if (!signaled) {
+            lock.unlock();
+            MD_LOGW("MDVsyncFrameClock::WaitForNextFrame: vsync timeout, synthesize frame");
+            return WaitForTimerFrame(vsync_ns);
+        }
+        if (vsync_ns != nullptr) {
+            *vsync_ns = last_vsync_ns_;
+        }
+        return MD_OK;
+    }
+
+    virtual int64_t GetFramePeriodNs() override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return period_ns_;
+    }
+
+    virtual int64_t NowNs() override {
+        return MDNowNs();
+    }
+
+private:
+    static void OnVsync(long long timestamp, void* data) {
+        auto clock = reinterpret_cast<MDVsyncFrameClock*>(data);
+        std::lock_guard<std::mutex> lock(clock->mutex_);
+        // 没有 GetPeriod 的设备上才用vsync间隔校正周期
+        if (!clock->system_period_) {
+            clock->period_ns_ = clock->estimator_.OnVsync(timestamp);
+        }
+        clock->last_vsync_ns_ = timestamp;
+        clock->vsync_serial_++;
+        clock->request_pending_ = false;
+        clock->cv_.notify_all();
+    }
+
+    // 没有可用的vsync时，按周期对齐到下一个时间点
+    int WaitForTimerFrame(int64_t* vsync_ns) {
+        int64_t period = GetFramePeriodNs();
+        int64_t now = MDNowNs();
+        int64_t next = timer_vsync_ns_ + period;
+        if (next <= now) {
+            next = now + period - (now - timer_vsync_ns_) % period;
+            if (timer_vsync_ns_ == 0) {
+                next = now;
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::nanoseconds(next - now));
+        timer_vsync_ns_ = next;
+        if (vsync_ns != nullptr) {
+            *vsync_ns = next;
+        }
+        return MD_OK;
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    OH_NativeVSync* vsync_ = nullptr;
+    int64_t period_ns_ = MD_DEFAULT_FRAME_PERIOD_NS;
+    int64_t last_vsync_ns_ = 0;
+    int64_t timer_vsync_ns_ = 0;
+    bool system_period_ = false;  // 周期来自 OH_NativeVSync_GetPeriod，不再按回调间隔估计
+    MDVsyncPeriodEstimator estimator_;
+    uint64_t vsync_serial_ = 0;
+    bool request_pending_ = false;
+};
+
+std::shared_ptr<MDFrameClock> MDFrameClock::CreateVsyncClock() {
+    return std::make_shared<MDVsyncFrameClock>();
+}
+
+}
+}
@@ -0,0 +1,41 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef MD360PLAYER4OH_MD_FRAME_CLOCK_H
+#define MD360PLAYER4OH_MD_FRAME_CLOCK_H
+
+#include <cstdint>
+#include <memory>
+
+namespace asha {
+namespace vrlib {
+
+// 默认刷新周期（60Hz），在拿到真实的vsync周期之前使用
+constexpr int64_t MD_DEFAULT_FRAME_PERIOD_NS = 16666667LL;
+
+// 单调时钟（CLOCK_MONOTONIC），与 NativeVSync 时间戳处于同一时间域
+int64_t MDNowNs();
+
+// 帧时钟：渲染循环通过它等待下一个vsync
+class MDFrameClock {
+public:
+    virtual ~MDFrameClock() = default;
+    virtual int Start() = 0;
+    virtual void Stop() = 0;
+    // 阻塞到下一个vsync，输出该vsync的时间戳（ns）
+    virtual int WaitForNextFrame(int64_t* vsync_ns) = 0;
+    // 当前面板刷新周期（ns）
+    virtual int64_t GetFramePeriodNs() = 0;
+    virtual int64_t NowNs() = 0;
+public:
+    // 基于 OH_NativeVSync 回调的实现，创建失败时退化为按周期定时
+    static std::shared_ptr<MDFrameClock> CreateVsyncClock();
+};
+
+}
+}
+
+#endif //MD360PLAYER4OH_MD_FRAME_CLOCK_H
@@ -0,0 +1,76 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#include "md_frame_scheduler.h"
+#include "md_log.h"
+#include "md_defines.h"
+
+namespace asha {
+namespace vrlib {
+
+MDFrameScheduler::MDFrameScheduler(std::shared_ptr<MDFrameClock> clock) : clock_(clock) {
+    if (clock_ == nullptr) {
+        clock_ = MDFrameClock::CreateVsyncClock();
+    }
+}
+
+int MDFrameScheduler::Start() {
+    int ret = clock_->Start();
+    frame_period_ns_ = clock_->GetFramePeriodNs();
+    return ret;
+}
+
+void MDFrameScheduler::Stop() {
+    clock_->Stop();
+}
+
+int MDFrameScheduler::BeginFrame() {
+    int64_t vsync_ns = 0;
+    int ret = clock_->WaitForNextFrame(&vsync_ns);
+    int64_t period = clock_->GetFramePeriodNs();
+    int64_t now = clock_->NowNs();
+    frame_period_ns_ = period;
+
+    // 如果被唤醒得太晚（vsync回调排队），把vsync对齐到当前所在的周期
+    if (period > 0 && now - vsync_ns > period) {
+        vsync_ns += ((now - vsync_ns) / period) * period;
+    }
+    vsync_ns_ = vsync_ns;
+    frame_start_ns_ = now;
+    deadline_ns_ = vsync_ns + period;
+    return ret;
+}
+
+bool MDFrameScheduler::EndFrame() {
+    uint64_t frames = ++frame_count_;
+    int64_t now = clock_->NowNs();
+    if (now <= deadline_ns_) {
+        return true;
+    }
+    uint64_t missed = ++missed_deadline_count_;
+    // 避免日志刷屏：前几次和之后每60次打印一次
+    if (missed <= 3 || missed % 60 == 0) {
+        MD_LOGW("MDFrameScheduler: frame %llu missed deadline by %.2f ms (missed %llu, period %.2f ms)",
+                (unsigned long long)frames, (now - deadline_ns_) / 1000000.0,
+                (unsigned long long)missed, frame_period_ns_.load() / 1000000.0);
+    }
+    return false;
+}
+
+int64_t MDFrameScheduler::GetRemainingBudgetNs() {
+    return deadline_ns_ - clock_->NowNs();
+}
+
+MDFrameSchedulerStats MDFrameScheduler::GetStats() const {
+    MDFrameSchedulerStats stats;
+    stats.frames = frame_count_.load();
+    stats.missed_deadlines = missed_deadline_count_.load();
+    stats.frame_period_ns = frame_period_ns_.load();
+    return stats;
+}
+
+}
+}
@@ -0,0 +1,58 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef MD360PLAYER4OH_MD_FRAME_SCHEDULER_H
+#define MD360PLAYER4OH_MD_FRAME_SCHEDULER_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include "md_frame_clock.h"
+
+namespace asha {
+namespace vrlib {
+
+struct MDFrameSchedulerStats {
+    uint64_t frames = 0;
+    uint64_t missed_deadlines = 0;
+    int64_t frame_period_ns = 0;
+};
+
+// 帧调度器：每帧在vsync上唤醒，以下一个vsync作为本帧截止时间
+// 只在GL线程中调用 BeginFrame/EndFrame，统计数据可在任意线程读取
+class MDFrameScheduler {
+public:
+    explicit MDFrameScheduler(std::shared_ptr<MDFrameClock> clock);
+    int Start();
+    void Stop();
+    // 等待下一个vsync，开始新的一帧
+    int BeginFrame();
+    // 本帧提交完成，检查是否超出截止时间；返回是否按时完成
+    bool EndFrame();
+
+    int64_t GetFrameStartNs() const { return frame_start_ns_; }
+    int64_t GetDeadlineNs() const { return deadline_ns_; }
+    // 预计本帧画面上屏的vsync时间
+    int64_t GetNextVsyncNs() const { return deadline_ns_; }
+    int64_t GetFramePeriodNs() const { return frame_period_ns_.load(); }
+    int64_t GetRemainingBudgetNs();
+    std::shared_ptr<MDFrameClock> GetClock() const { return clock_; }
+    MDFrameSchedulerStats GetStats() const;
+
+private:
+    std::shared_ptr<MDFrameClock> clock_;
+    int64_t vsync_ns_ = 0;
+    int64_t frame_start_ns_ = 0;
+    int64_t deadline_ns_ = 0;
+    std::atomic<int64_t> frame_period_ns_{MD_DEFAULT_FRAME_PERIOD_NS};
+    std::atomic<uint64_t> frame_count_{0};
+    std::atomic<uint64_t> missed_deadline_count_{0};
+};
+
+}
+}
+
+#endif //MD360PLAYER4OH_MD_FRAME_SCHEDULER_H
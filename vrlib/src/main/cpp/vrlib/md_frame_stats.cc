@@ -0,0 +1,159 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#include "md_frame_stats.h"
+#include "md_frame_clock.h"
+
+namespace asha {
+namespace vrlib {
+
+static const char* STAGE_NAMES[MD_STAGE_COUNT] = {
+    "eglPrepare",
+    "makeCurrent",
+    "updateSurface",
+    "drawFrame",
+    "renderEyeLeft",
+    "renderEyeRight",
+    "swapBuffer",
+    "reproject",
+    "gpuFrame",
+    "poseAge",
+    "predictionHorizon",
+    "resumeToFirstFrame",
+    "frameTotal",
+};
+
+int MDLatencyHistogram::BucketIndex(int64_t duration_us) {
+    if (duration_us < SUB_BUCKETS) {
+        return duration_us < 0 ? 0 : static_cast<int>(duration_us);
+    }
+    // 最高位所在的段，再取其后 SUB_BUCKET_BITS 位作为段内序号
+    int msb = 63 - __builtin_clzll(static_cast<uint64_t>(duration_us));
+    int octave = msb - SUB_BUCKET_BITS + 1;
+    int sub = static_cast<int>((duration_us >> (msb - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1));
+    int index = octave * SUB_BUCKETS + sub;
+    return index < BUCKET_COUNT - 1 ? index : BUCKET_COUNT - 1;
+}
+
+int64_t MDLatencyHistogram::BucketUpperBoundUs(int index) {
+    if (index < SUB_BUCKETS) {
+        return index + 1;
+    }
+    int octave = index / SUB_BUCKETS;
+    int sub = index % SUB_BUCKETS;
+    int shift = octave - 1;
+    return (static_cast<int64_t>(SUB_BUCKETS + sub + 1) << shift);
+}
+
+void MDLatencyHistogram::Record(int64_t duration_ns) {
+    if (duration_ns < 0) {
+        duration_ns = 0;
+    }
+    buckets_[BucketIndex(duration_ns / 1000)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sum_ns_.fetch_add(static_cast<uint64_t>(duration_ns), std::memory_order_relaxed);
+    int64_t current_max = max_ns_.load(std::memory_order_relaxed);
+    while (duration_ns > current_max &&
+           !max_ns_.compare_exchange_weak(current_max, duration_ns, std::memory_order_relaxed)) {
+    }
+}
+
+void MDLatencyHistogram::Reset() {
+    for (int i = 0; i < BUCKET_COUNT; i++) {
+        buckets_[i].store(0, std::memory_order_relaxed);
+    }
+    count_.store(0, std::memory_order_relaxed);
+    sum_ns_.store(0, std::memory_order_relaxed);
+    max_ns_.store(0, std::memory_order_relaxed);
+}
+
+double MDLatencyHistogram::PercentileMs(const uint64_t* counts, uint64_t total, double percentile) const {
+    uint64_t target = static_cast<uint64_t>(total * percentile + 0.5);
+    if (target == 0) {
+        target = 1;
+    }
+    uint64_t seen = 0;
+    double max_ms = max_ns_.load(std::memory_order_relaxed) / 1000000.0;
+    for (int i = 0; i < BUCKET_COUNT; i++) {
+        seen += counts[i];
+        if (seen >= target) {
+            if (i == BUCKET_COUNT - 1) {
+                return max_ms;
+            }
+            // 取桶的上界，且不超过实际记录到的最大值
+            double upper_ms = BucketUpperBoundUs(i) / 1000.0;
+            return upper_ms < max_ms ? upper_ms : max_ms;
+        }
+    }
+    return max_ms;
+}
+
+void MDLatencyHistogram::GetStats(MDStageStats* stats) const {
+    uint64_t counts[BUCKET_COUNT];
+    uint64_t total = 0;
+    for (int i = 0; i < BUCKET_COUNT; i++) {
+        counts[i] = buckets_[i].load(std::memory_order_relaxed);
+        total += counts[i];
+    }
+    stats->count = total;
+    if (total == 0) {
+        stats->avg_ms = stats->p50_ms = stats->p95_ms = stats->p99_ms = stats->max_ms = 0.0;
+        return;
+    }
+    uint64_t count = count_.load(std::memory_order_relaxed);
+    stats->avg_ms = count > 0 ? sum_ns_.load(std::memory_order_relaxed) / 1000000.0 / count : 0.0;
+    stats->p50_ms = PercentileMs(counts, total, 0.50);
+    stats->p95_ms = PercentileMs(counts, total, 0.95);
+    stats->p99_ms = PercentileMs(counts, total, 0.99);
+    stats->max_ms = max_ns_.load(std::memory_order_relaxed) / 1000000.0;
+}
+
+void MDFrameStats::Record(MDFrameStage stage, int64_t duration_ns) {
+    if (stage < 0 || stage >= MD_STAGE_COUNT) {
+        return;
+    }
+    histograms_[stage].Record(duration_ns);
+}
+
+void MDFrameStats::Reset() {
+    for (int i = 0; i < MD_STAGE_COUNT; i++) {
+        histograms_[i].Reset();
+    }
+}
+
+void MDFrameStats::GetSnapshot(std::vector<MDStageStats>* stages) const {
+    if (stages == nullptr) {
+        return;
+    }
+    stages->clear();
+    stages->reserve(MD_STAGE_COUNT);
+    for (int i = 0; i < MD_STAGE_COUNT; i++) {
+        MDStageStats stats;
+        stats.name = STAGE_NAMES[i];
+        histograms_[i].GetStats(&stats);
+        stages->push_back(stats);
+    }
+}
+
+const char* MDFrameStats::StageName(MDFrameStage stage) {
+    if (stage < 0 || stage >= MD_STAGE_COUNT) {
+        return "unknown";
+    }
+    return STAGE_NAMES[stage];
+}
+
+MDScopedStageTimer::MDScopedStageTimer(MDFrameStats* stats, MDFrameStage stage)
+    : stats_(stats), stage_(stage), start_ns_(MDNowNs()) {
+}
+
+MDScopedStageTimer::~MDScopedStageTimer() {
+    if (stats_ != nullptr) {
+        stats_->Record(stage_, MDNowNs() - start_ns_);
+    }
+}
+
+}
+}
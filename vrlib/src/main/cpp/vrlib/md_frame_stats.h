@@ -0,0 +1,165 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef MD360PLAYER4OH_MD_FRAME_STATS_H
+#define MD360PLAYER4OH_MD_FRAME_STATS_H
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace asha {
+namespace vrlib {
+
+// RunGL 中被计时的阶段（CPU 侧耗时，GPU 异步执行的部分体现在 SwapBuffer 上）
+enum MDFrameStage {
+    MD_STAGE_EGL_PREPARE = 0,
+    MD_STAGE_MAKE_CURRENT,
+    MD_STAGE_UPDATE_SURFACE,
+    MD_STAGE_DRAW_FRAME,
+    MD_STAGE_RENDER_EYE_LEFT,
+    MD_STAGE_RENDER_EYE_RIGHT,
+    MD_STAGE_SWAP_BUFFER,
+    MD_STAGE_REPROJECT,
+    MD_STAGE_GPU_FRAME,      // 完整渲染的GPU耗时（开启动态分辨率且设备支持 timer query 时才记录）
+    MD_STAGE_POSE_AGE,       // 不是耗时阶段：姿态从采样到被 late latch 使用的延迟
+    MD_STAGE_PREDICTION_HORIZON,  // 不是耗时阶段：姿态预测实际向前外推的时长
+    MD_STAGE_RESUME_FIRST_FRAME,  // 不是每帧的阶段：从 Resume 到恢复后第一帧交换完成的耗时
+    MD_STAGE_FRAME_TOTAL,
+    MD_STAGE_COUNT
+};
+
+// 单个阶段的统计结果（单位：毫秒）
+struct MDStageStats {
+    const char* name = "";
+    uint64_t count = 0;
+    double avg_ms = 0.0;
+    double p50_ms = 0.0;
+    double p95_ms = 0.0;
+    double p99_ms = 0.0;
+    double max_ms = 0.0;
+};
+
+// 完整渲染与重投影的帧数
+struct MDReprojectionStats {
+    uint64_t rendered_frames = 0;
+    uint64_t reprojected_frames = 0;
+};
+
+// 视频出图节奏：估计的片源帧率、是否按片源节奏出图，以及为此保持上一帧的vsync数
+struct MDVideoCadenceStats {
+    double source_fps = 0.0;
+    bool active = false;
+    uint64_t held_vsyncs = 0;
+};
+
+// 挂起/恢复：挂起次数、GPU资源当前是否已释放、最近一次恢复的重建耗时和恢复到首帧上屏的耗时（毫秒），
+// 以及进程内着色器程序二进制缓存的命中/未命中次数
+struct MDSuspendStats {
+    uint64_t suspend_count = 0;
+    bool gpu_released = false;
+    double last_rebuild_ms = 0.0;
+    double last_resume_to_first_frame_ms = 0.0;
+    uint64_t program_binary_hits = 0;
+    uint64_t program_binary_misses = 0;
+};
+
+// 动态分辨率的状态：当前缩放比例、调整次数，以及最近一次调整前后的帧耗时（毫秒）
+struct MDResolutionStats {
+    bool enabled = false;
+    bool gpu_timer_supported = false;  // false 时按CPU侧的渲染+交换耗时估计
+    float scale = 1.0f;
+    float min_scale = 1.0f;
+    float max_scale = 1.0f;
+    uint64_t scale_up_count = 0;
+    uint64_t scale_down_count = 0;
+    double frame_ms = 0.0;               // 当前的平滑帧耗时
+    double frame_ms_before_change = 0.0;
+    double frame_ms_after_change = 0.0;  // 调整后稳定下来的帧耗时，还没稳定时为0
+};
+
+// 投影网格的细分级别：是否自动选择、当前级别（MDMeshLodLevel）、当前网格的三角形数和级别切换次数
+struct MDMeshLodStats {
+    bool auto_select = true;
+    int level = 0;
+    int triangles = 0;
+    uint64_t switch_count = 0;
+};
+
+// 投影网格的视锥剔除：最近一次完整渲染中被剔除的三角形比例和绘制调用数（VR模式两只眼睛合计），以及累计的提交/剔除三角形数
+struct MDCullingStats {
+    bool enabled = true;
+    double culled_ratio = 0.0;
+    int draw_calls = 0;
+    uint64_t submitted_triangles = 0;
+    uint64_t culled_triangles = 0;
+};
+
+// 射线投射渲染：开启了射线投射的投影模式（第 i 位对应模式 201 + i）、最近一次完整渲染是否用了射线投射，
+// 以及射线投射的绘制次数（VR模式每只眼睛算一次）
+struct MDRayCastStats {
+    uint32_t mode_mask = 0;
+    bool active = false;
+    uint64_t draws = 0;
+};
+
+// 无锁耗时直方图：按2的幂分段，每段再线性细分，记录端只有原子加
+// 覆盖 1us ~ 约2s，超出范围的计入最后一个桶，最大值单独记录
+class MDLatencyHistogram {
+public:
+    static constexpr int SUB_BUCKET_BITS = 3;
+    static constexpr int SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+    static constexpr int OCTAVES = 19;
+    static constexpr int BUCKET_COUNT = OCTAVES * SUB_BUCKETS + 1;
+
+    void Record(int64_t duration_ns);
+    void Reset();
+    uint64_t GetCount() const { return count_.load(std::memory_order_relaxed); }
+    // 计算统计结果，可在任意线程调用（与记录并发时结果是近似值）
+    void GetStats(MDStageStats* stats) const;
+
+private:
+    static int BucketIndex(int64_t duration_us);
+    static int64_t BucketUpperBoundUs(int index);
+    double PercentileMs(const uint64_t* counts, uint64_t total, double percentile) const;
+
+private:
+    std::atomic<uint64_t> buckets_[BUCKET_COUNT] = {};
+    std::atomic<uint64_t> count_{0};
+    std::atomic<uint64_t> sum_ns_{0};
+    std::atomic<int64_t> max_ns_{0};
+};
+
+// 每个渲染器一份的分阶段耗时统计
+class MDFrameStats {
+public:
+    void Record(MDFrameStage stage, int64_t duration_ns);
+    void Reset();
+    void GetSnapshot(std::vector<MDStageStats>* stages) const;
+    static const char* StageName(MDFrameStage stage);
+
+private:
+    MDLatencyHistogram histograms_[MD_STAGE_COUNT];
+};
+
+// 作用域计时器：构造时记下开始时间，析构时写入对应阶段的直方图
+class MDScopedStageTimer {
+public:
+    MDScopedStageTimer(MDFrameStats* stats, MDFrameStage stage);
+    ~MDScopedStageTimer();
+    MDScopedStageTimer(const MDScopedStageTimer&) = delete;
+    MDScopedStageTimer& operator=(const MDScopedStageTimer&) = delete;
+
+private:
+    MDFrameStats* stats_;
+    MDFrameStage stage_;
+    int64_t start_ns_;
+};
+
+}
+}
+
+#endif //MD360PLAYER4OH_MD_FRAME_STATS_H
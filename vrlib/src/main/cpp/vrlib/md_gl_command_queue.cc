@@ -0,0 +1,101 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#include "md_gl_command_queue.h"
+#include "md_defines.h"
+#include "md_log.h"
+
+namespace asha {
+namespace vrlib {
+
+MDGLCommandQueue::MDGLCommandQueue(size_t capacity) : capacity_(capacity > 0 ? capacity : DEFAULT_CAPACITY) {
+    commands_.reserve(capacity_);
+    draining_.reserve(capacity_);
+}
+
+bool MDGLCommandQueue::IsCoalescable(MDGLCommandType type) {
+    return type != MD_GL_CMD_FLUSH;
+}
+
+int MDGLCommandQueue::Push(MDGLCommandType type, int arg, MDGLCommandCallback callback) {
+    int result = MD_OK;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (closed_) {
+            result = MD_ERR_CANCELLED;
+        } else {
+            if (IsCoalescable(type)) {
+                for (auto& command : commands_) {
+                    if (command.type == type) {
+                        command.arg = arg;
+                        if (callback) {
+                            command.callbacks.push_back(std::move(callback));
+                        }
+                        return MD_OK;
+                    }
+                }
+            }
+            if (commands_.size() >= capacity_) {
+                result = MD_ERR_QUEUE_FULL;
+            } else {
+                MDGLCommand command;
+                command.type = type;
+                command.arg = arg;
+                if (callback) {
+                    command.callbacks.push_back(std::move(callback));
+                }
+                commands_.push_back(std::move(command));
+                size_.store(commands_.size(), std::memory_order_release);
+            }
+        }
+    }
+    if (result != MD_OK) {
+        MD_LOGW("MDGLCommandQueue::Push: command %d dropped, result=%d", type, result);
+        if (callback) {
+            callback(result);
+        }
+    }
+    return result;
+}
+
+size_t MDGLCommandQueue::Drain(const std::function<int(const MDGLCommand&)>& executor) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (commands_.empty()) {
+            return 0;
+        }
+        draining_.swap(commands_);
+        size_.store(0, std::memory_order_release);
+    }
+    // 在锁外执行，回调里再入队也不会死锁
+    size_t count = draining_.size();
+    for (auto& command : draining_) {
+        int result = executor(command);
+        for (auto& callback : command.callbacks) {
+            callback(result);
+        }
+    }
+    draining_.clear();
+    return count;
+}
+
+void MDGLCommandQueue::Close(int result) {
+    std::vector<MDGLCommand> cancelled;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+        cancelled.swap(commands_);
+        size_.store(0, std::memory_order_release);
+    }
+    for (auto& command : cancelled) {
+        for (auto& callback : command.callbacks) {
+            callback(result);
+        }
+    }
+}
+
+}
+}
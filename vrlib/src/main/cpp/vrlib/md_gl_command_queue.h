@@ -0,0 +1,74 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef MD360PLAYER4OH_MD_GL_COMMAND_QUEUE_H
+#define MD360PLAYER4OH_MD_GL_COMMAND_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace asha {
+namespace vrlib {
+
+// 需要在GL线程中执行的命令
+enum MDGLCommandType {
+    MD_GL_CMD_SURFACE_CHANGED = 0,   // 窗口变化，重新查询surface尺寸（可合并）
+    MD_GL_CMD_SET_PROJECTION_MODE,   // 切换投影模式，重建3D对象（可合并，只执行最后一次的参数）
+    MD_GL_CMD_RESET_VR_RESOURCES,    // 切换VR模式后清理VR shader和离屏缓冲（可合并）
+    MD_GL_CMD_RELEASE_GPU_RESOURCES, // 挂起时释放大块GPU资源，恢复后的第一帧重建（可合并）
+    MD_GL_CMD_FLUSH,                 // 空命令，完成回调表示之前的命令都已执行（不合并）
+    MD_GL_CMD_COUNT
+};
+
+// 完成回调在GL线程中调用（队列关闭或已满时在调用 Push 的线程中调用），参数为执行结果
+using MDGLCommandCallback = std::function<void(int result)>;
+
+struct MDGLCommand {
+    MDGLCommandType type = MD_GL_CMD_FLUSH;
+    int arg = 0;
+    std::vector<MDGLCommandCallback> callbacks;  // 被合并掉的命令的回调也挂在这里
+};
+
+// 有界多生产者单消费者命令队列：任意线程 Push，GL线程每帧 Drain 一次
+// 同类型的可合并命令还没执行时，新命令只更新参数并追加回调，不会占用新的位置
+class MDGLCommandQueue {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 64;
+
+    explicit MDGLCommandQueue(size_t capacity = DEFAULT_CAPACITY);
+
+    // 入队，返回 MD_OK；队列已满返回 MD_ERR_QUEUE_FULL，已关闭返回 MD_ERR_CANCELLED（回调会立即以该结果调用）
+    int Push(MDGLCommandType type, int arg, MDGLCommandCallback callback = nullptr);
+
+    // GL线程：按入队顺序执行当前所有命令并调用完成回调，返回执行的命令数
+    // 执行期间新入队的命令留到下一次 Drain
+    size_t Drain(const std::function<int(const MDGLCommand&)>& executor);
+
+    // 不加锁，可以在渲染宿主持锁判断是否有工作时调用
+    bool IsEmpty() const { return size_.load(std::memory_order_acquire) == 0; }
+
+    // 关闭队列：未执行的命令以 result 完成，之后的 Push 直接失败
+    void Close(int result);
+
+private:
+    static bool IsCoalescable(MDGLCommandType type);
+
+private:
+    const size_t capacity_;
+    std::mutex mutex_;
+    std::vector<MDGLCommand> commands_;
+    std::vector<MDGLCommand> draining_;  // 只由消费者访问，复用容量避免每帧分配
+    std::atomic<size_t> size_{0};
+    bool closed_ = false;
+};
+
+}
+}
+
+#endif //MD360PLAYER4OH_MD_GL_COMMAND_QUEUE_H
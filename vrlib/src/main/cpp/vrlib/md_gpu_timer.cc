@@ -0,0 +1,97 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#include "md_gpu_timer.h"
+#include <cstring>
+#include <GLES2/gl2ext.h>
+#include "md_log.h"
+
+#ifndef GL_TIME_ELAPSED_EXT
+#define GL_TIME_ELAPSED_EXT 0x88BF
+#endif
+#ifndef GL_GPU_DISJOINT_EXT
+#define GL_GPU_DISJOINT_EXT 0x8FBB
+#endif
+
+namespace asha {
+namespace vrlib {
+
+void MDGpuTimer::Init() {
+    if (initialized_) {
+        return;
+    }
+    initialized_ = true;
+    const char* extensions = reinterpret_cast<const char*>(glGetString(GL_EXTENSIONS));
+    supported_ = extensions != nullptr && strstr(extensions, "GL_EXT_disjoint_timer_query") != nullptr;
+    if (supported_) {
+        glGenQueries(QUERY_COUNT, queries_);
+        // 读一次清掉之前的 disjoint 标记
+        GLint disjoint = 0;
+        glGetIntegerv(GL_GPU_DISJOINT_EXT, &disjoint);
+    }
+    MD_LOGI("MDGpuTimer::Init: timer query %s", supported_ ? "supported" : "not supported");
+}
+
+void MDGpuTimer::Begin() {
+    if (!supported_ || active_ || pending_[write_index_]) {
+        return;
+    }
+    glBeginQuery(GL_TIME_ELAPSED_EXT, queries_[write_index_]);
+    active_ = true;
+}
+
+void MDGpuTimer::End() {
+    if (!active_) {
+        return;
+    }
+    glEndQuery(GL_TIME_ELAPSED_EXT);
+    active_ = false;
+    pending_[write_index_] = true;
+    write_index_ = (write_index_ + 1) % QUERY_COUNT;
+}
+
+bool MDGpuTimer::Poll(int64_t* gpu_ns) {
+    if (!supported_) {
+        return false;
+    }
+    bool has_result = false;
+    while (pending_[read_index_]) {
+        GLuint available = 0;
+        glGetQueryObjectuiv(queries_[read_index_], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) {
+            break;
+        }
+        GLuint elapsed_ns = 0;
+        glGetQueryObjectuiv(queries_[read_index_], GL_QUERY_RESULT, &elapsed_ns);
+        pending_[read_index_] = false;
+        read_index_ = (read_index_ + 1) % QUERY_COUNT;
+        *gpu_ns = static_cast<int64_t>(elapsed_ns);
+        has_result = true;
+    }
+    // 期间发生过 GPU 降频等不连续事件时结果不可信，丢弃
+    GLint disjoint = 0;
+    glGetIntegerv(GL_GPU_DISJOINT_EXT, &disjoint);
+    return has_result && !disjoint;
+}
+
+void MDGpuTimer::Destroy() {
+    if (supported_) {
+        if (active_) {
+            glEndQuery(GL_TIME_ELAPSED_EXT);
+        }
+        glDeleteQueries(QUERY_COUNT, queries_);
+    }
+    memset(queries_, 0, sizeof(queries_));
+    memset(pending_, 0, sizeof(pending_));
+    initialized_ = false;
+    supported_ = false;
+    active_ = false;
+    write_index_ = 0;
+    read_index_ = 0;
+}
+
+}
+}
@@ -0,0 +1,47 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef MD360PLAYER4OH_MD_GPU_TIMER_H
+#define MD360PLAYER4OH_MD_GPU_TIMER_H
+
+#include <cstdint>
+#include <GLES3/gl3.h>
+
+namespace asha {
+namespace vrlib {
+
+// GPU耗时测量（GL_EXT_disjoint_timer_query）：多个查询轮流使用，结果晚几帧才读取，不会让CPU等GPU
+// 设备不支持该扩展时 IsSupported 返回 false，所有接口都是空操作；只能在GL线程调用
+class MDGpuTimer {
+public:
+    static constexpr int QUERY_COUNT = 4;
+
+    void Init();
+    bool IsSupported() const { return supported_; }
+
+    // 包住需要测量的GL命令；上一次的结果都还没读出时本次不测量
+    void Begin();
+    void End();
+
+    // 取出已经完成的测量，有新结果时返回 true 并写入最新一次的耗时
+    bool Poll(int64_t* gpu_ns);
+
+    void Destroy();
+
+private:
+    bool initialized_ = false;
+    bool supported_ = false;
+    bool active_ = false;
+    GLuint queries_[QUERY_COUNT] = {};
+    bool pending_[QUERY_COUNT] = {};
+    int write_index_ = 0;
+    int read_index_ = 0;
+};
+
+}
+}
+
+#endif //MD360PLAYER4OH_MD_GPU_TIMER_H
@@ -0,0 +1,24 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef MD360PLAYER4OH_MD_MATRIX_H
+#define MD360PLAYER4OH_MD_MATRIX_H
+
+namespace asha {
+namespace vrlib {
+
+// 4x4 矩阵运算（m[row * 4 + col] 存储，与渲染器的 MultiplyMatrix 相同），result 可以与输入相同
+class MDMatrix {
+public:
+    // 求逆，不可逆时返回 false 且不修改 result
+    static bool Invert(float* result, const float* m);
+    static void Multiply(float* result, const float* a, const float* b);
+};
+
+}
+}
+
+#endif //MD360PLAYER4OH_MD_MATRIX_H
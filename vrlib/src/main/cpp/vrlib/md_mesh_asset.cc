@@ -0,0 +1,267 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#include "md_mesh_asset.h"
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "md_defines.h"
+#include "md_mesh_optimizer.h"
+
+namespace asha {
+namespace vrlib {
+
+static size_t AlignUp4(size_t value) {
+    return (value + 3) & ~static_cast<size_t>(3);
+}
+
+MDMeshAsset::~MDMeshAsset() {
+    if (map_base_ != nullptr) {
+        munmap(map_base_, map_length_);
+        map_base_ = nullptr;
+    }
+}
+
+uint32_t MDMeshAsset::Checksum(const uint8_t* data, size_t size) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+std::shared_ptr<MDMeshAsset> MDMeshAsset::Open(int fd, int64_t offset, int64_t length, int* error) {
+    auto fail = [error](int code) {
+        if (error != nullptr) {
+            *error = code;
+        }
+        return std::shared_ptr<MDMeshAsset>();
+    };
+    if (fd < 0 || offset < 0 || length < static_cast<int64_t>(sizeof(MDMeshAssetHeader))) {
+        return fail(MD_ERR_ASSET_INVALID);
+    }
+    // 范围超出文件末尾时 mmap 仍然成功，之后访问末尾以外的页会收到 SIGBUS，所以先按文件大小检查
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        return fail(MD_ERR_ASSET_IO);
+    }
+    if (offset > static_cast<int64_t>(st.st_size) || length > static_cast<int64_t>(st.st_size) - offset) {
+        return fail(MD_ERR_ASSET_INVALID);
+    }
+    std::shared_ptr<MDMeshAsset> asset(new MDMeshAsset());
+    // mmap 的偏移必须按页对齐，资源在 fd 中的起点（rawfile 在安装包里的偏移）不一定对齐
+    int64_t page_size = sysconf(_SC_PAGESIZE);
+    int64_t map_offset = offset - offset % page_size;
+    size_t delta = static_cast<size_t>(offset - map_offset);
+    asset->map_length_ = static_cast<size_t>(length) + delta;
+    void* base = mmap(nullptr, asset->map_length_, PROT_READ, MAP_PRIVATE, fd, map_offset);
+    if (base == MAP_FAILED) {
+        return fail(MD_ERR_ASSET_IO);
+    }
+    asset->map_base_ = base;
+    asset->data_ = static_cast<const uint8_t*>(base) + delta;
+    asset->size_ = static_cast<size_t>(length);
+    if (reinterpret_cast<uintptr_t>(asset->data_) % 4 != 0) {
+        // 没对齐时按 float / uint32 读取不安全，复制一份后解除映射
+        asset->copy_.resize(AlignUp4(asset->size_) / 4);
+        memcpy(asset->copy_.data(), asset->data_, asset->size_);
+        munmap(asset->map_base_, asset->map_length_);
+        asset->map_base_ = nullptr;
+        asset->data_ = reinterpret_cast<const uint8_t*>(asset->copy_.data());
+    }
+    int ret = asset->Validate();
+    if (ret != MD_OK) {
+        return fail(ret);
+    }
+    return asset;
+}
+
+std::shared_ptr<MDMeshAsset> MDMeshAsset::Open(const char* path, int* error) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        if (error != nullptr) {
+            *error = MD_ERR_ASSET_IO;
+        }
+        return nullptr;
+    }
+    struct stat st;
+    std::shared_ptr<MDMeshAsset> asset;
+    if (fstat(fd, &st) == 0) {
+        asset = Open(fd, 0, st.st_size, error);
+    } else if (error != nullptr) {
+        *error = MD_ERR_ASSET_IO;
+    }
+    close(fd);
+    return asset;
+}
+
+int MDMeshAsset::Validate() {
+    const MDMeshAssetHeader* header = reinterpret_cast<const MDMeshAssetHeader*>(data_);
+    if (header->magic != MD_MESH_ASSET_MAGIC || header->version != MD_MESH_ASSET_VERSION ||
+        header->data_size != size_ - sizeof(MDMeshAssetHeader)) {
+        return MD_ERR_ASSET_INVALID;
+    }
+    if (Checksum(data_ + sizeof(MDMeshAssetHeader), header->data_size) != header->checksum) {
+        return MD_ERR_ASSET_INVALID;
+    }
+    size_t table_end = sizeof(MDMeshAssetHeader) + static_cast<size_t>(header->entry_count) * sizeof(MDMeshAssetEntry);
+    if (table_end > size_) {
+        return MD_ERR_ASSET_INVALID;
+    }
+    entries_ = reinterpret_cast<const MDMeshAssetEntry*>(data_ + sizeof(MDMeshAssetHeader));
+    entry_count_ = header->entry_count;
+    // 每个网格的数据都在文件内、4字节对齐，索引不越过顶点数，分块不越过索引数，之后取网格时不再检查
+    auto in_range = [this](uint32_t offset, size_t bytes) {
+        return offset % 4 == 0 && offset <= size_ && bytes <= size_ - offset;
+    };
+    for (uint32_t i = 0; i < entry_count_; i++) {
+        const MDMeshAssetEntry& entry = entries_[i];
+        if (entry.vertex_count == 0 || entry.vertex_count > MD_PRIMITIVE_RESTART_INDEX ||
+            !in_range(entry.vertex_offset, static_cast<size_t>(entry.vertex_count) * MD_MESH_VERTEX_STRIDE * 4) ||
+            !in_range(entry.index_offset, static_cast<size_t>(entry.index_count) * 2) ||
+            !in_range(entry.patch_offset, static_cast<size_t>(entry.patch_count) * sizeof(MDMeshAssetPatch))) {
+            return MD_ERR_ASSET_INVALID;
+        }
+        bool strip = (entry.flags & MD_MESH_ASSET_FLAG_TRIANGLE_STRIP) != 0;
+        const uint16_t* indices = reinterpret_cast<const uint16_t*>(data_ + entry.index_offset);
+        for (uint32_t k = 0; k < entry.index_count; k++) {
+            if (indices[k] >= entry.vertex_count && !(strip && indices[k] == MD_PRIMITIVE_RESTART_INDEX)) {
+                return MD_ERR_ASSET_INVALID;
+            }
+        }
+        const MDMeshAssetPatch* patches = reinterpret_cast<const MDMeshAssetPatch*>(data_ + entry.patch_offset);
+        for (uint32_t k = 0; k < entry.patch_count; k++) {
+            if (patches[k].first_index < 0 || patches[k].index_count < 0 ||
+                static_cast<uint32_t>(patches[k].first_index) + patches[k].index_count > entry.index_count) {
+                return MD_ERR_ASSET_INVALID;
+            }
+        }
+    }
+    return MD_OK;
+}
+
+std::shared_ptr<const MDMeshData> MDMeshAsset::FindMesh(int type, float radius, int rings, int sectors, float degree,
+                                                        bool triangle_strip) const {
+    uint32_t flags = triangle_strip ? MD_MESH_ASSET_FLAG_TRIANGLE_STRIP : 0;
+    for (uint32_t i = 0; i < entry_count_; i++) {
+        const MDMeshAssetEntry& entry = entries_[i];
+        if (entry.type != type || entry.radius != radius || entry.rings != rings || entry.sectors != sectors ||
+            entry.degree != degree || entry.flags != flags) {
+            continue;
+        }
+        auto mesh = std::make_shared<MDMeshData>();
+        mesh->triangle_strip = triangle_strip;
+        mesh->triangle_count = entry.triangle_count;
+        mesh->mapped_vertices = reinterpret_cast<const float*>(data_ + entry.vertex_offset);
+        mesh->mapped_vertex_count = static_cast<int>(entry.vertex_count);
+        mesh->mapped_indices = reinterpret_cast<const uint16_t*>(data_ + entry.index_offset);
+        mesh->mapped_index_count = static_cast<int>(entry.index_count);
+        mesh->mapping = shared_from_this();
+        const MDMeshAssetPatch* patches = reinterpret_cast<const MDMeshAssetPatch*>(data_ + entry.patch_offset);
+        mesh->patches.resize(entry.patch_count);
+        for (uint32_t k = 0; k < entry.patch_count; k++) {
+            MDMeshPatch& patch = mesh->patches[k];
+            patch.first_index = patches[k].first_index;
+            patch.index_count = patches[k].index_count;
+            patch.triangle_count = patches[k].triangle_count;
+            memcpy(patch.axis, patches[k].axis, sizeof(patch.axis));
+            patch.cos_half_angle = patches[k].cos_half_angle;
+            patch.sin_half_angle = patches[k].sin_half_angle;
+            patch.radius = patches[k].radius;
+        }
+        return mesh;
+    }
+    return nullptr;
+}
+
+bool MDMeshAssetWriter::AddMesh(int type, float radius, int rings, int sectors, float degree, const MDMeshData& mesh) {
+    // 资源只有标准顶点格式；双鱼眼网格随标定变化，不烘焙
+    if (mesh.HasBlend()) {
+        return false;
+    }
+    Item item;
+    memset(&item.entry, 0, sizeof(item.entry));
+    item.entry.type = type;
+    item.entry.radius = radius;
+    item.entry.rings = rings;
+    item.entry.sectors = sectors;
+    item.entry.degree = degree;
+    item.entry.flags = mesh.triangle_strip ? MD_MESH_ASSET_FLAG_TRIANGLE_STRIP : 0;
+    item.entry.triangle_count = mesh.triangle_count;
+
+    size_t vertex_count = mesh.vertices.size() / 3;
+    item.vertices.resize(vertex_count * MD_MESH_VERTEX_STRIDE);
+    for (size_t i = 0; i < vertex_count; i++) {
+        float* vertex = &item.vertices[i * MD_MESH_VERTEX_STRIDE];
+        vertex[0] = mesh.vertices[i * 3];
+        vertex[1] = mesh.vertices[i * 3 + 1];
+        vertex[2] = mesh.vertices[i * 3 + 2];
+        vertex[3] = mesh.texcoords[i * 2];
+        vertex[4] = mesh.texcoords[i * 2 + 1];
+    }
+    item.indices.assign(mesh.indices.begin(), mesh.indices.end());
+    for (const MDMeshPatch& patch : mesh.patches) {
+        MDMeshAssetPatch out;
+        out.first_index = patch.first_index;
+        out.index_count = patch.index_count;
+        out.triangle_count = patch.triangle_count;
+        memcpy(out.axis, patch.axis, sizeof(out.axis));
+        out.cos_half_angle = patch.cos_half_angle;
+        out.sin_half_angle = patch.sin_half_angle;
+        out.radius = patch.radius;
+        item.patches.push_back(out);
+    }
+    item.entry.vertex_count = static_cast<uint32_t>(vertex_count);
+    item.entry.index_count = static_cast<uint32_t>(item.indices.size());
+    item.entry.patch_count = static_cast<uint32_t>(item.patches.size());
+    meshes_.push_back(std::move(item));
+    return true;
+}
+
+bool MDMeshAssetWriter::Save(const std::string& path) const {
+    // 先排好每个网格的偏移，再整块写出
+    size_t size = sizeof(MDMeshAssetHeader) + meshes_.size() * sizeof(MDMeshAssetEntry);
+    std::vector<MDMeshAssetEntry> entries;
+    for (const Item& item : meshes_) {
+        MDMeshAssetEntry entry = item.entry;
+        entry.vertex_offset = static_cast<uint32_t>(size);
+        size += item.vertices.size() * sizeof(float);
+        entry.index_offset = static_cast<uint32_t>(size);
+        size = AlignUp4(size + item.indices.size() * sizeof(uint16_t));
+        entry.patch_offset = static_cast<uint32_t>(size);
+        size += item.patches.size() * sizeof(MDMeshAssetPatch);
+        entries.push_back(entry);
+    }
+    std::vector<uint8_t> buffer(size, 0);
+    memcpy(&buffer[sizeof(MDMeshAssetHeader)], entries.data(), entries.size() * sizeof(MDMeshAssetEntry));
+    for (size_t i = 0; i < meshes_.size(); i++) {
+        const Item& item = meshes_[i];
+        memcpy(&buffer[entries[i].vertex_offset], item.vertices.data(), item.vertices.size() * sizeof(float));
+        memcpy(&buffer[entries[i].index_offset], item.indices.data(), item.indices.size() * sizeof(uint16_t));
+        memcpy(&buffer[entries[i].patch_offset], item.patches.data(), item.patches.size() * sizeof(MDMeshAssetPatch));
+    }
+    MDMeshAssetHeader header;
+    header.magic = MD_MESH_ASSET_MAGIC;
+    header.version = MD_MESH_ASSET_VERSION;
+    header.entry_count = static_cast<uint32_t>(meshes_.size());
+    header.data_size = size - sizeof(MDMeshAssetHeader);
+    header.checksum = MDMeshAsset::Checksum(&buffer[sizeof(MDMeshAssetHeader)], header.data_size);
+    memcpy(buffer.data(), &header, sizeof(header));
+
+    FILE* file = fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        return false;
+    }
+    bool ok = fwrite(buffer.data(), 1, buffer.size(), file) == buffer.size();
+    return fclose(file) == 0 && ok;
+}
+
+}
+}
@@ -0,0 +1,126 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef MD360PLAYER4OH_MD_MESH_ASSET_H
+#define MD360PLAYER4OH_MD_MESH_ASSET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "md_mesh_generator.h"
+
+namespace asha {
+namespace vrlib {
+
+// 预先烘焙的投影网格资源文件（小端）：
+//   MDMeshAssetHeader
+//   MDMeshAssetEntry[entry_count]  每个网格（投影类型 × 细分级别 × 图元类型）一项，即细分级别表
+//   数据区：每个网格的交错顶点（float xyz + st）、uint16 索引、MDMeshAssetPatch[]，各自按4字节对齐
+// checksum 为头部之后所有字节的 FNV-1a 32 位哈希；版本不同的文件直接拒绝，由工具重新烘焙
+static constexpr uint32_t MD_MESH_ASSET_MAGIC = 0x414D444Du;  // "MDMA"
+static constexpr uint32_t MD_MESH_ASSET_VERSION = 1;
+static constexpr uint32_t MD_MESH_ASSET_FLAG_TRIANGLE_STRIP = 1u;
+
+struct MDMeshAssetHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t entry_count;
+    uint32_t checksum;
+    uint64_t data_size;  // 头部之后的字节数
+};
+
+struct MDMeshAssetEntry {
+    // 与 MDMeshKey 相同的键
+    int32_t type;
+    float radius;
+    int32_t rings;
+    int32_t sectors;
+    float degree;
+    uint32_t flags;
+    int32_t triangle_count;
+    uint32_t vertex_count;
+    uint32_t index_count;
+    uint32_t patch_count;
+    // 相对文件（资源）开头的字节偏移
+    uint32_t vertex_offset;
+    uint32_t index_offset;
+    uint32_t patch_offset;
+    uint32_t reserved;
+};
+
+struct MDMeshAssetPatch {
+    int32_t first_index;
+    int32_t index_count;
+    int32_t triangle_count;
+    float axis[3];
+    float cos_half_angle;
+    float sin_half_angle;
+    float radius;
+};
+
+static_assert(sizeof(MDMeshAssetHeader) == 24, "MDMeshAssetHeader layout");
+static_assert(sizeof(MDMeshAssetEntry) == 56, "MDMeshAssetEntry layout");
+static_assert(sizeof(MDMeshAssetPatch) == 36, "MDMeshAssetPatch layout");
+
+// 只读映射的网格资源：打开时校验一次，之后取网格只是把指针指向映射内存，不做任何计算，
+// 顶点和索引可以直接交给 glBufferData（不依赖GL）
+class MDMeshAsset : public std::enable_shared_from_this<MDMeshAsset> {
+public:
+    ~MDMeshAsset();
+
+    // 映射 fd 中 [offset, offset + length) 的资源（例如 rawfile 的描述符），fd 之后可以关闭
+    // 失败返回 nullptr，error 不为空时写入 MD_ERR_ASSET_IO 或 MD_ERR_ASSET_INVALID（范围超出文件末尾时也是后者）
+    static std::shared_ptr<MDMeshAsset> Open(int fd, int64_t offset, int64_t length, int* error = nullptr);
+    static std::shared_ptr<MDMeshAsset> Open(const char* path, int* error = nullptr);
+
+    // 取和键完全相同的网格，资源里没有时返回 nullptr
+    std::shared_ptr<const MDMeshData> FindMesh(int type, float radius, int rings, int sectors, float degree,
+                                               bool triangle_strip) const;
+
+    int GetEntryCount() const { return static_cast<int>(entry_count_); }
+    size_t GetSize() const { return size_; }
+
+    // FNV-1a 32 位哈希（头部中的 checksum）
+    static uint32_t Checksum(const uint8_t* data, size_t size);
+
+private:
+    MDMeshAsset() = default;
+    int Validate();
+
+private:
+    void* map_base_ = nullptr;
+    size_t map_length_ = 0;
+    const uint8_t* data_ = nullptr;  // 资源开头（映射起点按页对齐，可能在 map_base_ 之后）
+    std::vector<uint32_t> copy_;     // 资源在 fd 里没有按4字节对齐时改为读到这里
+    size_t size_ = 0;
+    const MDMeshAssetEntry* entries_ = nullptr;
+    uint32_t entry_count_ = 0;
+};
+
+// 主机侧烘焙工具用：收集网格后按上面的格式写出
+class MDMeshAssetWriter {
+public:
+    // 带混合属性的网格（双鱼眼）不能写进资源，返回 false
+    bool AddMesh(int type, float radius, int rings, int sectors, float degree, const MDMeshData& mesh);
+    bool Save(const std::string& path) const;
+    size_t GetMeshCount() const { return meshes_.size(); }
+
+private:
+    struct Item {
+        MDMeshAssetEntry entry;
+        std::vector<float> vertices;
+        std::vector<uint16_t> indices;
+        std::vector<MDMeshAssetPatch> patches;
+    };
+    std::vector<Item> meshes_;
+};
+
+}
+}
+
+#endif //MD360PLAYER4OH_MD_MESH_ASSET_H
@@ -0,0 +1,196 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#include "md_mesh_cache.h"
+#include "md_frame_clock.h"
+#include "md_log.h"
+#include <thread>
+
+namespace asha {
+namespace vrlib {
+
+MDMeshCache& MDMeshCache::GetInstance() {
+    static MDMeshCache instance;
+    return instance;
+}
+
+MDMeshCache::MeshFuture MDMeshCache::AcquireMesh(const MDMeshKey& key, Generator generate) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = meshes_.find(key);
+    if (it != meshes_.end()) {
+        mesh_hits_.fetch_add(1, std::memory_order_relaxed);
+        return it->second;
+    }
+    // 在持锁时放进缓存，其他宿主的GL线程同时请求同一个网格时等同一次生成
+    mesh_misses_.fetch_add(1, std::memory_order_relaxed);
+    if (!key.params.empty()) {
+        // 还在使用旧网格的渲染器持有自己的引用，丢掉缓存里的 future 不影响它们
+        for (auto stale = meshes_.begin(); stale != meshes_.end();) {
+            if (stale->first.type == key.type && !stale->first.params.empty() && stale->first.params != key.params) {
+                stale = meshes_.erase(stale);
+            } else {
+                ++stale;
+            }
+        }
+    }
+    // 网格资源只有标准顶点格式、不带参数的网格
+    std::shared_ptr<const MDMeshData> baked =
+        asset_ != nullptr && key.params.empty()
+            ? asset_->FindMesh(key.type, key.radius, key.rings, key.sectors, key.degree, key.triangle_strip)
+            : nullptr;
+    if (baked != nullptr) {
+        asset_hits_.fetch_add(1, std::memory_order_relaxed);
+        MD_LOGI("MDMeshCache: mapped mesh type=%d rings=%d sectors=%d from asset, %d vertices, %d indices",
+                key.type, key.rings, key.sectors, baked->VertexCount(), baked->IndexCount());
+        std::promise<std::shared_ptr<const MDMeshData>> ready;
+        ready.set_value(baked);
+        MeshFuture future = ready.get_future().share();
+        meshes_.emplace(key, future);
+        return future;
+    }
+    // 用分离的工作线程 + promise 生成，不用 std::async：async 的共享状态在最后一个 future 析构时会等待任务结束，
+    // 换参数时缓存丢掉旧 future、渲染器换掉 pending_mesh_ 都会让GL线程卡到旧网格生成完
+    auto promise = std::make_shared<std::promise<std::shared_ptr<const MDMeshData>>>();
+    MeshFuture future = promise->get_future().share();
+    std::thread([key, generate = std::move(generate), promise]() {
+        int64_t start_ns = MDNowNs();
+        auto mesh = std::make_shared<MDMeshData>();
+        generate(mesh.get());
+        MD_LOGI("MDMeshCache: generated mesh type=%d rings=%d sectors=%d, %d vertices, %zu indices in %.3fms",
+                key.type, key.rings, key.sectors, mesh->VertexCount(), mesh->indices.size(),
+                (MDNowNs() - start_ns) / 1000000.0);
+        promise->set_value(std::shared_ptr<const MDMeshData>(std::move(mesh)));
+    }).detach();
+    meshes_.emplace(key, future);
+    return future;
+}
+
+void MDMeshCache::SetAsset(std::shared_ptr<const MDMeshAsset> asset) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    asset_ = std::move(asset);
+}
+
+std::shared_ptr<const MDMeshBuffers> MDMeshCache::AcquireBuffers(const MDMeshKey& key,
+                                                                 const std::shared_ptr<const MDMeshData>& mesh) {
+    if (mesh == nullptr || mesh->VertexCount() == 0) {
+        return nullptr;
+    }
+    BufferKey buffer_key(eglGetCurrentContext(), key);
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = buffers_.find(buffer_key);
+    if (it != buffers_.end()) {
+        buffer_hits_.fetch_add(1, std::memory_order_relaxed);
+        return it->second;
+    }
+
+    if (!key.params.empty()) {
+        ReleaseBuffersLocked(buffer_key.first, [&key](const MDMeshKey& other) {
+            return other.type == key.type && !other.params.empty() && other.params != key.params;
+        });
+    }
+
+    // 网格资源里的顶点已经是交错格式，直接从映射内存上传；生成的网格上传时把位置和纹理坐标交错到一个缓冲里
+    size_t vertex_count = static_cast<size_t>(mesh->VertexCount());
+    bool blend = mesh->HasBlend();
+    const int vertex_stride = blend ? MD_MESH_BLEND_VERTEX_STRIDE : MD_MESH_VERTEX_STRIDE;
+    std::vector<float> interleaved;
+    const float* vertex_data = mesh->mapped_vertices;
+    if (vertex_data == nullptr) {
+        interleaved.resize(vertex_count * vertex_stride);
+        for (size_t i = 0; i < vertex_count; i++) {
+            float* vertex = &interleaved[i * vertex_stride];
+            vertex[0] = mesh->vertices[i * 3];
+            vertex[1] = mesh->vertices[i * 3 + 1];
+            vertex[2] = mesh->vertices[i * 3 + 2];
+            vertex[3] = mesh->texcoords[i * 2];
+            vertex[4] = mesh->texcoords[i * 2 + 1];
+            if (blend) {
+                vertex[5] = mesh->texcoords2[i * 2];
+                vertex[6] = mesh->texcoords2[i * 2 + 1];
+                vertex[7] = mesh->weights[i];
+            }
+        }
+        vertex_data = interleaved.data();
+    }
+    const void* index_data = mesh->mapped_indices != nullptr ? static_cast<const void*>(mesh->mapped_indices)
+                                                             : static_cast<const void*>(mesh->indices.data());
+    size_t index_count = static_cast<size_t>(mesh->IndexCount());
+
+    auto buffers = std::make_shared<MDMeshBuffers>();
+    glGenVertexArrays(1, &buffers->vao);
+    glGenBuffers(1, &buffers->vbo);
+    glGenBuffers(1, &buffers->ibo);
+
+    glBindVertexArray(buffers->vao);
+    glBindBuffer(GL_ARRAY_BUFFER, buffers->vbo);
+    glBufferData(GL_ARRAY_BUFFER, vertex_count * vertex_stride * sizeof(float), vertex_data, GL_STATIC_DRAW);
+    // IBO 绑定记录在 VAO 里
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers->ibo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, index_count * sizeof(short), index_data, GL_STATIC_DRAW);
+
+    const GLsizei stride = vertex_stride * sizeof(float);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<const void*>(0));
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<const void*>(3 * sizeof(float)));
+    if (blend) {
+        glEnableVertexAttribArray(2);
+        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<const void*>(5 * sizeof(float)));
+        glEnableVertexAttribArray(3);
+        glVertexAttribPointer(3, 1, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<const void*>(7 * sizeof(float)));
+    }
+
+    // 先解绑 VAO，再解绑缓冲，避免把 IBO 从 VAO 上解掉
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    buffers->mode = mesh->triangle_strip ? GL_TRIANGLE_STRIP : GL_TRIANGLES;
+    buffers->num_indices = static_cast<int>(index_count);
+
+    buffer_uploads_.fetch_add(1, std::memory_order_relaxed);
+    buffers_.emplace(buffer_key, buffers);
+    return buffers;
+}
+
+void MDMeshCache::ReleaseUnusedBuffers() {
+    EGLContext context = eglGetCurrentContext();
+    std::lock_guard<std::mutex> lock(mutex_);
+    int released = ReleaseBuffersLocked(context, [](const MDMeshKey&) { return true; });
+    if (released > 0) {
+        MD_LOGI("MDMeshCache: released %d unused mesh buffers", released);
+    }
+}
+
+int MDMeshCache::ReleaseBuffersLocked(EGLContext context, const std::function<bool(const MDMeshKey&)>& match) {
+    int released = 0;
+    for (auto it = buffers_.begin(); it != buffers_.end();) {
+        // 只剩缓存自己的引用
+        if (it->first.first == context && it->second.use_count() == 1 && match(it->first.second)) {
+            MDMeshBuffers* buffers = it->second.get();
+            glDeleteVertexArrays(1, &buffers->vao);
+            glDeleteBuffers(1, &buffers->vbo);
+            glDeleteBuffers(1, &buffers->ibo);
+            it = buffers_.erase(it);
+            released++;
+        } else {
+            ++it;
+        }
+    }
+    return released;
+}
+
+MDMeshCacheStats MDMeshCache::GetStats() const {
+    MDMeshCacheStats stats;
+    stats.mesh_hits = mesh_hits_.load(std::memory_order_relaxed);
+    stats.mesh_misses = mesh_misses_.load(std::memory_order_relaxed);
+    stats.buffer_hits = buffer_hits_.load(std::memory_order_relaxed);
+    stats.buffer_uploads = buffer_uploads_.load(std::memory_order_relaxed);
+    stats.asset_hits = asset_hits_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+}
+}
@@ -0,0 +1,113 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef MD360PLAYER4OH_MD_MESH_CACHE_H
+#define MD360PLAYER4OH_MD_MESH_CACHE_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include <EGL/egl.h>
+#include <GLES3/gl3.h>
+#include "md_mesh_asset.h"
+#include "md_mesh_generator.h"
+
+namespace asha {
+namespace vrlib {
+
+// 网格的键：投影类型和细分参数（不用的参数填0），params 为生成网格用到的其他参数（例如双鱼眼的镜头标定）
+struct MDMeshKey {
+    int type = 0;
+    float radius = 0.0f;
+    int rings = 0;
+    int sectors = 0;
+    float degree = 0.0f;
+    bool triangle_strip = false;
+    std::vector<float> params;
+
+    bool operator<(const MDMeshKey& other) const {
+        return std::tie(type, radius, rings, sectors, degree, triangle_strip, params) <
+               std::tie(other.type, other.radius, other.rings, other.sectors, other.degree, other.triangle_strip,
+                        other.params);
+    }
+};
+
+// 网格在某个GL上下文中的缓冲：一个交错的 VBO（位置在 location 0，纹理坐标在 location 1，双鱼眼网格另有
+// 第二组纹理坐标在 location 2、混合权重在 location 3）、一个 IBO，以及上传时就配置好属性的 VAO
+// （VAO 不能在上下文之间共享，所以按上下文缓存）
+struct MDMeshBuffers {
+    GLuint vao = 0;
+    GLuint vbo = 0;
+    GLuint ibo = 0;
+    GLenum mode = GL_TRIANGLES;
+    int num_indices = 0;
+};
+
+struct MDMeshCacheStats {
+    uint64_t mesh_hits = 0;
+    uint64_t mesh_misses = 0;
+    uint64_t buffer_hits = 0;
+    uint64_t buffer_uploads = 0;
+    uint64_t asset_hits = 0;  // 未命中缓存、直接从网格资源取到的次数（计入 mesh_misses）
+};
+
+// 进程内共享的投影网格缓存：CPU数据按键只生成一次（在工作线程中），GPU缓冲按 (GL上下文, 键) 只上传一次，
+// 挂在同一个渲染宿主（共享上下文）上的渲染器共用一份，切回用过的投影模式不需要重新生成和上传
+// 引用计数由 shared_ptr 表示：渲染器不再持有的缓冲留在缓存里，直到 ReleaseUnusedBuffers 在GL线程中删除
+class MDMeshCache {
+public:
+    using Generator = std::function<void(MDMeshData* mesh)>;
+    using MeshFuture = std::shared_future<std::shared_ptr<const MDMeshData>>;
+
+    static MDMeshCache& GetInstance();
+
+    // 取网格数据，缓存里没有时在工作线程中调用 generate 生成，不阻塞调用线程（GL线程只等数据就绪后上传）
+    // 返回的 future 随时可以丢掉，析构不会等待生成结束（生成在分离的线程中完成）
+    // 同一个键正在生成时返回同一个 future，已生成的网格返回已就绪的 future；
+    // 设置了网格资源且资源里有这个键时直接返回映射的网格（已就绪），不生成
+    // 带 params 的网格（标定可以随时调整）每个投影类型只缓存最新一组参数的网格，换参数时丢掉旧的
+    MeshFuture AcquireMesh(const MDMeshKey& key, Generator generate);
+
+    // 预先烘焙的网格资源（md_mesh_bake 生成），替换之前的资源，传 nullptr 取消；已经在缓存里的网格不受影响
+    void SetAsset(std::shared_ptr<const MDMeshAsset> asset);
+
+    // GL线程：取当前上下文中这个网格的缓冲，没有时上传（带 params 的网格上传时删除同类型旧参数的闲置缓冲）
+    std::shared_ptr<const MDMeshBuffers> AcquireBuffers(const MDMeshKey& key,
+                                                        const std::shared_ptr<const MDMeshData>& mesh);
+
+    // GL线程：删除当前上下文中已经没有使用者的缓冲（挂起释放GPU资源、渲染器离开宿主时调用）
+    void ReleaseUnusedBuffers();
+
+    MDMeshCacheStats GetStats() const;
+
+private:
+    using BufferKey = std::pair<EGLContext, MDMeshKey>;
+
+    // 持锁调用：删除当前上下文中满足 match、且只剩缓存自己引用的缓冲，返回删除的个数
+    int ReleaseBuffersLocked(EGLContext context, const std::function<bool(const MDMeshKey&)>& match);
+
+    std::mutex mutex_;
+    std::map<MDMeshKey, MeshFuture> meshes_;
+    std::map<BufferKey, std::shared_ptr<MDMeshBuffers>> buffers_;
+    std::shared_ptr<const MDMeshAsset> asset_;
+    std::atomic<uint64_t> mesh_hits_{0};
+    std::atomic<uint64_t> mesh_misses_{0};
+    std::atomic<uint64_t> buffer_hits_{0};
+    std::atomic<uint64_t> buffer_uploads_{0};
+    std::atomic<uint64_t> asset_hits_{0};
+};
+
+}
+}
+
+#endif //MD360PLAYER4OH_MD_MESH_CACHE_H
@@ -0,0 +1,205 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#include "md_mesh_culling.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include "md_mesh_optimizer.h"
+
+namespace asha {
+namespace vrlib {
+
+// 包围锥的半角额外放宽的弧度，避免浮点误差把贴着视锥边缘的分块剔掉
+static const float PATCH_CONE_MARGIN = 0.002f;
+
+void MDFrustum::SetMatrix(const float* mvp_matrix) {
+    // 裁剪空间 -w <= x <= w、-w <= y <= w，即 row3 ± row0 >= 0、row3 ± row1 >= 0（列主序 m[col * 4 + row]）
+    for (int axis = 0; axis < 2; axis++) {
+        for (int side = 0; side < 2; side++) {
+            float sign = side == 0 ? 1.0f : -1.0f;
+            float* plane = planes_[axis * 2 + side];
+            for (int col = 0; col < 4; col++) {
+                plane[col] = mvp_matrix[col * 4 + 3] + sign * mvp_matrix[col * 4 + axis];
+            }
+        }
+    }
+}
+
+bool MDFrustum::IsPatchVisible(const MDMeshPatch& patch) const {
+    for (const float* plane : planes_) {
+        float length = std::sqrt(plane[0] * plane[0] + plane[1] * plane[1] + plane[2] * plane[2]);
+        if (length < 1e-12f) {
+            continue;
+        }
+        // 锥内的点在法向上的最大投影：法向在锥内时取 radius，否则取与法向夹角最小的母线 cos(phi - theta)
+        float cos_phi = (patch.axis[0] * plane[0] + patch.axis[1] * plane[1] + patch.axis[2] * plane[2]) / length;
+        float reach = patch.radius * length;
+        if (cos_phi < patch.cos_half_angle) {
+            float sin_phi = std::sqrt(std::max(0.0f, 1.0f - cos_phi * cos_phi));
+            reach *= cos_phi * patch.cos_half_angle + sin_phi * patch.sin_half_angle;
+        }
+        // 网格上没有点在锥顶（原点）：母线都背向裁剪面时，锥顶在面上或外侧就整个在外侧
+        // （相机在原点时四个侧面都过锥顶，靠这一条剔除）
+        if (reach < 0.0f ? plane[3] <= 0.0f : plane[3] + reach < 0.0f) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void ComputePatchCone(const MDMeshData& mesh, const std::vector<int>& vertices, MDMeshPatch* patch) {
+    float axis[3] = {0.0f, 0.0f, 0.0f};
+    float radius = 0.0f;
+    for (int v : vertices) {
+        const float* position = &mesh.vertices[v * 3];
+        float length = std::sqrt(position[0] * position[0] + position[1] * position[1] + position[2] * position[2]);
+        radius = std::max(radius, length);
+        if (length > 1e-6f) {
+            for (int k = 0; k < 3; k++) {
+                axis[k] += position[k] / length;
+            }
+        }
+    }
+    patch->radius = radius;
+    float axis_length = std::sqrt(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+    if (axis_length < 1e-6f) {
+        return;
+    }
+    float min_cos = 1.0f;
+    for (int k = 0; k < 3; k++) {
+        patch->axis[k] = axis[k] / axis_length;
+    }
+    for (int v : vertices) {
+        const float* position = &mesh.vertices[v * 3];
+        float length = std::sqrt(position[0] * position[0] + position[1] * position[1] + position[2] * position[2]);
+        if (length > 1e-6f) {
+            float cos_angle = (patch->axis[0] * position[0] + patch->axis[1] * position[1] +
+                               patch->axis[2] * position[2]) / length;
+            min_cos = std::min(min_cos, cos_angle);
+        }
+    }
+    float half_angle = std::acos(std::max(-1.0f, std::min(1.0f, min_cos))) + PATCH_CONE_MARGIN;
+    // 张角超过 90 度的锥不是凸的，三角形内部可能跑到锥外，这样的分块不剔除
+    if (half_angle < static_cast<float>(M_PI) / 2.0f) {
+        patch->cos_half_angle = std::cos(half_angle);
+        patch->sin_half_angle = std::sin(half_angle);
+    }
+}
+
+void MDMeshCulling::BuildPatches(MDMeshData* mesh, bool triangle_strip) {
+    const int patch_count = PATCH_LATITUDE_BANDS * PATCH_LONGITUDE_BANDS;
+    const int vertex_count = static_cast<int>(mesh->vertices.size() / 3);
+    const size_t triangle_count = mesh->indices.size() / 3;
+    const float pi = static_cast<float>(M_PI);
+    auto vertex_at = [mesh](size_t i) { return static_cast<int>(static_cast<uint16_t>(mesh->indices[i])); };
+
+    std::vector<std::vector<short>> patch_indices(patch_count);
+    for (size_t t = 0; t < triangle_count; t++) {
+        float center[3] = {0.0f, 0.0f, 0.0f};
+        for (int k = 0; k < 3; k++) {
+            const float* position = &mesh->vertices[vertex_at(t * 3 + k) * 3];
+            for (int c = 0; c < 3; c++) {
+                center[c] += position[c];
+            }
+        }
+        float length = std::sqrt(center[0] * center[0] + center[1] * center[1] + center[2] * center[2]);
+        int band = 0;
+        int sector = 0;
+        if (length > 1e-6f) {
+            float latitude = std::asin(std::max(-1.0f, std::min(1.0f, center[1] / length)));
+            float longitude = std::atan2(center[2], center[0]);
+            band = static_cast<int>((latitude / pi + 0.5f) * PATCH_LATITUDE_BANDS);
+            sector = static_cast<int>((longitude / (2.0f * pi) + 0.5f) * PATCH_LONGITUDE_BANDS);
+            band = std::max(0, std::min(PATCH_LATITUDE_BANDS - 1, band));
+            sector = std::max(0, std::min(PATCH_LONGITUDE_BANDS - 1, sector));
+        }
+        std::vector<short>& indices = patch_indices[band * PATCH_LONGITUDE_BANDS + sector];
+        indices.insert(indices.end(), mesh->indices.begin() + t * 3, mesh->indices.begin() + t * 3 + 3);
+    }
+
+    const short restart = static_cast<short>(MD_PRIMITIVE_RESTART_INDEX);
+    std::vector<short> output;
+    output.reserve(mesh->indices.size() + patch_count);
+    mesh->patches.clear();
+    std::vector<int> local_of(vertex_count, -1);
+    std::vector<int> global_of;
+    for (std::vector<short>& indices : patch_indices) {
+        if (indices.empty()) {
+            continue;
+        }
+        MDMeshPatch patch;
+        patch.triangle_count = static_cast<int>(indices.size() / 3);
+        // 换成分块内的局部顶点编号再优化，代价只和分块大小有关
+        global_of.clear();
+        for (short& index : indices) {
+            int v = static_cast<uint16_t>(index);
+            if (local_of[v] < 0) {
+                local_of[v] = static_cast<int>(global_of.size());
+                global_of.push_back(v);
+            }
+            index = static_cast<short>(local_of[v]);
+        }
+        MDMeshOptimizer::OptimizeVertexCache(&indices, static_cast<int>(global_of.size()));
+        if (triangle_strip) {
+            indices = MDMeshOptimizer::ConvertToStrips(indices);
+        }
+        for (short& index : indices) {
+            if (index != restart) {
+                index = static_cast<short>(global_of[static_cast<uint16_t>(index)]);
+            }
+        }
+        for (int v : global_of) {
+            local_of[v] = -1;
+        }
+        ComputePatchCone(*mesh, global_of, &patch);
+
+        if (triangle_strip && !output.empty()) {
+            output.push_back(restart);
+        }
+        patch.first_index = static_cast<int>(output.size());
+        patch.index_count = static_cast<int>(indices.size());
+        output.insert(output.end(), indices.begin(), indices.end());
+        mesh->patches.push_back(patch);
+    }
+    mesh->indices.swap(output);
+    mesh->triangle_strip = triangle_strip;
+}
+
+int MDMeshCulling::CullPatches(const MDMeshData& mesh, const MDFrustum& frustum, std::vector<MDDrawRange>* ranges) {
+    ranges->clear();
+    if (mesh.patches.empty()) {
+        MDDrawRange range;
+        range.index_count = mesh.IndexCount();
+        ranges->push_back(range);
+        return mesh.triangle_count;
+    }
+    // 三角形列表中相邻分块首尾相接，三角形带中隔着一个图元重启索引
+    const int max_gap = mesh.triangle_strip ? 1 : 0;
+    int visible_triangles = 0;
+    for (const MDMeshPatch& patch : mesh.patches) {
+        if (!frustum.IsPatchVisible(patch)) {
+            continue;
+        }
+        visible_triangles += patch.triangle_count;
+        int end = patch.first_index + patch.index_count;
+        if (!ranges->empty()) {
+            MDDrawRange& last = ranges->back();
+            if (patch.first_index - (last.first_index + last.index_count) <= max_gap) {
+                last.index_count = end - last.first_index;
+                continue;
+            }
+        }
+        MDDrawRange range;
+        range.first_index = patch.first_index;
+        range.index_count = patch.index_count;
+        ranges->push_back(range);
+    }
+    return visible_triangles;
+}
+
+}
+}
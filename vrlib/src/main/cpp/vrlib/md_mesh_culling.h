@@ -0,0 +1,54 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef MD360PLAYER4OH_MD_MESH_CULLING_H
+#define MD360PLAYER4OH_MD_MESH_CULLING_H
+
+#include <vector>
+#include "md_mesh_generator.h"
+
+namespace asha {
+namespace vrlib {
+
+// indices 中要提交的一段（以索引为单位）
+struct MDDrawRange {
+    int first_index = 0;
+    int index_count = 0;
+};
+
+// MVP 矩阵在模型空间里的左右上下四个裁剪面（不看远近平面，网格都在两者之间）
+class MDFrustum {
+public:
+    // 列主序矩阵，按 Gribb-Hartmann 从第4行加减第1、2行得到
+    void SetMatrix(const float* mvp_matrix);
+
+    // 包围锥里的点（到原点的距离在 0 和 radius 之间，不含锥顶）都在某个裁剪面外侧时不可见
+    bool IsPatchVisible(const MDMeshPatch& patch) const;
+
+private:
+    float planes_[4][4] = {};
+};
+
+// 投影网格按角度分块，绘制前按每只眼睛的视锥剔除看不到的分块（不依赖GL）
+class MDMeshCulling {
+public:
+    // 分块的角度大小：纬度 180 / 8、经度 360 / 16，都是 22.5 度
+    static constexpr int PATCH_LATITUDE_BANDS = 8;
+    static constexpr int PATCH_LONGITUDE_BANDS = 16;
+
+    // 按三角形中心的方向把三角形列表分到各个分块，同一纬度带里按经度排列（视野内的分块在 indices 中大多相邻），
+    // 每个分块单独做顶点缓存优化、可选转成三角形带（分块之间用图元重启隔开），并计算包围锥
+    static void BuildPatches(MDMeshData* mesh, bool triangle_strip);
+
+    // 剔除视锥外的分块，相邻的可见分块合并成一个绘制区间；返回可见的三角形数
+    // 网格没有分块时返回整个网格
+    static int CullPatches(const MDMeshData& mesh, const MDFrustum& frustum, std::vector<MDDrawRange>* ranges);
+};
+
+}
+}
+
+#endif //MD360PLAYER4OH_MD_MESH_CULLING_H
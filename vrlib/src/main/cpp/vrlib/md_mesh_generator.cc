@@ -0,0 +1,336 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#include "md_mesh_generator.h"
+#include <algorithm>
+#include <cmath>
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
+namespace asha {
+namespace vrlib {
+
+// 等分角度的 sin / cos 表：angle = step * i，i = 0 ~ count - 1（用 double 计算后存成 float）
+static void BuildAngleTable(int count, double step, std::vector<float>* sin_table, std::vector<float>* cos_table) {
+    sin_table->resize(count);
+    cos_table->resize(count);
+    for (int i = 0; i < count; i++) {
+        double angle = step * i;
+        (*sin_table)[i] = static_cast<float>(sin(angle));
+        (*cos_table)[i] = static_cast<float>(cos(angle));
+    }
+}
+
+// 一圈（同一个环）的顶点：position = (cos_s * x_scale, y, sin_s * z_scale)，texcoord = (tex_s, tex_t)，
+// tex_t 为空时纹理 t 坐标为常数 tex_v。有 NEON 时每次处理4个顶点，用交错存储指令直接写出 xyz / st
+struct MDRingFill {
+    float x_scale = 0.0f;
+    float z_scale = 0.0f;
+    float y = 0.0f;
+    const float* tex_s = nullptr;
+    const float* tex_t = nullptr;
+    float tex_v = 0.0f;
+};
+
+static void FillRing(const MDRingFill& fill, const float* cos_table, const float* sin_table, int count,
+                     float* vertices, float* texcoords) {
+    int s = 0;
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    float32x4_t y = vdupq_n_f32(fill.y);
+    float32x4_t tex_v = vdupq_n_f32(fill.tex_v);
+    for (; s + 4 <= count; s += 4) {
+        float32x4_t cos_s = vld1q_f32(cos_table + s);
+        float32x4_t sin_s = vld1q_f32(sin_table + s);
+        float32x4x3_t position;
+        position.val[0] = vmulq_n_f32(cos_s, fill.x_scale);
+        position.val[1] = y;
+        position.val[2] = vmulq_n_f32(sin_s, fill.z_scale);
+        vst3q_f32(vertices + s * 3, position);
+        float32x4x2_t texcoord;
+        texcoord.val[0] = vld1q_f32(fill.tex_s + s);
+        texcoord.val[1] = fill.tex_t != nullptr ? vld1q_f32(fill.tex_t + s) : tex_v;
+        vst2q_f32(texcoords + s * 2, texcoord);
+    }
+#endif
+    for (; s < count; s++) {
+        vertices[s * 3] = cos_table[s] * fill.x_scale;
+        vertices[s * 3 + 1] = fill.y;
+        vertices[s * 3 + 2] = sin_table[s] * fill.z_scale;
+        texcoords[s * 2] = fill.tex_s[s];
+        texcoords[s * 2 + 1] = fill.tex_t != nullptr ? fill.tex_t[s] : fill.tex_v;
+    }
+}
+
+void MDMeshGenerator::GenerateSphere(MDMeshData* mesh, float radius, int rings, int sectors) {
+    const double PI = 3.14159265358979323846;
+
+    float R = 1.0f / (float)rings;
+    float S = 1.0f / (float)sectors;
+    
+    int numPoint = (rings + 1) * (sectors + 1);
+    
+    mesh->vertices.resize(numPoint * 3);
+    mesh->texcoords.resize(numPoint * 2);
+    mesh->indices.resize(rings * sectors * 6);
+
+    // 每个扇区、每个环的三角函数只算一次：x = cos(2PI s S) sin(PI r R)，y = cos(PI r R)，z = sin(2PI s S) sin(PI r R)
+    std::vector<float> sin_sector, cos_sector, sin_ring, cos_ring;
+    BuildAngleTable(sectors + 1, 2.0 * PI / sectors, &sin_sector, &cos_sector);
+    BuildAngleTable(rings + 1, PI / rings, &sin_ring, &cos_ring);
+    std::vector<float> tex_s(sectors + 1);
+    for (int s = 0; s < sectors + 1; s++) {
+        tex_s[s] = s * S;
+    }
+    for (int r = 0; r < rings + 1; r++) {
+        MDRingFill fill;
+        fill.x_scale = sin_ring[r] * radius;
+        fill.z_scale = fill.x_scale;
+        fill.y = cos_ring[r] * radius;
+        fill.tex_s = tex_s.data();
+        fill.tex_v = 1 - r * R;
+        int offset = r * (sectors + 1);
+        FillRing(fill, cos_sector.data(), sin_sector.data(), sectors + 1,
+                 &mesh->vertices[offset * 3], &mesh->texcoords[offset * 2]);
+    }
+
+    int counter = 0;
+    int sectorsPlusOne = sectors + 1;
+    for(int r = 0; r < rings; r++){
+        for(int s = 0; s < sectors; s++) {
+            mesh->indices[counter++] = (short) (r * sectorsPlusOne + s);       //(a)
+            mesh->indices[counter++] = (short) ((r+1) * sectorsPlusOne + (s));    //(b)
+            mesh->indices[counter++] = (short) ((r) * sectorsPlusOne + (s+1));  // (c)
+            mesh->indices[counter++] = (short) ((r) * sectorsPlusOne + (s+1));  // (c)
+            mesh->indices[counter++] = (short) ((r+1) * sectorsPlusOne + (s));    //(b)
+            mesh->indices[counter++] = (short) ((r+1) * sectorsPlusOne + (s+1));  // (d)
+        }
+    }
+}
+
+void MDMeshGenerator::GenerateDome(MDMeshData* mesh, float radius, int sectors, float degreeY, bool isUpper) {
+    const double PI = 3.14159265358979323846;
+    
+    float percent = degreeY / 360.0f;
+    int rings = sectors >> 1;  // sectors / 2
+    
+    float R = 1.0f / (float)rings;
+    
+    int lenRings = (int)(rings * percent) + 1;
+    int lenSectors = sectors + 1;
+    int numPoint = lenRings * lenSectors;
+    
+    mesh->vertices.resize(numPoint * 3);
+    mesh->texcoords.resize(numPoint * 2);
+    mesh->indices.resize((lenRings - 1) * (lenSectors - 1) * 6);
+    
+    int upper = isUpper ? 1 : -1;
+    
+    // x = cos(phi) sin(theta) * upper，y = cos(theta) * upper，z = sin(phi) sin(theta)，
+    // 纹理坐标（参考 Android 实现）为 (sin(phi), cos(phi)) * theta / PI / percent / 2 + 0.5，扇区部分每圈相同，预先乘好
+    std::vector<float> sin_sector, cos_sector, sin_ring, cos_ring;
+    BuildAngleTable(lenSectors, 2.0 * PI / sectors, &sin_sector, &cos_sector);
+    BuildAngleTable(lenRings, PI / rings, &sin_ring, &cos_ring);
+    std::vector<float> tex_s(lenSectors);
+    std::vector<float> tex_t(lenSectors);
+    for (int r = 0; r < lenRings; r++) {
+        float scale = r * R / percent / 2.0f;
+        for (int s = 0; s < lenSectors; s++) {
+            tex_s[s] = sin_sector[s] * scale + 0.5f;
+            tex_t[s] = cos_sector[s] * scale + 0.5f;
+        }
+        MDRingFill fill;
+        fill.x_scale = sin_ring[r] * radius * upper;
+        fill.z_scale = sin_ring[r] * radius;
+        fill.y = cos_ring[r] * radius * upper;
+        fill.tex_s = tex_s.data();
+        fill.tex_t = tex_t.data();
+        int offset = r * lenSectors;
+        FillRing(fill, cos_sector.data(), sin_sector.data(), lenSectors,
+                 &mesh->vertices[offset * 3], &mesh->texcoords[offset * 2]);
+    }
+    
+    int counter = 0;
+    for (int r = 0; r < lenRings - 1; r++) {
+        for (int s = 0; s < lenSectors - 1; s++) {
+            mesh->indices[counter++] = (short)(r * lenSectors + s);
+            mesh->indices[counter++] = (short)((r + 1) * lenSectors + s);
+            mesh->indices[counter++] = (short)(r * lenSectors + (s + 1));
+            mesh->indices[counter++] = (short)(r * lenSectors + (s + 1));
+            mesh->indices[counter++] = (short)((r + 1) * lenSectors + s);
+            mesh->indices[counter++] = (short)((r + 1) * lenSectors + (s + 1));
+        }
+    }
+}
+
+void MDMeshGenerator::GenerateCube(MDMeshData* mesh, float size, int layout, float padding) {
+    // 立方体有 6 个面，每个面有 2 个三角形，共 12 个三角形，36 个顶点（每个顶点重复 3 次）
+    // 为了简化，我们使用索引缓冲区，每个面 4 个顶点，共 24 个顶点
+    const int numVertices = 24;  // 6 个面 * 4 个顶点
+    const int numIndices = 36;   // 6 个面 * 2 个三角形 * 3 个顶点
+    
+    mesh->vertices.resize(numVertices * 3);
+    mesh->texcoords.resize(numVertices * 2);
+    mesh->indices.resize(numIndices);
+    
+    float halfSize = size / 2.0f;
+    
+    // 按 MDCubeFace 的顺序，每个面的中心方向、以及从里面看时的右方和上方
+    // 与球面的经纬图方向一致：前面（经纬图中心）为 -X，向右依次为 -Z、+X、+Z；上下两面的上方分别为后、前
+    const float faces[MD_CUBE_FACE_COUNT][3][3] = {
+        {{ 0,  0, -1}, { 1, 0,  0}, {0, 1, 0}},  // 右
+        {{ 0,  0,  1}, {-1, 0,  0}, {0, 1, 0}},  // 左
+        {{ 0,  1,  0}, { 0, 0, -1}, {1, 0, 0}},  // 上
+        {{ 0, -1,  0}, { 0, 0, -1}, {-1, 0, 0}}, // 下
+        {{-1,  0,  0}, { 0, 0, -1}, {0, 1, 0}},  // 前
+        {{ 1,  0,  0}, { 0, 0,  1}, {0, 1, 0}},  // 后
+    };
+    
+    // 每个面的四个角（面内坐标）：左下、右下、右上、左上
+    const float corners[4][2] = {
+        {0.0f, 0.0f},
+        {1.0f, 0.0f},
+        {1.0f, 1.0f},
+        {0.0f, 1.0f}
+    };
+    
+    // 填充顶点和纹理坐标：纹理坐标按画面排列落在这个面的格子里
+    int v = 0, t = 0;
+    for (int face = 0; face < MD_CUBE_FACE_COUNT; face++) {
+        const float* center = faces[face][0];
+        const float* right = faces[face][1];
+        const float* up = faces[face][2];
+        for (int vertex = 0; vertex < 4; vertex++) {
+            float x = corners[vertex][0];
+            float y = corners[vertex][1];
+            for (int c = 0; c < 3; c++) {
+                mesh->vertices[v++] = (center[c] + right[c] * (x * 2.0f - 1.0f) + up[c] * (y * 2.0f - 1.0f)) * halfSize;
+            }
+            MDCubeLayout::FaceTexCoord(layout, face, padding, x, y, &mesh->texcoords[t], &mesh->texcoords[t + 1]);
+            t += 2;
+        }
+    }
+    
+    // 填充索引（每个面 2 个三角形）
+    int counter = 0;
+    for (int face = 0; face < 6; face++) {
+        int base = face * 4;
+        // 第一个三角形
+        mesh->indices[counter++] = (short)(base + 0);
+        mesh->indices[counter++] = (short)(base + 1);
+        mesh->indices[counter++] = (short)(base + 2);
+        // 第二个三角形
+        mesh->indices[counter++] = (short)(base + 0);
+        mesh->indices[counter++] = (short)(base + 2);
+        mesh->indices[counter++] = (short)(base + 3);
+    }
+}
+
+void MDMeshGenerator::GenerateDualFisheye(MDMeshData* mesh, float radius, int rings, int sectors,
+                                          const MDFisheyeLens lenses[MDDualFisheye::LENS_COUNT]) {
+    const double PI = 3.14159265358979323846;
+
+    // 环按与镜头0光轴的夹角等分，再加上接缝带的两端（离已有的环太近时不加）
+    float blend_begin = 0.0f;
+    float blend_end = 0.0f;
+    MDDualFisheye::BlendRange(lenses, &blend_begin, &blend_end);
+    std::vector<float> ring_angles(rings + 1);
+    for (int r = 0; r < rings + 1; r++) {
+        ring_angles[r] = static_cast<float>(PI * r / rings);
+    }
+    const float min_spacing = static_cast<float>(PI / rings) * 0.05f;
+    for (float edge : {blend_begin, blend_end}) {
+        auto it = std::lower_bound(ring_angles.begin(), ring_angles.end(), edge);
+        bool near_next = it != ring_angles.end() && *it - edge < min_spacing;
+        bool near_prev = it != ring_angles.begin() && edge - *(it - 1) < min_spacing;
+        if (!near_next && !near_prev) {
+            ring_angles.insert(it, edge);
+        }
+    }
+
+    int ring_count = static_cast<int>(ring_angles.size());
+    int sectorsPlusOne = sectors + 1;
+    int numPoint = ring_count * sectorsPlusOne;
+    mesh->vertices.resize(numPoint * 3);
+    mesh->texcoords.resize(numPoint * 2);
+    mesh->texcoords2.resize(numPoint * 2);
+    mesh->weights.resize(numPoint);
+    mesh->indices.resize((ring_count - 1) * sectors * 6);
+
+    // 方向 = (cos(phi) sin(theta), sin(phi) sin(theta), -cos(theta))，phi 为绕光轴的方位角；
+    // 鱼眼纹理坐标沿方位角是连续的，首尾两列相同，不像经纬图那样需要处理纹理接缝
+    std::vector<float> sin_sector, cos_sector;
+    BuildAngleTable(sectorsPlusOne, 2.0 * PI / sectors, &sin_sector, &cos_sector);
+    int v = 0;
+    for (int r = 0; r < ring_count; r++) {
+        float theta = ring_angles[r];
+        float sin_theta = sinf(theta);
+        float z = -cosf(theta) * radius;
+        float weight = MDDualFisheye::BlendWeight(blend_begin, blend_end, theta);
+        for (int s = 0; s < sectorsPlusOne; s++, v++) {
+            mesh->vertices[v * 3] = cos_sector[s] * sin_theta * radius;
+            mesh->vertices[v * 3 + 1] = sin_sector[s] * sin_theta * radius;
+            mesh->vertices[v * 3 + 2] = z;
+            MDDualFisheye::Project(lenses[0], 0, sin_sector[s], cos_sector[s], theta,
+                                   &mesh->texcoords[v * 2], &mesh->texcoords[v * 2 + 1]);
+            MDDualFisheye::Project(lenses[1], 1, sin_sector[s], cos_sector[s], theta,
+                                   &mesh->texcoords2[v * 2], &mesh->texcoords2[v * 2 + 1]);
+            mesh->weights[v] = weight;
+        }
+    }
+
+    // 与球面相同的三角形顺序（参数化的朝向相同，正面剔除的结果一致）
+    int counter = 0;
+    for (int r = 0; r < ring_count - 1; r++) {
+        for (int s = 0; s < sectors; s++) {
+            mesh->indices[counter++] = (short)(r * sectorsPlusOne + s);
+            mesh->indices[counter++] = (short)((r + 1) * sectorsPlusOne + s);
+            mesh->indices[counter++] = (short)(r * sectorsPlusOne + (s + 1));
+            mesh->indices[counter++] = (short)(r * sectorsPlusOne + (s + 1));
+            mesh->indices[counter++] = (short)((r + 1) * sectorsPlusOne + s);
+            mesh->indices[counter++] = (short)((r + 1) * sectorsPlusOne + (s + 1));
+        }
+    }
+}
+
+void MDMeshGenerator::GeneratePlane(MDMeshData* mesh, float curve_degree, int columns) {
+    const float PI = 3.14159265358979323846f;
+    float arc = curve_degree * PI / 180.0f;
+    int num_point = (columns + 1) * 2;
+    mesh->vertices.resize(num_point * 3);
+    mesh->texcoords.resize(num_point * 2);
+    mesh->indices.resize(columns * 6);
+
+    // 下排在前、上排在后，纹理坐标 t 向上（与球面一致）
+    int v = 0, t = 0;
+    for (int row = 0; row < 2; row++) {
+        for (int c = 0; c < columns + 1; c++) {
+            float s = static_cast<float>(c) / columns;
+            float theta = (s - 0.5f) * arc;
+            mesh->vertices[v++] = curve_degree > 0.0f ? sinf(theta) : s * 2.0f - 1.0f;
+            mesh->vertices[v++] = row == 0 ? -1.0f : 1.0f;
+            mesh->vertices[v++] = curve_degree > 0.0f ? -cosf(theta) : -1.0f;
+            mesh->texcoords[t++] = s;
+            mesh->texcoords[t++] = static_cast<float>(row);
+        }
+    }
+
+    // 每列两个三角形，与立方体的面相同的绕序：左下、右下、右上，左下、右上、左上
+    int counter = 0;
+    for (int c = 0; c < columns; c++) {
+        short lower_left = static_cast<short>(c);
+        short upper_left = static_cast<short>(columns + 1 + c);
+        mesh->indices[counter++] = lower_left;
+        mesh->indices[counter++] = static_cast<short>(lower_left + 1);
+        mesh->indices[counter++] = static_cast<short>(upper_left + 1);
+        mesh->indices[counter++] = lower_left;
+        mesh->indices[counter++] = static_cast<short>(upper_left + 1);
+        mesh->indices[counter++] = upper_left;
+    }
+}
+
+}
+}
@@ -0,0 +1,83 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef MD360PLAYER4OH_MD_MESH_GENERATOR_H
+#define MD360PLAYER4OH_MD_MESH_GENERATOR_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "md_cube_layout.h"
+#include "md_dual_fisheye.h"
+
+namespace asha {
+namespace vrlib {
+
+// 网格的一个角度分块：indices 中连续的一段，和以原点为顶点、包住这段所有顶点的包围锥
+// cos_half_angle 为 -1 时表示分块张角太大，不参与剔除
+struct MDMeshPatch {
+    int first_index = 0;
+    int index_count = 0;
+    int triangle_count = 0;
+    float axis[3] = {0.0f, 0.0f, 1.0f};
+    float cos_half_angle = -1.0f;
+    float sin_half_angle = 0.0f;
+    float radius = 0.0f;  // 顶点到原点的最大距离
+};
+
+// 交错顶点格式：位置 xyz + 纹理坐标 uv（GPU缓冲和网格资源文件都用这个格式）
+static constexpr int MD_MESH_VERTEX_STRIDE = 5;
+// 带混合的交错顶点格式：再加第二组纹理坐标 uv（location 2）和混合权重（location 3），只有双鱼眼网格使用
+static constexpr int MD_MESH_BLEND_VERTEX_STRIDE = 8;
+
+// CPU侧的网格数据，生成后只读
+struct MDMeshData {
+    std::vector<float> vertices;
+    std::vector<float> texcoords;
+    std::vector<short> indices;
+    // 双鱼眼网格：镜头1的纹理坐标和镜头0的混合权重（texcoords 为镜头0的纹理坐标），其他网格为空
+    std::vector<float> texcoords2;
+    std::vector<float> weights;
+    bool triangle_strip = false;  // indices 为带图元重启（0xFFFF）的三角形带，否则为三角形列表
+    int triangle_count = 0;       // 构建时记录，转成三角形带后不能再由 indices 的长度推出
+    std::vector<MDMeshPatch> patches;  // 按分块排列 indices 后填写，为空时整个网格只能一起绘制
+
+    // 从网格资源（MDMeshAsset）取出的网格：交错顶点和索引直接指向映射的文件，vertices / texcoords / indices 为空，
+    // mapping 持有映射，网格还在使用时不会解除
+    const float* mapped_vertices = nullptr;
+    int mapped_vertex_count = 0;
+    const uint16_t* mapped_indices = nullptr;
+    int mapped_index_count = 0;
+    std::shared_ptr<const void> mapping;
+
+    int VertexCount() const {
+        return mapped_vertices != nullptr ? mapped_vertex_count : static_cast<int>(vertices.size() / 3);
+    }
+    int IndexCount() const {
+        return mapped_indices != nullptr ? mapped_index_count : static_cast<int>(indices.size());
+    }
+    bool HasBlend() const { return !weights.empty(); }
+};
+
+// 投影网格的生成算法（不依赖GL，也用于主机侧的网格工具）
+class MDMeshGenerator {
+public:
+    static void GenerateSphere(MDMeshData* mesh, float radius, int rings, int sectors);
+    static void GenerateDome(MDMeshData* mesh, float radius, int sectors, float degreeY, bool isUpper);
+    // 立方体：layout 为 MDCubeLayoutType，每个面的纹理坐标落在画面里这个面的格子内（去掉 padding 边距）
+    static void GenerateCube(MDMeshData* mesh, float size, int layout = MD_CUBE_LAYOUT_3X2, float padding = 0.0f);
+    // 双鱼眼球面：环绕镜头光轴（Z轴）排列，接缝带的两端各加一个环，保证混合权重在带内线性、带外恒定
+    static void GenerateDualFisheye(MDMeshData* mesh, float radius, int rings, int sectors,
+                                    const MDFisheyeLens lenses[MDDualFisheye::LENS_COUNT]);
+    // 平面：z = -1 处 x、y 为 [-1, 1] 的单位平面；curve_degree 大于0时是以原点为圆心、单位半径、水平张开
+    // curve_degree 度的弧形屏幕（y 仍为 [-1, 1]），按 columns 列分段。实际大小由模型矩阵缩放（MDPlaneScale）
+    static void GeneratePlane(MDMeshData* mesh, float curve_degree, int columns);
+};
+
+}
+}
+
+#endif //MD360PLAYER4OH_MD_MESH_GENERATOR_H
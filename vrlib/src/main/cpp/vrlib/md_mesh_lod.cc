@@ -0,0 +1,69 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#include "md_mesh_lod.h"
+#include <cmath>
+
+namespace asha {
+namespace vrlib {
+
+static const MDMeshLodParams LOD_PARAMS[MD_MESH_LOD_COUNT] = {
+    {24, 48},
+    {48, 96},
+    {75, 150},
+    {120, 240},  // (120 + 1) x (240 + 1) 个顶点，仍在16位索引范围内
+};
+
+// 一个网格分段在屏幕上的最大长度（像素）。等距柱状投影的纹理坐标在三角形内按线性插值，
+// 分段越长，视线方向和纹理方向的偏差越大（两极附近最明显）
+static const float MAX_SEGMENT_PIXELS = 48.0f;
+// 相邻级别的分段长度相差约 1.6 倍，降级的阈值取 0.75 倍足以避免来回切换
+static const float DOWNGRADE_RATIO = 0.75f;
+
+MDMeshLodParams MDMeshLod::GetParams(int level) {
+    return LOD_PARAMS[ClampLevel(level)];
+}
+
+int MDMeshLod::ClampLevel(int level) {
+    if (level < 0 || level >= MD_MESH_LOD_COUNT) {
+        return MD_MESH_LOD_HIGH;
+    }
+    return level;
+}
+
+int MDMeshLod::SelectLevel(int current_level, int viewport_height, float fov_y_degrees) {
+    if (viewport_height <= 0 || !(fov_y_degrees > 0.0f)) {
+        return ClampLevel(current_level);
+    }
+    float pixels_per_degree = static_cast<float>(viewport_height) / fov_y_degrees;
+    for (int level = 0; level < MD_MESH_LOD_COUNT; level++) {
+        float limit = MAX_SEGMENT_PIXELS;
+        if (current_level >= 0 && level < current_level) {
+            limit *= DOWNGRADE_RATIO;
+        }
+        float segment_pixels = 360.0f / LOD_PARAMS[level].sectors * pixels_per_degree;
+        if (segment_pixels <= limit) {
+            return level;
+        }
+    }
+    return MD_MESH_LOD_COUNT - 1;
+}
+
+float MDMeshLod::FovYFromMatrix(const float* matrix, float fallback) {
+    if (matrix == nullptr) {
+        return fallback;
+    }
+    // 列主序矩阵第二行的前三个元素是 P 的 y 缩放乘以 V 的旋转行，旋转不改变长度，长度即 1 / tan(fovY / 2)
+    float scale_y = std::sqrt(matrix[1] * matrix[1] + matrix[5] * matrix[5] + matrix[9] * matrix[9]);
+    // 透视投影的 w 行不为0，单位矩阵等非透视矩阵不能这样估计
+    if (!(scale_y > 1e-6f) || (matrix[3] == 0.0f && matrix[7] == 0.0f && matrix[11] == 0.0f)) {
+        return fallback;
+    }
+    return 2.0f * std::atan(1.0f / scale_y) * 180.0f / static_cast<float>(M_PI);
+}
+
+}
+}
@@ -0,0 +1,47 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef MD360PLAYER4OH_MD_MESH_LOD_H
+#define MD360PLAYER4OH_MD_MESH_LOD_H
+
+namespace asha {
+namespace vrlib {
+
+// 球面和穹顶网格的细分级别，MD_MESH_LOD_AUTO 表示按输出分辨率和视野自动选择
+enum MDMeshLodLevel {
+    MD_MESH_LOD_AUTO = -1,
+    MD_MESH_LOD_LOW = 0,     // 缩略图、小窗口
+    MD_MESH_LOD_MEDIUM,
+    MD_MESH_LOD_HIGH,        // 原来固定的 75 x 150
+    MD_MESH_LOD_ULTRA,       // 高分辨率、窄视野
+    MD_MESH_LOD_COUNT
+};
+
+struct MDMeshLodParams {
+    int rings = 0;
+    int sectors = 0;  // 穹顶只用 sectors，环数由 sectors 和角度决定
+};
+
+class MDMeshLod {
+public:
+    static MDMeshLodParams GetParams(int level);
+
+    // 超出范围的级别（包括 AUTO）返回 MD_MESH_LOD_HIGH
+    static int ClampLevel(int level);
+
+    // 按每个网格分段在屏幕上的长度选择最粗的级别：
+    // 分段对应的角度 × 每度像素数（viewport_height / fov_y_degrees）不超过 MAX_SEGMENT_PIXELS
+    // current_level 用于迟滞：降到更粗的级别时要求留出余量，视野在边界附近来回变化时不反复切换
+    static int SelectLevel(int current_level, int viewport_height, float fov_y_degrees);
+
+    // 从 P × V（V 只含旋转和平移）矩阵中取出垂直视野（度），矩阵无效时返回 fallback
+    static float FovYFromMatrix(const float* matrix, float fallback);
+};
+
+}
+}
+
+#endif //MD360PLAYER4OH_MD_MESH_LOD_H
@@ -0,0 +1,274 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#include "md_mesh_optimizer.h"
+#include <algorithm>
+#include <cmath>
+
+namespace asha {
+namespace vrlib {
+
+// Forsyth 打分参数（参考 "Linear-Speed Vertex Cache Optimisation"）
+static const int FORSYTH_CACHE_SIZE = 32;
+static const float FORSYTH_CACHE_DECAY_POWER = 1.5f;
+static const float FORSYTH_LAST_TRIANGLE_SCORE = 0.75f;
+static const float FORSYTH_VALENCE_BOOST_SCALE = 2.0f;
+static const float FORSYTH_VALENCE_BOOST_POWER = 0.5f;
+
+static float ForsythVertexScore(int cache_position, int remaining_triangles) {
+    if (remaining_triangles == 0) {
+        return -1.0f;
+    }
+    float score = 0.0f;
+    if (cache_position >= 0) {
+        if (cache_position < 3) {
+            // 刚用过的三个顶点分数固定，避免总是优先选和上一个三角形共边的三角形
+            score = FORSYTH_LAST_TRIANGLE_SCORE;
+        } else {
+            float scaler = 1.0f / (FORSYTH_CACHE_SIZE - 3);
+            score = powf(1.0f - (cache_position - 3) * scaler, FORSYTH_CACHE_DECAY_POWER);
+        }
+    }
+    // 剩余三角形少的顶点优先处理完，避免留下孤立的三角形
+    score += FORSYTH_VALENCE_BOOST_SCALE * powf(static_cast<float>(remaining_triangles), -FORSYTH_VALENCE_BOOST_POWER);
+    return score;
+}
+
+void MDMeshOptimizer::OptimizeVertexCache(std::vector<short>* indices, int vertex_count) {
+    if (indices == nullptr || indices->size() < 6 || vertex_count <= 0) {
+        return;
+    }
+    const std::vector<short>& input = *indices;
+    const size_t triangle_count = input.size() / 3;
+    for (size_t i = 0; i < triangle_count * 3; i++) {
+        if (static_cast<uint16_t>(input[i]) >= vertex_count) {
+            return;
+        }
+    }
+    auto vertex_at = [&input](size_t i) { return static_cast<int>(static_cast<uint16_t>(input[i])); };
+
+    // 每个顶点相邻的三角形，前 remaining[v] 个是还没输出的
+    std::vector<int> offsets(vertex_count + 1, 0);
+    for (size_t i = 0; i < triangle_count * 3; i++) {
+        offsets[vertex_at(i) + 1]++;
+    }
+    for (int v = 0; v < vertex_count; v++) {
+        offsets[v + 1] += offsets[v];
+    }
+    std::vector<int> adjacency(triangle_count * 3);
+    std::vector<int> fill(offsets.begin(), offsets.end() - 1);
+    for (size_t t = 0; t < triangle_count; t++) {
+        for (int k = 0; k < 3; k++) {
+            adjacency[fill[vertex_at(t * 3 + k)]++] = static_cast<int>(t);
+        }
+    }
+    std::vector<int> remaining(vertex_count);
+    std::vector<int> cache_position(vertex_count, -1);
+    std::vector<float> vertex_score(vertex_count);
+    for (int v = 0; v < vertex_count; v++) {
+        remaining[v] = offsets[v + 1] - offsets[v];
+        vertex_score[v] = ForsythVertexScore(-1, remaining[v]);
+    }
+    std::vector<float> triangle_score(triangle_count);
+    std::vector<bool> emitted(triangle_count, false);
+    int best = 0;
+    for (size_t t = 0; t < triangle_count; t++) {
+        triangle_score[t] = vertex_score[vertex_at(t * 3)] + vertex_score[vertex_at(t * 3 + 1)] +
+                            vertex_score[vertex_at(t * 3 + 2)];
+        if (triangle_score[t] > triangle_score[best]) {
+            best = static_cast<int>(t);
+        }
+    }
+
+    std::vector<short> output;
+    output.reserve(triangle_count * 3);
+    std::vector<int> cache;
+    std::vector<int> next_cache;
+    cache.reserve(FORSYTH_CACHE_SIZE + 3);
+    next_cache.reserve(FORSYTH_CACHE_SIZE + 3);
+    size_t scan_cursor = 0;
+    for (size_t count = 0; count < triangle_count; count++) {
+        if (best < 0) {
+            // 缓存里的顶点都没有剩余三角形了，按原顺序取下一个还没输出的三角形
+            while (emitted[scan_cursor]) {
+                scan_cursor++;
+            }
+            best = static_cast<int>(scan_cursor);
+        }
+        emitted[best] = true;
+        next_cache.clear();
+        for (int k = 0; k < 3; k++) {
+            int v = vertex_at(best * 3 + k);
+            output.push_back(input[best * 3 + k]);
+            int begin = offsets[v];
+            int end = begin + remaining[v];
+            for (int i = begin; i < end; i++) {
+                if (adjacency[i] == best) {
+                    adjacency[i] = adjacency[end - 1];
+                    break;
+                }
+            }
+            remaining[v]--;
+            if (std::find(next_cache.begin(), next_cache.end(), v) == next_cache.end()) {
+                next_cache.push_back(v);
+            }
+        }
+        size_t newest = next_cache.size();
+        for (int v : cache) {
+            if (std::find(next_cache.begin(), next_cache.begin() + newest, v) == next_cache.begin() + newest) {
+                next_cache.push_back(v);
+            }
+        }
+        // 被挤出缓存的顶点也要更新分数
+        for (size_t i = 0; i < next_cache.size(); i++) {
+            int v = next_cache[i];
+            cache_position[v] = i < FORSYTH_CACHE_SIZE ? static_cast<int>(i) : -1;
+            vertex_score[v] = ForsythVertexScore(cache_position[v], remaining[v]);
+        }
+        best = -1;
+        float best_score = -1.0f;
+        for (int v : next_cache) {
+            for (int i = offsets[v]; i < offsets[v] + remaining[v]; i++) {
+                int t = adjacency[i];
+                float score = vertex_score[vertex_at(t * 3)] + vertex_score[vertex_at(t * 3 + 1)] +
+                              vertex_score[vertex_at(t * 3 + 2)];
+                triangle_score[t] = score;
+                if (score > best_score) {
+                    best_score = score;
+                    best = t;
+                }
+            }
+        }
+        cache.assign(next_cache.begin(),
+                     next_cache.begin() + std::min(next_cache.size(), static_cast<size_t>(FORSYTH_CACHE_SIZE)));
+    }
+    indices->swap(output);
+}
+
+// 三角形的某个旋转 (x, y, z) 满足 x == a、y == b 时返回 z 的位置，否则返回 -1
+static int FindEdge(const short* triangle, short a, short b) {
+    for (int r = 0; r < 3; r++) {
+        if (triangle[r] == a && triangle[(r + 1) % 3] == b) {
+            return (r + 2) % 3;
+        }
+    }
+    return -1;
+}
+
+std::vector<short> MDMeshOptimizer::ConvertToStrips(const std::vector<short>& indices, int lookahead) {
+    const size_t triangle_count = indices.size() / 3;
+    const short restart = static_cast<short>(MD_PRIMITIVE_RESTART_INDEX);
+    std::vector<short> strip;
+    strip.reserve(indices.size());
+    std::vector<bool> emitted(triangle_count, false);
+    size_t first_pending = 0;
+    size_t strip_triangles = 0;
+    for (size_t count = 0; count < triangle_count; count++) {
+        while (emitted[first_pending]) {
+            first_pending++;
+        }
+        if (strip_triangles > 0) {
+            // 带中第 k 个三角形是 (s[k], s[k+1], s[k+2])，k 为奇数时绕序反转，所以需要
+            // k 为偶数：三角形某个旋转等于 (p, q, x)；k 为奇数：等于 (q, p, x)
+            short p = strip[strip.size() - 2];
+            short q = strip[strip.size() - 1];
+            bool odd = (strip_triangles % 2) == 1;
+            // 只在输入顺序的前 lookahead 个三角形里找，基本保留输入顺序的缓存局部性
+            size_t joined = triangle_count;
+            int apex = -1;
+            int scanned = 0;
+            for (size_t t = first_pending; t < triangle_count && scanned < lookahead; t++) {
+                if (emitted[t]) {
+                    continue;
+                }
+                scanned++;
+                apex = odd ? FindEdge(&indices[t * 3], q, p) : FindEdge(&indices[t * 3], p, q);
+                if (apex >= 0) {
+                    joined = t;
+                    break;
+                }
+            }
+            if (joined < triangle_count) {
+                strip.push_back(indices[joined * 3 + apex]);
+                emitted[joined] = true;
+                strip_triangles++;
+                continue;
+            }
+            strip.push_back(restart);
+        }
+        // 开始新带：起始旋转选能让下一个三角形接上的那个（第二个三角形需要包含有向边 (s2, s1)）
+        const short* triangle = &indices[first_pending * 3];
+        emitted[first_pending] = true;
+        int start_rotation = 0;
+        int scanned = 0;
+        for (size_t t = first_pending + 1; t < triangle_count && scanned < lookahead; t++) {
+            if (emitted[t]) {
+                continue;
+            }
+            scanned++;
+            bool found = false;
+            for (int r = 0; r < 3 && !found; r++) {
+                if (FindEdge(&indices[t * 3], triangle[(r + 2) % 3], triangle[(r + 1) % 3]) >= 0) {
+                    start_rotation = r;
+                    found = true;
+                }
+            }
+            if (found) {
+                break;
+            }
+        }
+        for (int k = 0; k < 3; k++) {
+            strip.push_back(triangle[(start_rotation + k) % 3]);
+        }
+        strip_triangles = 1;
+    }
+    return strip;
+}
+
+MDVertexCacheStats MDMeshOptimizer::AnalyzeVertexCache(const std::vector<short>& indices, int vertex_count,
+                                                       bool strip, int cache_size) {
+    MDVertexCacheStats stats;
+    if (vertex_count <= 0 || cache_size <= 0) {
+        return stats;
+    }
+    // FIFO 缓存：记录每个顶点进入缓存时的未命中序号，之后又有 cache_size 次未命中就被挤出
+    std::vector<int64_t> inserted_at(vertex_count, -1);
+    std::vector<bool> used(vertex_count, false);
+    int64_t misses = 0;
+    int64_t used_count = 0;
+    int64_t triangles = 0;
+    int run = 0;
+    for (short index : indices) {
+        uint16_t v = static_cast<uint16_t>(index);
+        if (strip && v == MD_PRIMITIVE_RESTART_INDEX) {
+            run = 0;
+            continue;
+        }
+        if (v >= vertex_count) {
+            continue;
+        }
+        if (inserted_at[v] < 0 || misses - inserted_at[v] >= cache_size) {
+            inserted_at[v] = misses;
+            misses++;
+        }
+        if (!used[v]) {
+            used[v] = true;
+            used_count++;
+        }
+        if (strip && ++run >= 3) {
+            triangles++;
+        }
+    }
+    if (!strip) {
+        triangles = static_cast<int64_t>(indices.size() / 3);
+    }
+    stats.acmr = triangles > 0 ? static_cast<double>(misses) / triangles : 0.0;
+    stats.atvr = used_count > 0 ? static_cast<double>(misses) / used_count : 0.0;
+    return stats;
+}
+
+}
+}
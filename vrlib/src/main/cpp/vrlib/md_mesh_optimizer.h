@@ -0,0 +1,48 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef MD360PLAYER4OH_MD_MESH_OPTIMIZER_H
+#define MD360PLAYER4OH_MD_MESH_OPTIMIZER_H
+
+#include <cstdint>
+#include <vector>
+
+namespace asha {
+namespace vrlib {
+
+// GLES3 的 glDrawElements 总是开启固定索引的图元重启，16位索引时为 0xFFFF
+static constexpr uint16_t MD_PRIMITIVE_RESTART_INDEX = 0xFFFF;
+
+// 顶点后变换缓存的模拟结果（FIFO 缓存）
+// ACMR：每个三角形平均的缓存未命中数（越低越好，规则网格的理论下限约 0.5）
+// ATVR：未命中数 / 实际用到的顶点数（1.0 表示每个顶点只变换一次）
+struct MDVertexCacheStats {
+    double acmr = 0.0;
+    double atvr = 0.0;
+};
+
+// 网格构建时的索引优化（不依赖GL）
+class MDMeshOptimizer {
+public:
+    static constexpr int DEFAULT_CACHE_SIZE = 32;
+
+    // Forsyth 的线性时间顶点缓存优化：按顶点在模拟 LRU 缓存中的位置和剩余三角形数打分，贪心选下一个三角形
+    static void OptimizeVertexCache(std::vector<short>* indices, int vertex_count);
+
+    // 三角形列表转成带图元重启的三角形带，保持每个三角形的绕序；返回转换后的索引
+    // 在输入顺序接下来的 lookahead 个三角形里找和带的最后一条边相接的三角形，找不到时插入
+    // MD_PRIMITIVE_RESTART_INDEX 开始新带（lookahead 越大带越长，但越偏离输入顺序的缓存局部性）
+    static std::vector<short> ConvertToStrips(const std::vector<short>& indices, int lookahead = 8);
+
+    // 模拟大小为 cache_size 的 FIFO 缓存，strip 为 true 时按带图元重启的三角形带解释索引
+    static MDVertexCacheStats AnalyzeVertexCache(const std::vector<short>& indices, int vertex_count,
+                                                 bool strip, int cache_size = DEFAULT_CACHE_SIZE);
+};
+
+}
+}
+
+#endif //MD360PLAYER4OH_MD_MESH_OPTIMIZER_H
@@ -1,11 +1,16 @@
 #include "md_object_3d.h"
+#include <chrono>
 #include <cmath>
 #include "md_log.h"
+#include "md_mesh_optimizer.h"
 
 namespace asha {
 namespace vrlib {
 
 MDObject3D::MDObject3D() : projection_type_(SPHERE) {
+    for (int i = 0; i < MDDualFisheye::LENS_COUNT; i++) {
+        fisheye_lenses_[i] = MDDualFisheye::DefaultLens(false, i);
+    }
 }
 
 MDObject3D::~MDObject3D() {
@@ -13,25 +18,108 @@ MDObject3D::~MDObject3D() {
 }
 
 void MDObject3D::LoadSphere() {
-    ClearData();
-    projection_type_ = SPHERE;
-    // 默认参数: radius=18, rings=75, sectors=150 (参考 MDSphere3D.java)
-    GenerateSphere(18.0f, 75, 150);
+    // 默认参数: radius=18, rings=75, sectors=150 (参考 MDSphere3D.java)，细分按当前级别
+    MDMeshLodParams lod = MDMeshLod::GetParams(lod_level_);
+    MDMeshKey key;
+    key.type = SPHERE;
+    key.radius = 18.0f;
+    key.rings = lod.rings;
+    key.sectors = lod.sectors;
+    LoadMesh(SPHERE, key, [lod](MDMeshData* mesh) {
+        MDMeshGenerator::GenerateSphere(mesh, 18.0f, lod.rings, lod.sectors);
+    });
 }
 
 void MDObject3D::LoadDome(float degree, bool isUpper) {
-    ClearData();
-    projection_type_ = isUpper ? (degree == 180.0f ? DOME180_UPPER : DOME230_UPPER) 
-                                : (degree == 180.0f ? DOME180 : DOME230);
-    // 默认参数: radius=18, sectors=150 (参考 MDDome3D.java)
-    GenerateDome(18.0f, 150, degree, isUpper);
+    ProjectionType type = isUpper ? (degree == 180.0f ? DOME180_UPPER : DOME230_UPPER)
+                                  : (degree == 180.0f ? DOME180 : DOME230);
+    // 默认参数: radius=18, sectors=150 (参考 MDDome3D.java)，细分按当前级别
+    int sectors = MDMeshLod::GetParams(lod_level_).sectors;
+    MDMeshKey key;
+    key.type = type;
+    key.radius = 18.0f;
+    key.sectors = sectors;
+    key.degree = degree;
+    LoadMesh(type, key, [sectors, degree, isUpper](MDMeshData* mesh) {
+        MDMeshGenerator::GenerateDome(mesh, 18.0f, sectors, degree, isUpper);
+    });
 }
 
 void MDObject3D::LoadCube() {
-    ClearData();
-    projection_type_ = CUBE;
-    // 立方体大小，使用与球体相同的半径以保持一致性
-    GenerateCube(18.0f);
+    // 立方体大小，使用与球体相同的半径以保持一致性；纹理坐标按画面排列生成，排列和边距进网格键
+    MDMeshKey key;
+    key.type = CUBE;
+    key.radius = 18.0f;
+    key.params = {static_cast<float>(cube_layout_), cube_padding_};
+    int layout = cube_layout_;
+    float padding = cube_padding_;
+    LoadMesh(CUBE, key, [layout, padding](MDMeshData* mesh) {
+        MDMeshGenerator::GenerateCube(mesh, 18.0f, layout, padding);
+    });
+}
+
+void MDObject3D::SetCubeLayout(int layout, float padding) {
+    if (layout == cube_layout_ && padding == cube_padding_) {
+        return;
+    }
+    cube_layout_ = layout;
+    cube_padding_ = padding;
+    if (projection_type_ == CUBE && (mesh_ != nullptr || IsLoading())) {
+        LoadCube();
+    }
+}
+
+void MDObject3D::LoadPlane() {
+    // 平面只有一列，弧形屏幕每 2.5 度一列；弧度进网格键
+    float curve = plane_curve_;
+    int columns = curve > 0.0f ? static_cast<int>(std::ceil(curve / 2.5f)) : 1;
+    MDMeshKey key;
+    key.type = PLANE;
+    key.radius = 1.0f;
+    key.sectors = columns;
+    key.params = {curve};
+    LoadMesh(PLANE, key, [curve, columns](MDMeshData* mesh) {
+        MDMeshGenerator::GeneratePlane(mesh, curve, columns);
+    });
+}
+
+void MDObject3D::SetPlaneCurve(float curve_degree) {
+    if (curve_degree == plane_curve_) {
+        return;
+    }
+    plane_curve_ = curve_degree;
+    if (projection_type_ == PLANE && (mesh_ != nullptr || IsLoading())) {
+        LoadPlane();
+    }
+}
+
+void MDObject3D::LoadDualFisheye(bool vertical) {
+    // 与球面相同的半径和细分级别，标定参数进网格键，换标定时重新生成
+    ProjectionType type = vertical ? DUAL_FISHEYE_VERTICAL : DUAL_FISHEYE_HORIZONTAL;
+    MDMeshLodParams lod = MDMeshLod::GetParams(lod_level_);
+    MDMeshKey key;
+    key.type = type;
+    key.radius = 18.0f;
+    key.rings = lod.rings;
+    key.sectors = lod.sectors;
+    for (const MDFisheyeLens& lens : fisheye_lenses_) {
+        key.params.insert(key.params.end(), {lens.center_x, lens.center_y, lens.radius_x, lens.radius_y, lens.fov});
+    }
+    MDFisheyeLens lenses[MDDualFisheye::LENS_COUNT] = {fisheye_lenses_[0], fisheye_lenses_[1]};
+    LoadMesh(type, key, [lod, lenses](MDMeshData* mesh) {
+        MDMeshGenerator::GenerateDualFisheye(mesh, 18.0f, lod.rings, lod.sectors, lenses);
+    });
+}
+
+void MDObject3D::SetFisheyeLenses(const MDFisheyeLens lenses[MDDualFisheye::LENS_COUNT]) {
+    bool changed = false;
+    for (int i = 0; i < MDDualFisheye::LENS_COUNT; i++) {
+        changed = changed || fisheye_lenses_[i] != lenses[i];
+        fisheye_lenses_[i] = lenses[i];
+    }
+    if (changed && IsDualFisheye(projection_type_) && (mesh_ != nullptr || IsLoading())) {
+        LoadDualFisheye(projection_type_ == DUAL_FISHEYE_VERTICAL);
+    }
 }
 
 void MDObject3D::SetProjectionType(ProjectionType type) {
@@ -53,267 +141,137 @@ void MDObject3D::SetProjectionType(ProjectionType type) {
         case DOME230_UPPER:
             LoadDome(230.0f, true);
             break;
+        case DUAL_FISHEYE_HORIZONTAL:
+            LoadDualFisheye(false);
+            break;
+        case DUAL_FISHEYE_VERTICAL:
+            LoadDualFisheye(true);
+            break;
         case CUBE:
             LoadCube();
             break;
+        case PLANE:
+            LoadPlane();
+            break;
         default:
             LoadSphere();
             break;
     }
 }
 
-void MDObject3D::ClearData() {
-    vertices_.clear();
-    texcoords_.clear();
-    indices_.clear();
-    num_indices_ = 0;
-    data_uploaded_ = false;
-    
-    // 如果已经上传到 GPU，需要先销毁
-    if (vbo_vertices_ != 0 || vbo_texcoords_ != 0 || ibo_indices_ != 0) {
-        Destroy();
+void MDObject3D::SetLodLevel(int level) {
+    level = MDMeshLod::ClampLevel(level);
+    if (level == lod_level_) {
+        return;
+    }
+    lod_level_ = level;
+    // 已经加载过网格时按新级别重新取（用过的级别直接命中网格缓存），立方体和平面与细分无关
+    if ((mesh_ != nullptr || IsLoading()) && projection_type_ != CUBE && projection_type_ != PLANE) {
+        SetProjectionType(projection_type_);
     }
 }
 
-void MDObject3D::GenerateSphere(float radius, int rings, int sectors) {
-    const float PI = 3.14159265358979323846f;
-    const float PI_2 = PI / 2.0f;
-
-    float R = 1.0f / (float)rings;
-    float S = 1.0f / (float)sectors;
-    
-    int numPoint = (rings + 1) * (sectors + 1);
-    
-    vertices_.resize(numPoint * 3);
-    texcoords_.resize(numPoint * 2);
-    indices_.resize(rings * sectors * 6);
-
-    int t = 0, v = 0;
-    for(int r = 0; r < rings + 1; r++) {
-        for(int s = 0; s < sectors + 1; s++) {
-            float x = (float) (cos(2*PI * s * S) * sin( PI * r * R ));
-            float y = - (float) sin( -PI_2 + PI * r * R );
-            float z = (float) (sin(2*PI * s * S) * sin( PI * r * R ));
-
-            texcoords_[t++] = s*S;
-            texcoords_[t++] = 1 - r*R;
+int MDObject3D::GetTriangleCount() const {
+    return mesh_ != nullptr ? mesh_->triangle_count : 0;
+}
 
-            vertices_[v++] = x * radius;
-            vertices_[v++] = y * radius;
-            vertices_[v++] = z * radius;
-        }
+void MDObject3D::LoadMesh(ProjectionType type, const MDMeshKey& key, MDMeshCache::Generator generate) {
+    // 投影模式不同时旧网格不能再画；同一投影只换细分级别时旧网格继续绘制到新网格就绪
+    if (type != projection_type_) {
+        ClearData();
     }
+    projection_type_ = type;
+    pending_key_ = key;
+    pending_key_.triangle_strip = triangle_strips_enabled_;
+    // 用过的投影模式直接从缓存取，不重新生成；生成时顺带做一次索引优化（都在工作线程中）
+    bool triangle_strip = triangle_strips_enabled_;
+    pending_mesh_ = MDMeshCache::GetInstance().AcquireMesh(
+        pending_key_, [generate = std::move(generate), triangle_strip](MDMeshData* mesh) {
+            generate(mesh);
+            OptimizeIndices(mesh, triangle_strip);
+        });
+    // 缓存命中时已经就绪，直接换上
+    PollPendingMesh();
+}
 
-    int counter = 0;
-    int sectorsPlusOne = sectors + 1;
-    for(int r = 0; r < rings; r++){
-        for(int s = 0; s < sectors; s++) {
-            indices_[counter++] = (short) (r * sectorsPlusOne + s);       //(a)
-            indices_[counter++] = (short) ((r+1) * sectorsPlusOne + (s));    //(b)
-            indices_[counter++] = (short) ((r) * sectorsPlusOne + (s+1));  // (c)
-            indices_[counter++] = (short) ((r) * sectorsPlusOne + (s+1));  // (c)
-            indices_[counter++] = (short) ((r+1) * sectorsPlusOne + (s));    //(b)
-            indices_[counter++] = (short) ((r+1) * sectorsPlusOne + (s+1));  // (d)
-        }
+bool MDObject3D::PollPendingMesh() {
+    if (!pending_mesh_.valid() ||
+        pending_mesh_.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+        return false;
     }
-    
-    num_indices_ = indices_.size();
+    Destroy();
+    mesh_ = pending_mesh_.get();
+    mesh_key_ = pending_key_;
+    pending_mesh_ = MDMeshCache::MeshFuture();
+    return true;
 }
 
-void MDObject3D::GenerateDome(float radius, int sectors, float degreeY, bool isUpper) {
-    const float PI = 3.14159265358979323846f;
-    const float PI_2 = PI / 2.0f;
-    
-    float percent = degreeY / 360.0f;
-    int rings = sectors >> 1;  // sectors / 2
-    
-    float R = 1.0f / (float)rings;
-    float S = 1.0f / (float)sectors;
-    
-    int lenRings = (int)(rings * percent) + 1;
-    int lenSectors = sectors + 1;
-    int numPoint = lenRings * lenSectors;
-    
-    vertices_.resize(numPoint * 3);
-    texcoords_.resize(numPoint * 2);
-    indices_.resize((lenRings - 1) * (lenSectors - 1) * 6);
-    
-    int upper = isUpper ? 1 : -1;
-    
-    int t = 0, v = 0;
-    for (int r = 0; r < lenRings; r++) {
-        for (int s = 0; s < lenSectors; s++) {
-            float x = (float)(cos(2 * PI * s * S) * sin(PI * r * R)) * upper;
-            float y = (float)sin(-PI_2 + PI * r * R) * -upper;
-            float z = (float)(sin(2 * PI * s * S) * sin(PI * r * R));
-            
-            // 纹理坐标计算（参考 Android 实现）
-            float a = (float)(cos(2 * PI * s * S) * r * R / percent) / 2.0f + 0.5f;
-            float b = (float)(sin(2 * PI * s * S) * r * R / percent) / 2.0f + 0.5f;
-            
-            texcoords_[t++] = b;
-            texcoords_[t++] = a;
-            
-            vertices_[v++] = x * radius;
-            vertices_[v++] = y * radius;
-            vertices_[v++] = z * radius;
-        }
-    }
-    
-    int counter = 0;
-    for (int r = 0; r < lenRings - 1; r++) {
-        for (int s = 0; s < lenSectors - 1; s++) {
-            indices_[counter++] = (short)(r * lenSectors + s);
-            indices_[counter++] = (short)((r + 1) * lenSectors + s);
-            indices_[counter++] = (short)(r * lenSectors + (s + 1));
-            indices_[counter++] = (short)(r * lenSectors + (s + 1));
-            indices_[counter++] = (short)((r + 1) * lenSectors + s);
-            indices_[counter++] = (short)((r + 1) * lenSectors + (s + 1));
-        }
-    }
-    
-    num_indices_ = counter;
+void MDObject3D::OptimizeIndices(MDMeshData* mesh, bool triangle_strip) {
+    int vertex_count = static_cast<int>(mesh->vertices.size() / 3);
+    MDVertexCacheStats before = MDMeshOptimizer::AnalyzeVertexCache(mesh->indices, vertex_count, false);
+    size_t index_count = mesh->indices.size();
+    mesh->triangle_count = static_cast<int>(index_count / 3);
+    MDMeshCulling::BuildPatches(mesh, triangle_strip);
+    MDVertexCacheStats after = MDMeshOptimizer::AnalyzeVertexCache(mesh->indices, vertex_count, triangle_strip);
+    MD_LOGI("MDObject3D: index optimization ACMR %.3f -> %.3f, ATVR %.3f -> %.3f, indices %zu -> %zu, %zu patches",
+            before.acmr, after.acmr, before.atvr, after.atvr, index_count, mesh->indices.size(),
+            mesh->patches.size());
 }
 
-void MDObject3D::GenerateCube(float size) {
-    // 立方体有 6 个面，每个面有 2 个三角形，共 12 个三角形，36 个顶点（每个顶点重复 3 次）
-    // 为了简化，我们使用索引缓冲区，每个面 4 个顶点，共 24 个顶点
-    const int numVertices = 24;  // 6 个面 * 4 个顶点
-    const int numIndices = 36;   // 6 个面 * 2 个三角形 * 3 个顶点
-    
-    vertices_.resize(numVertices * 3);
-    texcoords_.resize(numVertices * 2);
-    indices_.resize(numIndices);
-    
-    float halfSize = size / 2.0f;
-    
-    // 定义立方体的 8 个顶点
-    float vertices[8][3] = {
-        {-halfSize, -halfSize, -halfSize},  // 0: 左下后
-        { halfSize, -halfSize, -halfSize},  // 1: 右下后
-        { halfSize,  halfSize, -halfSize},  // 2: 右上后
-        {-halfSize,  halfSize, -halfSize},  // 3: 左上后
-        {-halfSize, -halfSize,  halfSize},  // 4: 左下前
-        { halfSize, -halfSize,  halfSize},  // 5: 右下前
-        { halfSize,  halfSize,  halfSize},  // 6: 右上前
-        {-halfSize,  halfSize,  halfSize}   // 7: 左上前
-    };
-    
-    // 定义 6 个面的顶点索引（每个面 4 个顶点）
-    int faces[6][4] = {
-        {0, 1, 2, 3},  // 后面 (Z-)
-        {5, 4, 7, 6},  // 前面 (Z+)
-        {4, 0, 3, 7},  // 左面 (X-)
-        {1, 5, 6, 2},  // 右面 (X+)
-        {4, 5, 1, 0},  // 下面 (Y-)
-        {3, 2, 6, 7}   // 上面 (Y+)
-    };
-    
-    // 定义每个面的纹理坐标
-    float texCoords[4][2] = {
-        {0.0f, 0.0f},  // 左下
-        {1.0f, 0.0f},  // 右下
-        {1.0f, 1.0f},  // 右上
-        {0.0f, 1.0f}   // 左上
-    };
-    
-    // 填充顶点和纹理坐标
-    int v = 0, t = 0;
-    for (int face = 0; face < 6; face++) {
-        for (int vertex = 0; vertex < 4; vertex++) {
-            int vertexIndex = faces[face][vertex];
-            vertices_[v++] = vertices[vertexIndex][0];
-            vertices_[v++] = vertices[vertexIndex][1];
-            vertices_[v++] = vertices[vertexIndex][2];
-            
-            texcoords_[t++] = texCoords[vertex][0];
-            texcoords_[t++] = texCoords[vertex][1];
-        }
-    }
-    
-    // 填充索引（每个面 2 个三角形）
-    int counter = 0;
-    for (int face = 0; face < 6; face++) {
-        int base = face * 4;
-        // 第一个三角形
-        indices_[counter++] = (short)(base + 0);
-        indices_[counter++] = (short)(base + 1);
-        indices_[counter++] = (short)(base + 2);
-        // 第二个三角形
-        indices_[counter++] = (short)(base + 0);
-        indices_[counter++] = (short)(base + 2);
-        indices_[counter++] = (short)(base + 3);
-    }
-    
-    num_indices_ = counter;
+void MDObject3D::ClearData() {
+    Destroy();
+    mesh_ = nullptr;
+    pending_mesh_ = MDMeshCache::MeshFuture();
 }
 
 void MDObject3D::UploadData() {
-    if (vertices_.empty()) return;
-
-    if (vbo_vertices_ == 0) {
-        glGenBuffers(1, &vbo_vertices_);
-        glGenBuffers(1, &vbo_texcoords_);
-        glGenBuffers(1, &ibo_indices_);
-    }
-
-    glBindBuffer(GL_ARRAY_BUFFER, vbo_vertices_);
-    glBufferData(GL_ARRAY_BUFFER, vertices_.size() * sizeof(float), vertices_.data(), GL_STATIC_DRAW);
-
-    glBindBuffer(GL_ARRAY_BUFFER, vbo_texcoords_);
-    glBufferData(GL_ARRAY_BUFFER, texcoords_.size() * sizeof(float), texcoords_.data(), GL_STATIC_DRAW);
-
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo_indices_);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices_.size() * sizeof(short), indices_.data(), GL_STATIC_DRAW);
-    
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-    
-    data_uploaded_ = true;
+    PollPendingMesh();
+    if (mesh_ == nullptr) return;
+    // 同一个上下文里已经上传过的网格直接复用缓冲
+    buffers_ = MDMeshCache::GetInstance().AcquireBuffers(mesh_key_, mesh_);
 }
 
-void MDObject3D::Draw() {
-    if (!data_uploaded_) {
+int MDObject3D::Draw(const float* mvp_matrix, int* draw_calls) {
+    if (draw_calls != nullptr) {
+        *draw_calls = 0;
+    }
+    if (buffers_ == nullptr) {
         UploadData();
     }
     
-    if (vbo_vertices_ == 0) return;
-
-    // 绑定 VBO
-    glBindBuffer(GL_ARRAY_BUFFER, vbo_vertices_);
-    // 假设 layout 0 是 position
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, 0);
+    if (buffers_ == nullptr) return 0;
 
-    glBindBuffer(GL_ARRAY_BUFFER, vbo_texcoords_);
-    // 假设 layout 1 是 texCoord
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 0, 0);
-
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo_indices_);
-    glDrawElements(GL_TRIANGLES, num_indices_, GL_UNSIGNED_SHORT, 0);
-
-    glDisableVertexAttribArray(0);
-    glDisableVertexAttribArray(1);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-}
-
-void MDObject3D::Destroy() {
-    if (vbo_vertices_ != 0) {
-        glDeleteBuffers(1, &vbo_vertices_);
-        vbo_vertices_ = 0;
+    int triangles = mesh_->triangle_count;
+    draw_ranges_.clear();
+    if (mvp_matrix != nullptr) {
+        frustum_.SetMatrix(mvp_matrix);
+        triangles = MDMeshCulling::CullPatches(*mesh_, frustum_, &draw_ranges_);
+    } else {
+        MDDrawRange range;
+        range.index_count = buffers_->num_indices;
+        draw_ranges_.push_back(range);
     }
-    if (vbo_texcoords_ != 0) {
-        glDeleteBuffers(1, &vbo_texcoords_);
-        vbo_texcoords_ = 0;
+    if (draw_ranges_.empty()) {
+        return 0;
     }
-    if (ibo_indices_ != 0) {
-        glDeleteBuffers(1, &ibo_indices_);
-        ibo_indices_ = 0;
+
+    // 顶点属性和 IBO 都已经记录在 VAO 里；绘制后解绑，避免其他代码在默认 VAO 上的属性设置改到这个 VAO
+    glBindVertexArray(buffers_->vao);
+    for (const MDDrawRange& range : draw_ranges_) {
+        glDrawElements(buffers_->mode, range.index_count, GL_UNSIGNED_SHORT,
+                       reinterpret_cast<const void*>(range.first_index * sizeof(short)));
+    }
+    glBindVertexArray(0);
+    if (draw_calls != nullptr) {
+        *draw_calls = static_cast<int>(draw_ranges_.size());
     }
-    data_uploaded_ = false;
+    return triangles;
 }
 
+void MDObject3D::Destroy() {
+    // 只放掉对缓冲的引用，没人使用的缓冲由 MDMeshCache::ReleaseUnusedBuffers 在GL线程中删除
+    buffers_ = nullptr;
 }
+
 }
+}
\ No newline at end of file
@@ -1,7 +1,12 @@
 #pragma once
 
+#include <memory>
 #include <vector>
 #include <GLES3/gl3.h>
+#include "md_dual_fisheye.h"
+#include "md_mesh_cache.h"
+#include "md_mesh_culling.h"
+#include "md_mesh_lod.h"
 
 namespace asha {
 namespace vrlib {
@@ -15,6 +20,9 @@ public:
         DOME230 = 203,
         DOME180_UPPER = 204,
         DOME230_UPPER = 205,
+        PLANE = 207,  // 207 / 208 / 209 共用，缩放方式由渲染器按投影模式决定
+        DUAL_FISHEYE_HORIZONTAL = 210,
+        DUAL_FISHEYE_VERTICAL = 211,
         CUBE = 214,
     };
 
@@ -25,43 +33,79 @@ public:
     void LoadSphere();
     void LoadDome(float degree, bool isUpper);
     void LoadCube();
+    // 双鱼眼：镜头画面左右（vertical 为 false）或上下排列，网格按当前的镜头标定生成
+    void LoadDualFisheye(bool vertical);
+    // 平面：单位平面，或眼镜模式下的弧形屏幕（SetPlaneCurve）
+    void LoadPlane();
     
     // 设置投影模式（便捷方法）
     void SetProjectionType(ProjectionType type);
     ProjectionType GetProjectionType() const { return projection_type_; }
+    static bool IsDualFisheye(int type) { return type == DUAL_FISHEYE_HORIZONTAL || type == DUAL_FISHEYE_VERTICAL; }
+
+    // 立方体贴图的画面排列（MDCubeLayoutType）和面的边距，变化且当前是立方体时重新生成网格
+    void SetCubeLayout(int layout, float padding);
+    int GetCubeLayout() const { return cube_layout_; }
+    float GetCubePadding() const { return cube_padding_; }
+
+    // 平面屏幕的弧度（度，0 为平面），变化且当前是平面时重新生成网格
+    void SetPlaneCurve(float curve_degree);
+    float GetPlaneCurve() const { return plane_curve_; }
+
+    // 双鱼眼的镜头标定（已经换成实际使用的值，见 MDDualFisheye::ResolveLens），
+    // 标定变化且当前是双鱼眼时按新标定重新生成网格，生成期间继续绘制旧网格
+    void SetFisheyeLenses(const MDFisheyeLens lenses[MDDualFisheye::LENS_COUNT]);
     
-    // 上传数据到 GPU
+    // 球面和穹顶的细分级别（MDMeshLodLevel），已加载网格时立即按新级别重新加载
+    void SetLodLevel(int level);
+    int GetLodLevel() const { return lod_level_; }
+    int GetTriangleCount() const;
+
+    // 网格在工作线程中生成，还没就绪时继续绘制之前的网格（切换细分级别时）或什么都不画（切换投影模式时）
+    bool IsLoading() const { return pending_mesh_.valid(); }
+    // GL线程每帧调用：生成好的网格换成当前网格（下次绘制时上传），返回是否换了
+    bool PollPendingMesh();
+
+    // 生成三角形带（带图元重启）代替三角形列表，默认关闭，下一次 Load 时生效
+    // 32项的顶点缓存下 ACMR 与优化后的三角形列表相同、索引少约三分之一，缓存更小时 ACMR 略差
+    void SetTriangleStripsEnabled(bool enabled) { triangle_strips_enabled_ = enabled; }
+
+    // 上传数据到 GPU（同一上下文中已上传过的网格直接复用），先接收已经生成好的网格
     void UploadData();
     
-    // 执行绘制
-    void Draw();
+    // 执行绘制：传入本次绘制用的 MVP 矩阵时先剔除视锥外的网格分块，只提交可见的部分
+    // 返回提交的三角形数，draw_calls 非空时写入 glDrawElements 的次数
+    int Draw(const float* mvp_matrix = nullptr, int* draw_calls = nullptr);
 
-    // 销毁资源
+    // 释放对GPU缓冲的引用（网格数据保留，可再次 UploadData）
     void Destroy();
 
 private:
-    // 生成不同几何体的算法
-    void GenerateSphere(float radius, int rings, int sectors);
-    void GenerateDome(float radius, int sectors, float degreeY, bool isUpper);
-    void GenerateCube(float size);
+    // 从进程共享的网格缓存取几何体，缓存里没有时在工作线程中生成
+    void LoadMesh(ProjectionType type, const MDMeshKey& key, MDMeshCache::Generator generate);
+    // 网格生成后按角度分块，块内按顶点缓存重排索引（可选转成三角形带），并输出优化前后的 ACMR / ATVR
+    static void OptimizeIndices(MDMeshData* mesh, bool triangle_strip);
     
     // 清空当前数据
     void ClearData();
 
 private:
     ProjectionType projection_type_ = SPHERE;
+    bool triangle_strips_enabled_ = false;
+    int lod_level_ = MD_MESH_LOD_HIGH;
+    MDFisheyeLens fisheye_lenses_[MDDualFisheye::LENS_COUNT];
+    int cube_layout_ = MD_CUBE_LAYOUT_3X2;
+    float cube_padding_ = 0.0f;
+    float plane_curve_ = 0.0f;
 
 private:
-    std::vector<float> vertices_;
-    std::vector<float> texcoords_;
-    std::vector<short> indices_;
-
-    GLuint vbo_vertices_ = 0;
-    GLuint vbo_texcoords_ = 0;
-    GLuint ibo_indices_ = 0;
-    
-    int num_indices_ = 0;
-    bool data_uploaded_ = false;
+    MDMeshKey mesh_key_;
+    std::shared_ptr<const MDMeshData> mesh_;
+    std::shared_ptr<const MDMeshBuffers> buffers_;
+    MDMeshKey pending_key_;
+    MDMeshCache::MeshFuture pending_mesh_;
+    MDFrustum frustum_;
+    std::vector<MDDrawRange> draw_ranges_;
 };
 
 }
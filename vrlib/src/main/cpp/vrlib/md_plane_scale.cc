@@ -0,0 +1,87 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#include "md_plane_scale.h"
+#include <cmath>
+
+namespace asha {
+namespace vrlib {
+
+bool MDPlaneScale::IsValid(int scale_type, float curve_degree) {
+    return scale_type >= 0 && scale_type < MD_PLANE_SCALE_COUNT && curve_degree >= 0.0f &&
+           curve_degree <= MAX_CURVE_DEGREE;
+}
+
+int MDPlaneScale::Resolve(int scale_type, int mode) {
+    if (scale_type != MD_PLANE_SCALE_DEFAULT) {
+        return scale_type;
+    }
+    switch (mode) {
+        case 208: // PROJECTION_MODE_PLANE_CROP
+            return MD_PLANE_SCALE_CROP;
+        case 209: // PROJECTION_MODE_PLANE_FULL
+            return MD_PLANE_SCALE_FULL;
+        default:  // PROJECTION_MODE_PLANE_FIT
+            return MD_PLANE_SCALE_FIT;
+    }
+}
+
+float MDPlaneScale::VideoRatio(int buffer_width, int buffer_height, const float* st_matrix) {
+    if (buffer_width <= 0 || buffer_height <= 0) {
+        return DEFAULT_VIDEO_RATIO;
+    }
+    float width = std::hypot(st_matrix[0] * buffer_width, st_matrix[1] * buffer_height);
+    float height = std::hypot(st_matrix[4] * buffer_width, st_matrix[5] * buffer_height);
+    if (width <= 0.0f || height <= 0.0f) {
+        return DEFAULT_VIDEO_RATIO;
+    }
+    return width / height;
+}
+
+void MDPlaneScale::Calculate(int scale_type, float video_ratio, float viewport_ratio, float* scale_x,
+                             float* scale_y) {
+    // 视频比视口宽多少倍
+    float ratio = viewport_ratio > 0.0f ? video_ratio / viewport_ratio : 1.0f;
+    bool fit_width = true;
+    switch (scale_type) {
+        case MD_PLANE_SCALE_FULL:
+            *scale_x = 1.0f;
+            *scale_y = 1.0f;
+            return;
+        case MD_PLANE_SCALE_FIT_WIDTH:
+            fit_width = true;
+            break;
+        case MD_PLANE_SCALE_FIT_HEIGHT:
+            fit_width = false;
+            break;
+        case MD_PLANE_SCALE_CROP:
+            fit_width = ratio < 1.0f;
+            break;
+        default:
+            fit_width = ratio > 1.0f;
+            break;
+    }
+    *scale_x = fit_width ? 1.0f : ratio;
+    *scale_y = fit_width ? 1.0f / ratio : 1.0f;
+}
+
+void MDPlaneScale::ScreenScale(float video_ratio, float curve_degree, float* scale) {
+    if (curve_degree <= 0.0f) {
+        float half_width = SCREEN_DISTANCE * std::tan(FLAT_SCREEN_FOV * 0.5f * static_cast<float>(M_PI) / 180.0f);
+        scale[0] = half_width;
+        scale[1] = half_width / video_ratio;
+        scale[2] = SCREEN_DISTANCE;
+        return;
+    }
+    // 弧形屏幕以观看者为圆心，弧长按宽高比换成高度
+    float arc_length = SCREEN_DISTANCE * curve_degree * static_cast<float>(M_PI) / 180.0f;
+    scale[0] = SCREEN_DISTANCE;
+    scale[1] = arc_length * 0.5f / video_ratio;
+    scale[2] = SCREEN_DISTANCE;
+}
+
+}
+}
@@ -0,0 +1,54 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef MD360PLAYER4OH_MD_PLANE_SCALE_H
+#define MD360PLAYER4OH_MD_PLANE_SCALE_H
+
+namespace asha {
+namespace vrlib {
+
+// 平面投影的缩放方式（参考 PlaneProjection.ets 的 PlaneScaleCalculatorImpl）
+enum MDPlaneScaleType {
+    MD_PLANE_SCALE_DEFAULT = 0,  // 按投影模式：207 完整显示，208 裁剪铺满，209 拉伸铺满
+    MD_PLANE_SCALE_FIT,          // 完整显示，宽或高贴满视口，另一边留黑
+    MD_PLANE_SCALE_FIT_WIDTH,    // 宽贴满视口，高按比例（可能超出视口被裁掉）
+    MD_PLANE_SCALE_FIT_HEIGHT,   // 高贴满视口，宽按比例
+    MD_PLANE_SCALE_CROP,         // 铺满视口，多出的一边裁掉
+    MD_PLANE_SCALE_FULL,         // 拉伸铺满视口，不保持宽高比
+    MD_PLANE_SCALE_COUNT
+};
+
+// 平面投影的网格是 [-1, 1] 的单位平面（z = -1）或单位半径的弧形屏幕（MDMeshGenerator::GeneratePlane），
+// 普通模式下直接缩放到视口里（不受触控和陀螺仪影响），眼镜模式下按视频宽高比放在观看者前方
+class MDPlaneScale {
+public:
+    // 眼镜模式下屏幕到观看者的距离，平面屏幕的水平视角（度），弧形屏幕最大的弧度（度）
+    static constexpr float SCREEN_DISTANCE = 4.0f;
+    static constexpr float FLAT_SCREEN_FOV = 70.0f;
+    static constexpr float MAX_CURVE_DEGREE = 180.0f;
+    // 还不知道视频尺寸时按 16:9
+    static constexpr float DEFAULT_VIDEO_RATIO = 16.0f / 9.0f;
+
+    static bool IsValid(int scale_type, float curve_degree);
+    static bool IsPlaneMode(int mode) { return mode >= 207 && mode <= 209; }
+
+    // scale_type 为 DEFAULT 时换成投影模式对应的缩放方式
+    static int Resolve(int scale_type, int mode);
+
+    // 画面的宽高比：缓冲区尺寸（像素）乘上纹理坐标变换（包含解码器的裁剪和旋转）后，网格 s、t 方向上的长度之比
+    static float VideoRatio(int buffer_width, int buffer_height, const float* st_matrix);
+
+    // 普通模式：单位平面在标准化设备坐标里的半宽、半高（大于1的部分在视口外）
+    static void Calculate(int scale_type, float video_ratio, float viewport_ratio, float* scale_x, float* scale_y);
+
+    // 眼镜模式：单位平面（或弧形屏幕）的模型缩放 xyz，curve_degree 为0时是平面屏幕
+    static void ScreenScale(float video_ratio, float curve_degree, float* scale);
+};
+
+}
+}
+
+#endif //MD360PLAYER4OH_MD_PLANE_SCALE_H
@@ -0,0 +1,63 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef MD360PLAYER4OH_MD_POSE_MAILBOX_H
+#define MD360PLAYER4OH_MD_POSE_MAILBOX_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include "md_pose_predictor.h"
+#include "md_triple_buffer.h"
+
+namespace asha {
+namespace vrlib {
+
+// 带时间戳的头部姿态（传感器旋转矩阵）
+struct MDPose {
+    float matrix[16] = {
+        1.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 1.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 1.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.0f
+    };
+    int64_t timestamp_ns = 0;  // 姿态采样时间（MDNowNs 时间域）
+    uint64_t sequence = 0;     // 每次发布递增，0 表示还没有收到过姿态
+    float angular_velocity[3] = {0.0f, 0.0f, 0.0f};  // 由相邻姿态估计出的角速度（rad/s），用于姿态预测
+};
+
+// 姿态信箱：传感器侧随时投递最新姿态，GL线程在上传每只眼睛的矩阵前无阻塞地取最新值（late latch）
+class MDPoseMailbox {
+public:
+    // 投递新姿态，返回姿态是否和上一次不同
+    bool Publish(const float* matrix, int64_t timestamp_ns) {
+        bool changed = false;
+        poses_.Update([&](MDPose& pose) {
+            changed = pose.sequence == 0 || memcmp(matrix, pose.matrix, sizeof(pose.matrix)) != 0;
+            // 工作副本里还是上一次的姿态，先用它估计角速度再覆盖
+            float angular_velocity[3];
+            MDPosePredictor::EstimateAngularVelocity(pose, matrix, timestamp_ns, angular_velocity);
+            std::copy(angular_velocity, angular_velocity + 3, pose.angular_velocity);
+            std::copy(matrix, matrix + 16, pose.matrix);
+            pose.timestamp_ns = timestamp_ns;
+            pose.sequence++;
+        });
+        return changed;
+    }
+
+    // 取最新姿态（仅限GL线程调用）
+    MDPose Latch() {
+        return poses_.Read();
+    }
+
+private:
+    MDTripleBuffer<MDPose> poses_;
+};
+
+}
+}
+
+#endif //MD360PLAYER4OH_MD_POSE_MAILBOX_H
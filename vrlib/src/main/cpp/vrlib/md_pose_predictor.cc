@@ -0,0 +1,116 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#include "md_pose_predictor.h"
+#include <algorithm>
+#include <cmath>
+#include "md_pose_mailbox.h"
+
+namespace asha {
+namespace vrlib {
+
+// 新估计值的权重，越大响应越快、抖动越大
+static constexpr float VELOCITY_SMOOTHING = 0.6f;
+// 间隔小于这个值的两次采样视为重复数据，不更新角速度
+static constexpr int64_t MIN_SAMPLE_INTERVAL_NS = 500000LL;
+// 间隔大于这个值说明中间丢了数据（暂停、切后台），不再信任旧的角速度
+static constexpr int64_t MAX_SAMPLE_INTERVAL_NS = 100000000LL;
+// 人头转动的角速度上限（约 1150 度/秒），超出的按传感器毛刺截断
+static constexpr float MAX_ANGULAR_SPEED = 20.0f;
+
+static inline float M(const float* m, int row, int col) {
+    return m[row * 4 + col];
+}
+
+void MDPosePredictor::EstimateAngularVelocity(const MDPose& prev, const float* matrix, int64_t timestamp_ns,
+                                              float* angular_velocity) {
+    if (prev.sequence == 0) {
+        angular_velocity[0] = angular_velocity[1] = angular_velocity[2] = 0.0f;
+        return;
+    }
+    int64_t interval_ns = timestamp_ns - prev.timestamp_ns;
+    if (interval_ns < MIN_SAMPLE_INTERVAL_NS) {
+        std::copy(prev.angular_velocity, prev.angular_velocity + 3, angular_velocity);
+        return;
+    }
+    if (interval_ns > MAX_SAMPLE_INTERVAL_NS) {
+        angular_velocity[0] = angular_velocity[1] = angular_velocity[2] = 0.0f;
+        return;
+    }
+
+    // 相对旋转 D = N * P^T，满足 N = D * P
+    float d[3][3];
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            d[i][j] = M(matrix, i, 0) * M(prev.matrix, j, 0) +
+                      M(matrix, i, 1) * M(prev.matrix, j, 1) +
+                      M(matrix, i, 2) * M(prev.matrix, j, 2);
+        }
+    }
+
+    // 旋转矩阵转轴角：cos(angle) = (trace - 1) / 2，反对称部分 = 2 * sin(angle) * axis
+    float cos_angle = std::max(-1.0f, std::min(1.0f, (d[0][0] + d[1][1] + d[2][2] - 1.0f) * 0.5f));
+    float angle = std::acos(cos_angle);
+    float sin_angle = std::sin(angle);
+    float raw[3] = {0.0f, 0.0f, 0.0f};
+    if (angle > 1e-6f && sin_angle > 1e-6f) {
+        float scale = angle / (2.0f * sin_angle) / (interval_ns / 1000000000.0f);
+        raw[0] = (d[2][1] - d[1][2]) * scale;
+        raw[1] = (d[0][2] - d[2][0]) * scale;
+        raw[2] = (d[1][0] - d[0][1]) * scale;
+    }
+    float speed = std::sqrt(raw[0] * raw[0] + raw[1] * raw[1] + raw[2] * raw[2]);
+    if (speed > MAX_ANGULAR_SPEED) {
+        float clamp = MAX_ANGULAR_SPEED / speed;
+        raw[0] *= clamp;
+        raw[1] *= clamp;
+        raw[2] *= clamp;
+    }
+
+    for (int i = 0; i < 3; i++) {
+        angular_velocity[i] = prev.angular_velocity[i] + VELOCITY_SMOOTHING * (raw[i] - prev.angular_velocity[i]);
+    }
+}
+
+int64_t MDPosePredictor::Predict(const MDPose& pose, int64_t target_ns, int64_t max_horizon_ns, float* out_matrix) {
+    int64_t horizon_ns = std::max<int64_t>(0, std::min(target_ns - pose.timestamp_ns, max_horizon_ns));
+    const float* w = pose.angular_velocity;
+    float speed = std::sqrt(w[0] * w[0] + w[1] * w[1] + w[2] * w[2]);
+    float angle = speed * (horizon_ns / 1000000000.0f);
+    if (angle < 1e-6f) {
+        if (out_matrix != pose.matrix) {
+            std::copy(pose.matrix, pose.matrix + 16, out_matrix);
+        }
+        return horizon_ns;
+    }
+
+    // Rodrigues 公式：R = I + sin(angle) * K + (1 - cos(angle)) * K^2，K 为单位旋转轴的反对称矩阵
+    float x = w[0] / speed;
+    float y = w[1] / speed;
+    float z = w[2] / speed;
+    float s = std::sin(angle);
+    float c = 1.0f - std::cos(angle);
+    float r[3][3] = {
+        {1.0f - c * (y * y + z * z), -s * z + c * x * y, s * y + c * x * z},
+        {s * z + c * x * y, 1.0f - c * (x * x + z * z), -s * x + c * y * z},
+        {-s * y + c * x * z, s * x + c * y * z, 1.0f - c * (x * x + y * y)},
+    };
+
+    float result[16];
+    std::copy(pose.matrix, pose.matrix + 16, result);
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            result[i * 4 + j] = r[i][0] * M(pose.matrix, 0, j) +
+                                r[i][1] * M(pose.matrix, 1, j) +
+                                r[i][2] * M(pose.matrix, 2, j);
+        }
+    }
+    std::copy(result, result + 16, out_matrix);
+    return horizon_ns;
+}
+
+}
+}
@@ -0,0 +1,37 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef MD360PLAYER4OH_MD_POSE_PREDICTOR_H
+#define MD360PLAYER4OH_MD_POSE_PREDICTOR_H
+
+#include <cstdint>
+
+namespace asha {
+namespace vrlib {
+
+struct MDPose;
+
+// 最多向前预测的时长，超过这个时长的匀速外推误差比不预测还大
+constexpr int64_t MD_MAX_PREDICTION_HORIZON_NS = 50000000LL;
+
+// 头部姿态预测：用相邻两次姿态估计角速度，按匀角速度把姿态外推到预计上屏时间
+// 矩阵按 m[row * 4 + col] 取左上角 3x3 旋转部分，平移部分原样保留
+class MDPosePredictor {
+public:
+    // 根据上一次姿态和新的旋转矩阵估计角速度（rad/s），带指数平滑
+    // prev.sequence 为 0 或两次采样间隔过大时角速度清零
+    static void EstimateAngularVelocity(const MDPose& prev, const float* matrix, int64_t timestamp_ns,
+                                        float* angular_velocity);
+
+    // 把姿态外推到 target_ns，外推时长限制在 [0, max_horizon_ns]；out_matrix 可以和 pose.matrix 相同
+    // 返回实际外推的时长（ns）
+    static int64_t Predict(const MDPose& pose, int64_t target_ns, int64_t max_horizon_ns, float* out_matrix);
+};
+
+}
+}
+
+#endif //MD360PLAYER4OH_MD_POSE_PREDICTOR_H
@@ -0,0 +1,137 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#include "md_program_cache.h"
+#include "md_defines.h"
+#include "md_log.h"
+
+namespace asha {
+namespace vrlib {
+
+MDProgramCache& MDProgramCache::GetInstance() {
+    static MDProgramCache instance;
+    return instance;
+}
+
+GLuint MDProgramCache::CompileShader(GLenum type, const char* source) {
+    GLuint shader = glCreateShader(type);
+    glShaderSource(shader, 1, &source, nullptr);
+    glCompileShader(shader);
+    GLint compiled = 0;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+    if (!compiled) {
+        char info_log[512] = {0};
+        glGetShaderInfoLog(shader, sizeof(info_log), nullptr, info_log);
+        MD_LOGE("MDProgramCache: shader compile failed: %s", info_log);
+        glDeleteShader(shader);
+        return 0;
+    }
+    return shader;
+}
+
+bool MDProgramCache::IsLinked(GLuint program) {
+    GLint linked = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &linked);
+    return linked != 0;
+}
+
+GLuint MDProgramCache::LoadBinary(const std::string& key) {
+    Entry entry;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = entries_.find(key);
+        if (it == entries_.end()) {
+            return 0;
+        }
+        entry = it->second;
+    }
+    GLuint program = glCreateProgram();
+    glProgramBinary(program, entry.format, entry.binary.data(), static_cast<GLsizei>(entry.binary.size()));
+    if (!IsLinked(program)) {
+        // 驱动更新等原因导致二进制失效，丢掉后重新编译
+        MD_LOGW("MDProgramCache: program binary rejected, recompiling");
+        glDeleteProgram(program);
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_.erase(key);
+        return 0;
+    }
+    return program;
+}
+
+void MDProgramCache::StoreBinary(const std::string& key, GLuint program) {
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) {
+        return;
+    }
+    Entry entry;
+    entry.binary.resize(length);
+    GLsizei written = 0;
+    glGetProgramBinary(program, length, &written, &entry.format, entry.binary.data());
+    if (written <= 0) {
+        return;
+    }
+    entry.binary.resize(written);
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_[key] = std::move(entry);
+}
+
+GLuint MDProgramCache::CreateProgram(const char* vertex_source, const char* fragment_source,
+                                     std::initializer_list<const char*> attributes, int* error) {
+    // 属性绑定也会写进二进制，一起作为缓存的键
+    std::string key = vertex_source;
+    key.push_back('\0');
+    key.append(fragment_source);
+    for (const char* attribute : attributes) {
+        key.push_back('\0');
+        key.append(attribute);
+    }
+
+    GLuint program = LoadBinary(key);
+    if (program != 0) {
+        hit_count_.fetch_add(1, std::memory_order_relaxed);
+        return program;
+    }
+    miss_count_.fetch_add(1, std::memory_order_relaxed);
+
+    GLuint vertex_shader = CompileShader(GL_VERTEX_SHADER, vertex_source);
+    GLuint fragment_shader = CompileShader(GL_FRAGMENT_SHADER, fragment_source);
+    if (vertex_shader == 0 || fragment_shader == 0) {
+        glDeleteShader(vertex_shader);
+        glDeleteShader(fragment_shader);
+        if (error != nullptr) {
+            *error = MD_ERR_SHADER_COMPILE;
+        }
+        return 0;
+    }
+    program = glCreateProgram();
+    glAttachShader(program, vertex_shader);
+    glAttachShader(program, fragment_shader);
+    GLuint location = 0;
+    for (const char* attribute : attributes) {
+        glBindAttribLocation(program, location++, attribute);
+    }
+    glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    glLinkProgram(program);
+    glDeleteShader(vertex_shader);
+    glDeleteShader(fragment_shader);
+
+    if (!IsLinked(program)) {
+        char info_log[512] = {0};
+        glGetProgramInfoLog(program, sizeof(info_log), nullptr, info_log);
+        MD_LOGE("MDProgramCache: program link failed: %s", info_log);
+        glDeleteProgram(program);
+        if (error != nullptr) {
+            *error = MD_ERR_SHADER_LINK;
+        }
+        return 0;
+    }
+    StoreBinary(key, program);
+    return program;
+}
+
+}
+}
@@ -0,0 +1,58 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef MD360PLAYER4OH_MD_PROGRAM_CACHE_H
+#define MD360PLAYER4OH_MD_PROGRAM_CACHE_H
+
+#include <atomic>
+#include <cstdint>
+#include <initializer_list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <GLES3/gl3.h>
+
+namespace asha {
+namespace vrlib {
+
+// 着色器程序二进制缓存（进程内共享）：第一次编译链接后用 glGetProgramBinary 取出二进制按源码缓存，
+// 之后重建同一个程序（挂起后恢复、其他渲染器）直接 glProgramBinary 加载，跳过编译和链接
+// 驱动不支持程序二进制或者二进制被驱动拒绝时回退到编译；只能在GL线程调用 CreateProgram
+class MDProgramCache {
+public:
+    static MDProgramCache& GetInstance();
+
+    // 创建程序，attributes 依次绑定到 location 0、1、...
+    // 失败返回0，error 不为空时写入 MD_ERR_SHADER_COMPILE 或 MD_ERR_SHADER_LINK
+    GLuint CreateProgram(const char* vertex_source, const char* fragment_source,
+                         std::initializer_list<const char*> attributes, int* error = nullptr);
+
+    uint64_t GetHitCount() const { return hit_count_.load(std::memory_order_relaxed); }
+    uint64_t GetMissCount() const { return miss_count_.load(std::memory_order_relaxed); }
+
+private:
+    struct Entry {
+        GLenum format = 0;
+        std::vector<uint8_t> binary;
+    };
+
+    GLuint LoadBinary(const std::string& key);
+    void StoreBinary(const std::string& key, GLuint program);
+    static GLuint CompileShader(GLenum type, const char* source);
+    static bool IsLinked(GLuint program);
+
+private:
+    std::mutex mutex_;
+    std::unordered_map<std::string, Entry> entries_;
+    std::atomic<uint64_t> hit_count_{0};
+    std::atomic<uint64_t> miss_count_{0};
+};
+
+}
+}
+
+#endif //MD360PLAYER4OH_MD_PROGRAM_CACHE_H
@@ -0,0 +1,58 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#include "md_ray_cast_mapping.h"
+#include <algorithm>
+#include <cmath>
+
+namespace asha {
+namespace vrlib {
+
+static const float PI = 3.14159265358979323846f;
+
+static bool Normalize(const float* direction, float* normalized) {
+    float length = std::sqrt(direction[0] * direction[0] + direction[1] * direction[1] + direction[2] * direction[2]);
+    if (length < 1e-12f) {
+        return false;
+    }
+    for (int k = 0; k < 3; k++) {
+        normalized[k] = direction[k] / length;
+    }
+    return true;
+}
+
+void MDRayCastMapping::SphereTexCoord(const float* direction, float* uv) {
+    float d[3] = {0.0f, 1.0f, 0.0f};
+    Normalize(direction, d);
+    // 网格顶点：x = cos(2PI u) sin(theta)，y = cos(theta)，z = sin(2PI u) sin(theta)，v = 1 - theta / PI
+    float u = std::atan2(d[2], d[0]) / (2.0f * PI);
+    uv[0] = u < 0.0f ? u + 1.0f : u;
+    uv[1] = 1.0f - std::acos(std::max(-1.0f, std::min(1.0f, d[1]))) / PI;
+}
+
+bool MDRayCastMapping::DomeTexCoord(const float* direction, float degree, bool upper, float* uv) {
+    float d[3];
+    if (!Normalize(direction, d)) {
+        return false;
+    }
+    // 网格顶点：x = cos(phi) sin(theta) * upper，y = cos(theta) * upper，z = sin(phi) sin(theta)，
+    // 纹理坐标 (sin(phi), cos(phi)) * theta / PI / percent / 2 + 0.5
+    float sign = upper ? 1.0f : -1.0f;
+    float percent = degree / 360.0f;
+    float theta = std::acos(std::max(-1.0f, std::min(1.0f, d[1] * sign)));
+    float radius = theta / PI / percent;
+    if (radius > 1.0f) {
+        return false;
+    }
+    float sin_theta = std::sin(theta);
+    float scale = sin_theta > 1e-6f ? radius * 0.5f / sin_theta : 0.0f;
+    uv[0] = d[2] * scale + 0.5f;
+    uv[1] = d[0] * sign * scale + 0.5f;
+    return true;
+}
+
+}
+}
@@ -0,0 +1,27 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef MD360PLAYER4OH_MD_RAY_CAST_MAPPING_H
+#define MD360PLAYER4OH_MD_RAY_CAST_MAPPING_H
+
+namespace asha {
+namespace vrlib {
+
+// 视线方向到视频纹理坐标（ST 矩阵变换前）的解析映射，与 MDMeshGenerator 在网格顶点上写入的纹理坐标一致
+// MDRayCaster 的片元着色器是同样的公式；这里的 CPU 版本给主机侧工具对比网格插值的误差（不依赖GL）
+class MDRayCastMapping {
+public:
+    // 球面（等距柱状投影）：u 为绕 Y 轴的经度，v 为 1 - 极角 / PI
+    static void SphereTexCoord(const float* direction, float* uv);
+
+    // 穹顶（鱼眼）：degree 为覆盖角度（180 或 230），upper 为上半球；方向不在穹顶范围内时返回 false
+    static bool DomeTexCoord(const float* direction, float degree, bool upper, float* uv);
+};
+
+}
+}
+
+#endif //MD360PLAYER4OH_MD_RAY_CAST_MAPPING_H
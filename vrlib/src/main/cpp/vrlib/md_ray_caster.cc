@@ -0,0 +1,190 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#include "md_ray_caster.h"
+#include <GLES2/gl2ext.h>
+#include <string>
+#include "md_defines.h"
+#include "md_log.h"
+#include "md_matrix.h"
+#include "md_object_3d.h"
+#include "md_program_cache.h"
+
+namespace asha {
+namespace vrlib {
+
+// 同一像素在近、远裁剪面上的点（齐次坐标对屏幕坐标是线性的，插值后再在片元里做透视除法）
+static const char* RAY_CAST_VERTEX_SHADER = R"(
+    attribute vec2 a_Position;
+    uniform mat4 u_InverseMVPMatrix;
+    varying vec4 vNear;
+    varying vec4 vFar;
+    void main() {
+        vNear = u_InverseMVPMatrix * vec4(a_Position, -1.0, 1.0);
+        vFar = u_InverseMVPMatrix * vec4(a_Position, 1.0, 1.0);
+        gl_Position = vec4(a_Position, 0.0, 1.0);
+    }
+)";
+
+// 映射公式见 MDRayCastMapping；MD_DOME、MD_DISTORTION 由 GetProgram 在源码前定义
+// 视线方向需要 highp，mediump 下两极和接缝附近的纹理坐标误差明显
+static const char* RAY_CAST_FRAGMENT_SHADER = R"(
+    #extension GL_OES_EGL_image_external : require
+    precision highp float;
+    varying vec4 vNear;
+    varying vec4 vFar;
+    uniform samplerExternalOES u_Texture;
+    uniform mat4 u_STMatrix;
+    uniform vec2 u_DomeParams;
+    uniform vec4 u_DistortionParams;
+    const float PI = 3.14159265;
+
+    void main() {
+        vec3 dir = normalize(vFar.xyz / vFar.w - vNear.xyz / vNear.w);
+    #ifdef MD_DOME
+        // u_DomeParams.x：上半球为1、下半球为-1；u_DomeParams.y：覆盖角度 / 360
+        float theta = acos(clamp(dir.y * u_DomeParams.x, -1.0, 1.0));
+        float radius = theta / PI / u_DomeParams.y;
+        if (radius > 1.0) {
+            discard;
+        }
+        float sinTheta = sin(theta);
+        float scale = sinTheta > 1e-6 ? radius * 0.5 / sinTheta : 0.0;
+        vec2 uv = vec2(dir.z, dir.x * u_DomeParams.x) * scale + 0.5;
+    #else
+        float u = atan(dir.z, dir.x) / (2.0 * PI);
+        vec2 uv = vec2(u < 0.0 ? u + 1.0 : u, 1.0 - acos(clamp(dir.y, -1.0, 1.0)) / PI);
+    #endif
+        vec2 texCoord = (u_STMatrix * vec4(uv, 0.0, 1.0)).xy;
+    #ifdef MD_DISTORTION
+        if (u_DistortionParams.y != 0.0) {
+            vec2 coords = texCoord - vec2(0.5);
+            float rSq = coords.x * coords.x + coords.y * coords.y;
+            texCoord = coords * (u_DistortionParams.x + u_DistortionParams.y * rSq) + vec2(0.5);
+        }
+        if (texCoord.x < 0.0 || texCoord.x > 1.0 || texCoord.y < 0.0 || texCoord.y > 1.0) {
+            gl_FragColor = vec4(0.0, 0.0, 0.0, 1.0);
+            return;
+        }
+    #endif
+        gl_FragColor = texture2D(u_Texture, texCoord);
+    }
+)";
+
+// 覆盖 NDC [-1, 1] 的一个三角形，比四边形少一条对角线上的重复着色
+static const float TRIANGLE_VERTICES[] = {
+    -1.0f, -1.0f,
+     3.0f, -1.0f,
+    -1.0f,  3.0f,
+};
+
+bool MDRayCaster::SupportsProjection(int projection_type) {
+    switch (projection_type) {
+        case MDObject3D::SPHERE:
+        case MDObject3D::DOME180:
+        case MDObject3D::DOME230:
+        case MDObject3D::DOME180_UPPER:
+        case MDObject3D::DOME230_UPPER:
+            return true;
+        default:
+            return false;
+    }
+}
+
+MDRayCaster::Program* MDRayCaster::GetProgram(bool dome, bool vr) {
+    Program* program = &programs_[dome ? 1 : 0][vr ? 1 : 0];
+    if (program->program != 0) {
+        return program;
+    }
+    std::string fragment_source;
+    if (dome) {
+        fragment_source += "#define MD_DOME\n";
+    }
+    if (vr) {
+        fragment_source += "#define MD_DISTORTION\n";
+    }
+    fragment_source += RAY_CAST_FRAGMENT_SHADER;
+    program->program = MDProgramCache::GetInstance().CreateProgram(RAY_CAST_VERTEX_SHADER, fragment_source.c_str(),
+                                                                   {"a_Position"});
+    if (program->program == 0) {
+        MD_LOGE("MDRayCaster: create program failed, dome=%d, vr=%d", dome, vr);
+        return nullptr;
+    }
+    program->inverse_mvp_matrix_loc = glGetUniformLocation(program->program, "u_InverseMVPMatrix");
+    program->st_matrix_loc = glGetUniformLocation(program->program, "u_STMatrix");
+    program->texture_loc = glGetUniformLocation(program->program, "u_Texture");
+    program->dome_params_loc = glGetUniformLocation(program->program, "u_DomeParams");
+    program->distortion_params_loc = glGetUniformLocation(program->program, "u_DistortionParams");
+    return program;
+}
+
+int MDRayCaster::Draw(int projection_type, const float* mvp_matrix, const float* st_matrix, GLuint texture_id,
+                      const float* distortion_params) {
+    if (!SupportsProjection(projection_type)) {
+        return MD_ERR;
+    }
+    float inverse_mvp_matrix[16];
+    if (!MDMatrix::Invert(inverse_mvp_matrix, mvp_matrix)) {
+        return MD_ERR;
+    }
+    bool dome = projection_type != MDObject3D::SPHERE;
+    Program* program = GetProgram(dome, distortion_params != nullptr);
+    if (program == nullptr) {
+        return MD_ERR;
+    }
+    if (triangle_vbo_ == 0) {
+        glGenBuffers(1, &triangle_vbo_);
+        glBindBuffer(GL_ARRAY_BUFFER, triangle_vbo_);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(TRIANGLE_VERTICES), TRIANGLE_VERTICES, GL_STATIC_DRAW);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    // 三角形是逆时针的，渲染器为球内视角设置的顺时针正面剔除会把它剔掉；下一帧开始时渲染状态会重新设置
+    glDisable(GL_CULL_FACE);
+    glDisable(GL_DEPTH_TEST);
+
+    glUseProgram(program->program);
+    glUniformMatrix4fv(program->inverse_mvp_matrix_loc, 1, GL_FALSE, inverse_mvp_matrix);
+    glUniformMatrix4fv(program->st_matrix_loc, 1, GL_FALSE, st_matrix);
+    if (dome) {
+        bool upper = projection_type == MDObject3D::DOME180_UPPER || projection_type == MDObject3D::DOME230_UPPER;
+        bool dome180 = projection_type == MDObject3D::DOME180 || projection_type == MDObject3D::DOME180_UPPER;
+        glUniform2f(program->dome_params_loc, upper ? 1.0f : -1.0f, (dome180 ? 180.0f : 230.0f) / 360.0f);
+    }
+    if (distortion_params != nullptr) {
+        glUniform4f(program->distortion_params_loc, distortion_params[0], distortion_params[1],
+                    distortion_params[2], distortion_params[3]);
+    }
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_EXTERNAL_OES, texture_id);
+    glUniform1i(program->texture_loc, 0);
+
+    glBindBuffer(GL_ARRAY_BUFFER, triangle_vbo_);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    glDisableVertexAttribArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    return MD_OK;
+}
+
+void MDRayCaster::Destroy() {
+    for (auto& row : programs_) {
+        for (Program& program : row) {
+            if (program.program != 0) {
+                glDeleteProgram(program.program);
+            }
+            program = Program();
+        }
+    }
+    if (triangle_vbo_ != 0) {
+        glDeleteBuffers(1, &triangle_vbo_);
+        triangle_vbo_ = 0;
+    }
+}
+
+}
+}
@@ -0,0 +1,55 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef MD360PLAYER4OH_MD_RAY_CASTER_H
+#define MD360PLAYER4OH_MD_RAY_CASTER_H
+
+#include <GLES3/gl3.h>
+
+namespace asha {
+namespace vrlib {
+
+// 不用网格的射线投射渲染：画一个覆盖视口的三角形，片元着色器由 MVP 的逆矩阵求出每个像素的视线，
+// 按 MDRayCastMapping 的公式解析地采样视频纹理。逐像素映射没有细分误差（两极附近也准确），顶点只有3个
+// 支持球面和穹顶，立方体仍用网格；所有接口只能在GL线程调用
+// 与网格相比的GPU耗时没有在设备上测过（主机侧 md_mesh_bench 只比较采样误差和顶点工作量），
+// 逐像素的三角函数在低端GPU上可能比网格更慢，所以默认关闭，由应用在目标设备上用 drawFrame / gpuFrame 对比后开启
+class MDRayCaster {
+public:
+    MDRayCaster() = default;
+    ~MDRayCaster() = default;
+
+    static bool SupportsProjection(int projection_type);
+
+    // 在当前视口内绘制。st_matrix 为视频纹理的变换矩阵；distortion_params 非空时（VR模式）
+    // 与VR着色器一样对纹理坐标做桶形畸变，超出范围的像素为黑色
+    int Draw(int projection_type, const float* mvp_matrix, const float* st_matrix, GLuint texture_id,
+             const float* distortion_params);
+
+    void Destroy();
+
+private:
+    // 程序按 [穹顶][VR] 区分，用到时再创建
+    struct Program {
+        GLuint program = 0;
+        GLint inverse_mvp_matrix_loc = -1;
+        GLint st_matrix_loc = -1;
+        GLint texture_loc = -1;
+        GLint dome_params_loc = -1;
+        GLint distortion_params_loc = -1;
+    };
+
+    Program* GetProgram(bool dome, bool vr);
+
+private:
+    Program programs_[2][2];
+    GLuint triangle_vbo_ = 0;
+};
+
+}
+}
+
+#endif //MD360PLAYER4OH_MD_RAY_CASTER_H
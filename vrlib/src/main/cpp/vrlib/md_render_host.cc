@@ -0,0 +1,205 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#include "md_render_host.h"
+#include <algorithm>
+#include "md_defines.h"
+#include "md_log.h"
+
+namespace asha {
+namespace vrlib {
+
+MDRenderHost::MDRenderHost(std::shared_ptr<MDFrameClock> clock)
+    : scheduler_(std::make_shared<MDFrameScheduler>(clock)),
+      egl_context_(MDEglContext::CreateEglContext()) {
+}
+
+MDRenderHost::~MDRenderHost() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    // GL线程不持有任何渲染器的最后一个引用（见 Run），渲染器离开时也会放掉宿主，正常不会走到这里；
+    // 万一在自己的线程中析构，join 自己会抛 std::system_error 终止进程，只能分离
+    if (thread_.joinable() && thread_.get_id() == std::this_thread::get_id()) {
+        MD_LOGE("MDRenderHost destroyed on its own gl thread, detaching");
+        thread_.detach();
+        return;
+    }
+    if (thread_.joinable()) {
+        thread_.join();
+        MD_LOGI("MDRenderHost gl thread exit ok.");
+    }
+}
+
+std::shared_ptr<MDRenderHost> MDRenderHost::GetShared() {
+    static std::mutex shared_mutex;
+    static std::weak_ptr<MDRenderHost> shared_host;
+    std::lock_guard<std::mutex> lock(shared_mutex);
+    std::shared_ptr<MDRenderHost> host = shared_host.lock();
+    if (host == nullptr) {
+        host = std::make_shared<MDRenderHost>(MDFrameClock::CreateVsyncClock());
+        shared_host = host;
+    }
+    return host;
+}
+
+void MDRenderHost::AddClient(std::shared_ptr<MDRenderHostClient> client) {
+    if (client == nullptr) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_adds_.push_back(client);
+        if (!thread_.joinable()) {
+            thread_ = std::thread([this]() { Run(); });
+        }
+    }
+    cv_.notify_all();
+}
+
+void MDRenderHost::RemoveClient(MDRenderHostClient* client) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    // GL线程正在初始化它：等它加入 clients_ 后再按正常流程释放，否则初始化完又会被加进去
+    removed_cv_.wait(lock, [this, client]() { return !ContainsLocked(initializing_, client); });
+    // 还没来得及初始化，直接取消
+    auto it = std::find_if(pending_adds_.begin(), pending_adds_.end(),
+                           [client](const std::shared_ptr<MDRenderHostClient>& c) { return c.get() == client; });
+    if (it != pending_adds_.end()) {
+        pending_adds_.erase(it);
+        return;
+    }
+    if (!ContainsLocked(clients_, client)) {
+        return;
+    }
+    for (auto& c : clients_) {
+        if (c.get() == client) {
+            pending_removes_.push_back(c);
+            break;
+        }
+    }
+    cv_.notify_all();
+    removed_cv_.wait(lock, [this, client]() { return !ContainsLocked(clients_, client); });
+}
+
+void MDRenderHost::Wakeup() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+    }
+    cv_.notify_all();
+}
+
+bool MDRenderHost::ContainsLocked(const std::vector<std::shared_ptr<MDRenderHostClient>>& clients,
+                                  MDRenderHostClient* client) {
+    for (auto& c : clients) {
+        if (c.get() == client) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool MDRenderHost::HasWorkLocked() {
+    if (stop_ || !pending_adds_.empty() || !pending_removes_.empty()) {
+        return true;
+    }
+    for (auto& client : clients_) {
+        if (client->NeedsFrame()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void MDRenderHost::Run() {
+    egl_context_->Prepare();
+    scheduler_->Start();
+    std::vector<std::shared_ptr<MDRenderHostClient>> clients;
+    while (true) {
+        int64_t idle_ns = 0;
+        std::vector<std::shared_ptr<MDRenderHostClient>> adds;
+        std::vector<std::shared_ptr<MDRenderHostClient>> removes;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (!HasWorkLocked()) {
+                int64_t wait_start_ns = MDNowNs();
+                cv_.wait(lock, [this]() { return HasWorkLocked(); });
+                idle_ns = MDNowNs() - wait_start_ns;
+            }
+            if (stop_) {
+                break;
+            }
+            adds.swap(pending_adds_);
+            removes.swap(pending_removes_);
+            initializing_ = adds;
+        }
+
+        for (auto& client : removes) {
+            client->OnHostReleaseGL();
+        }
+        if (!removes.empty()) {
+            {
+                // 在同一把锁里放掉GL线程的引用：RemoveClient 看到已移除时GL线程已经不再持有渲染器，
+                // 渲染器和它持有的宿主只会在调用方的线程中析构
+                std::lock_guard<std::mutex> lock(mutex_);
+                for (auto& client : removes) {
+                    clients_.erase(std::remove(clients_.begin(), clients_.end(), client), clients_.end());
+                }
+                removes.clear();
+            }
+            removed_cv_.notify_all();
+        }
+        for (auto& client : adds) {
+            if (client->OnHostInitGL() != MD_OK) {
+                MD_LOGE("MDRenderHost: client init gl failed");
+            }
+        }
+        bool added = !adds.empty();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            clients_.insert(clients_.end(), adds.begin(), adds.end());
+            clients = clients_;
+            adds.clear();
+            initializing_.clear();
+        }
+        if (added) {
+            // 初始化期间调用的 RemoveClient 在等它加入 clients_
+            removed_cv_.notify_all();
+        }
+        if (clients.empty()) {
+            continue;
+        }
+
+        // 所有窗口共用一次vsync唤醒，依次绘制
+        scheduler_->BeginFrame();
+        frame_serial_++;
+        for (auto& client : clients) {
+            client->OnHostFrame(idle_ns);
+        }
+        scheduler_->EndFrame();
+        clients.clear();
+    }
+    scheduler_->Stop();
+
+    // 宿主销毁时还没离开的渲染器在这里统一释放（pending_removes_ 中的也都在 clients_ 里）
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        clients = clients_;
+        clients_.clear();
+        pending_removes_.clear();
+        pending_adds_.clear();
+    }
+    for (auto& client : clients) {
+        client->OnHostReleaseGL();
+    }
+    clients.clear();
+    removed_cv_.notify_all();
+    egl_context_->Terminate();
+}
+
+}
+}
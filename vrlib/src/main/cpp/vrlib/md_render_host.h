@@ -0,0 +1,83 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef MD360PLAYER4OH_MD_RENDER_HOST_H
+#define MD360PLAYER4OH_MD_RENDER_HOST_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "md_frame_scheduler.h"
+#include "device/md_egl.h"
+
+namespace asha {
+namespace vrlib {
+
+// 挂在渲染宿主上的渲染器，以下回调都在宿主的GL线程中执行
+class MDRenderHostClient {
+public:
+    virtual ~MDRenderHostClient() = default;
+    // 加入宿主后初始化GL资源
+    virtual int OnHostInitGL() = 0;
+    // 每个vsync调用一次；idle_ns 为本帧之前宿主因为没有渲染请求而休眠的时长
+    virtual void OnHostFrame(int64_t idle_ns) = 0;
+    // 离开宿主前释放GL资源
+    virtual void OnHostReleaseGL() = 0;
+    // 按需渲染：本帧是否需要被调用，所有渲染器都不需要时宿主休眠（可在任意线程调用）
+    virtual bool NeedsFrame() = 0;
+};
+
+// 渲染宿主：一个GL线程、一个EGL上下文和一个帧调度器，服务多个渲染器（多个上屏窗口）
+// 每个vsync依次调用所有渲染器，各自切换到自己的窗口绘制并交换
+class MDRenderHost {
+public:
+    explicit MDRenderHost(std::shared_ptr<MDFrameClock> clock);
+    ~MDRenderHost();
+
+    // 进程内共享的宿主（vsync时钟），最后一个使用者释放后销毁
+    static std::shared_ptr<MDRenderHost> GetShared();
+
+    // 加入宿主，GL资源在GL线程中异步初始化
+    void AddClient(std::shared_ptr<MDRenderHostClient> client);
+    // 离开宿主，阻塞到GL线程释放完这个渲染器的GL资源（不能在GL线程中调用）
+    void RemoveClient(MDRenderHostClient* client);
+    // 有新的渲染请求时唤醒休眠中的GL线程
+    void Wakeup();
+
+    std::shared_ptr<MDFrameScheduler> GetScheduler() const { return scheduler_; }
+    std::shared_ptr<MDEglContext> GetEglContext() const { return egl_context_; }
+    // 当前宿主帧的序号，同一个vsync内所有渲染器看到的值相同（只在GL线程中使用）
+    uint64_t GetFrameSerial() const { return frame_serial_; }
+
+private:
+    void Run();
+    bool HasWorkLocked();
+    bool ContainsLocked(const std::vector<std::shared_ptr<MDRenderHostClient>>& clients,
+                        MDRenderHostClient* client);
+
+private:
+    std::shared_ptr<MDFrameScheduler> scheduler_;
+    std::shared_ptr<MDEglContext> egl_context_;
+    std::thread thread_;
+    uint64_t frame_serial_ = 0;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;           // 唤醒GL线程
+    std::condition_variable removed_cv_;   // 通知 RemoveClient 释放完成
+    bool stop_ = false;
+    std::vector<std::shared_ptr<MDRenderHostClient>> clients_;          // 已初始化的渲染器
+    std::vector<std::shared_ptr<MDRenderHostClient>> pending_adds_;     // 等待初始化
+    std::vector<std::shared_ptr<MDRenderHostClient>> initializing_;     // GL线程正在初始化（不在上面两个里）
+    std::vector<std::shared_ptr<MDRenderHostClient>> pending_removes_;  // 等待释放
+};
+
+}
+}
+
+#endif //MD360PLAYER4OH_MD_RENDER_HOST_H
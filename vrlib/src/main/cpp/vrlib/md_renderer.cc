@@ -10,6 +10,23 @@
 #include "device/md_egl.h"
 #include "device/md_nativeimage_ref.h"
 #include "md_object_3d.h"
+#include "md_triple_buffer.h"
+#include "md_pose_mailbox.h"
+#include "md_pose_predictor.h"
+#include "md_reprojector.h"
+#include "md_render_host.h"
+#include "md_video_source.h"
+#include "md_video_cadence.h"
+#include "md_gl_command_queue.h"
+#include "md_resolution_scaler.h"
+#include "md_program_cache.h"
+#include "md_mesh_cache.h"
+#include "md_mesh_lod.h"
+#include "md_ray_caster.h"
+#include "md_dual_fisheye_program.h"
+#include "md_eac_program.h"
+#include "md_stereo_layout.h"
+#include "md_plane_scale.h"
 #include <unistd.h>
 #include <thread>
 #include <memory>
@@ -18,10 +35,20 @@
 #include <cmath>
 #include <mutex>
 #include <vector>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
 
 namespace asha {
 namespace vrlib {
 
+// 超过这个时间没有收到传感器姿态，认为没有在头部跟踪，可以按片源节奏出图
+static const int64_t MD_HEAD_TRACKING_IDLE_NS = 500000000LL;
+
+// 垂直视野（度）：VR模式每只眼睛固定使用，普通模式在外部矩阵不是透视投影时使用
+static const float MD_VR_EYE_FOV_Y = 120.0f;
+static const float MD_NORMAL_FOV_Y = 60.0f;
+
 const char* VERTEX_SHADER = R"(
     attribute vec4 a_Position;
     attribute vec2 a_TexCoordinate;
@@ -89,14 +116,95 @@ const char* VR_FRAGMENT_SHADER = R"(
     }
 )";
 
-class MD360RendererPrivate : public MD360RendererAPI, public std::enable_shared_from_this<MD360RendererPrivate> {
+// 渲染线程每帧读取一次的可变渲染状态
+// 设置接口在任意线程修改后通过三缓冲发布，GL线程无锁地取得一致的快照
+struct RenderState {
+    float clear_color[4] = {0.0f, 0.0f, 0.0f, 1.0f}; // RGBA: 黑色
+    bool cull_face_enabled = false;  // 禁用面剔除（VR 中需要从球体内部看，需要看到"背面"）
+    bool depth_test_enabled = true;  // 默认启用深度测试
+
+    // 外部设置或根据surface尺寸计算的 MVP 矩阵
+    float mvp_matrix[16] = {
+        1, 0, 0, 0,
+        0, 1, 0, 0,
+        0, 0, 1, 0,
+        0, 0, 0, 1
+    };
+
+    // 触摸控制相关（累积的触摸delta）
+    float touch_delta_x = 0.0f;
+    float touch_delta_y = 0.0f;
+    bool use_touch_control = false;  // 是否使用触摸控制（如果外部设置了 MVP 矩阵，则使用外部矩阵）
+
+    // Viewport 相关
+    int viewport_x = 0;
+    int viewport_y = 0;
+    int viewport_width = 0;
+    int viewport_height = 0;
+    bool viewport_set = false;  // 是否设置了自定义 viewport
+
+    // Scissor 相关
+    int scissor_x = 0;
+    int scissor_y = 0;
+    int scissor_width = 0;
+    int scissor_height = 0;
+    bool scissor_enabled = false;
+
+    // Blend 相关
+    bool blend_enabled = false;
+    int blend_src = GL_SRC_ALPHA;            // 默认混合源因子
+    int blend_dst = GL_ONE_MINUS_SRC_ALPHA;  // 默认混合目标因子
+
+    // VR模式配置（切换VR模式时需要的GL资源清理通过GL命令队列完成）
+    VRModeConfig vr_config;
+
+    // 双鱼眼的镜头标定（fov 为0的镜头使用画面排列的默认值），变化时GL线程重新生成网格
+    MDFisheyeLens fisheye_lenses[MDDualFisheye::LENS_COUNT];
+
+    // 立方体贴图的画面排列（MDCubeLayoutType）、面的边距，以及是否为 EAC（片元着色器里做等角变换）
+    int cube_layout = MD_CUBE_LAYOUT_3X2;
+    float cube_padding = 0.0f;
+    bool cube_equi_angular = false;
+
+    // 立体投影每只眼睛的球面绕 Y 轴的偏转（度），用于校正左右眼画面没有对齐的片源
+    float stereo_eye_yaw[2] = {0.0f, 0.0f};
+
+    // 平面投影的缩放方式（MDPlaneScaleType）和眼镜模式下屏幕的弧度（度，0 为平面屏幕）
+    int plane_scale_type = MD_PLANE_SCALE_DEFAULT;
+    float plane_curve_degree = 0.0f;
+};
+
+// 影响画面输出的渲染状态快照（不含头部姿态），用于判断是否需要重绘、能否只做重投影
+// 所有字段都是4字节类型，保证没有填充字节，可以直接 memcmp
+struct RenderStateSnapshot {
+    float clear_color[4];
+    float mvp_matrix[16];
+    float touch_delta[2];
+    float vr_params[5];
+    float stereo_eye_yaw[2];
+    float plane_curve_degree;
+    int viewport[4];
+    int scissor[4];
+    int blend_func[2];
+    int flags[10];
+};
+
+// 每帧的处理方式
+enum FrameAction {
+    FRAME_ACTION_SKIP = 0,      // 什么都没变，跳过绘制和交换
+    FRAME_ACTION_REPROJECT,     // 只按最新姿态重投影上一次渲染的眼睛画面
+    FRAME_ACTION_RENDER         // 完整渲染
+};
+
+class MD360RendererPrivate : public MD360RendererAPI, public MDRenderHostClient,
+                             public std::enable_shared_from_this<MD360RendererPrivate> {
 public:
     virtual int SetSurface(std::shared_ptr<MDNativeWindowRef> ref) override {
         int result = egl_->SetRenderWindow(ref);
         if (result == MD_OK) {
-            // 设置一个标志，在 RunGL 线程中实际获取尺寸
-            surface_size_dirty_ = true;
-            pending_window_ref_ = ref;
+            // 实际尺寸在 GL 线程中获取
+            command_queue_.Push(MD_GL_CMD_SURFACE_CHANGED, 0);
+            RequestRender();
             MD_LOGI("MD360RendererPrivate::SetSurface: surface set, will update size in GL thread");
         } else {
             MD_LOGW("MD360RendererPrivate::SetSurface: SetRenderWindow failed, result=%d", result);
@@ -108,8 +216,6 @@ public:
     }
 
     void UpdateProjectionMatrixForCurrentSurface() {
-        std::lock_guard<std::mutex> lock(mutex_);
-        
         if (surface_width_ <= 0 || surface_height_ <= 0) {
             MD_LOGW("UpdateProjectionMatrixForCurrentSurface: Invalid surface size %dx%d", 
                    surface_width_, surface_height_);
@@ -118,7 +224,7 @@ public:
         
         // 计算基于实际屏幕尺寸的投影矩阵
         float aspectRatio = static_cast<float>(surface_width_) / static_cast<float>(surface_height_);
-        float fovY = 60.0f; // 视野角度
+        float fovY = MD_NORMAL_FOV_Y; // 视野角度
         float nearPlane = 0.1f;
         float farPlane = 100.0f;
         
@@ -126,25 +232,30 @@ public:
         float f = 1.0f / tan(fovY * 0.5f * M_PI / 180.0f);
         float range = nearPlane - farPlane;
         
-        current_mvp_matrix_[0] = f / aspectRatio;
-        current_mvp_matrix_[1] = 0.0f;
-        current_mvp_matrix_[2] = 0.0f;
-        current_mvp_matrix_[3] = 0.0f;
-        
-        current_mvp_matrix_[4] = 0.0f;
-        current_mvp_matrix_[5] = f;
-        current_mvp_matrix_[6] = 0.0f;
-        current_mvp_matrix_[7] = 0.0f;
-        
-        current_mvp_matrix_[8] = 0.0f;
-        current_mvp_matrix_[9] = 0.0f;
-        current_mvp_matrix_[10] = (farPlane + nearPlane) / range;
-        current_mvp_matrix_[11] = -1.0f;
-        
-        current_mvp_matrix_[12] = 0.0f;
-        current_mvp_matrix_[13] = 0.0f;
-        current_mvp_matrix_[14] = 2.0f * farPlane * nearPlane / range;
-        current_mvp_matrix_[15] = 0.0f;
+        float matrix[16];
+        matrix[0] = f / aspectRatio;
+        matrix[1] = 0.0f;
+        matrix[2] = 0.0f;
+        matrix[3] = 0.0f;
+        
+        matrix[4] = 0.0f;
+        matrix[5] = f;
+        matrix[6] = 0.0f;
+        matrix[7] = 0.0f;
+        
+        matrix[8] = 0.0f;
+        matrix[9] = 0.0f;
+        matrix[10] = (farPlane + nearPlane) / range;
+        matrix[11] = -1.0f;
+        
+        matrix[12] = 0.0f;
+        matrix[13] = 0.0f;
+        matrix[14] = 2.0f * farPlane * nearPlane / range;
+        matrix[15] = 0.0f;
+
+        state_.Update([&](RenderState& state) {
+            std::copy(matrix, matrix + 16, state.mvp_matrix);
+        });
         
         MD_LOGI("UpdateProjectionMatrixForCurrentSurface: Updated MVP matrix for aspect ratio %.3f", aspectRatio);
     }
@@ -186,226 +297,295 @@ public:
     }
 
     virtual void UpdateMVPMatrix(float* matrix) override {
-        std::lock_guard<std::mutex> lock(mutex_);
-        if (matrix) {
-            std::copy(matrix, matrix + 16, current_mvp_matrix_);
-            // 外部设置矩阵时，如果当前是VR模式，只更新current_mvp_matrix_但不改变触控标志
-            if (!vr_config_.enabled) {
+        if (!matrix) {
+            return;
+        }
+        bool changed = false;
+        state_.Update([&](RenderState& state) {
+            changed = memcmp(matrix, state.mvp_matrix, sizeof(state.mvp_matrix)) != 0;
+            std::copy(matrix, matrix + 16, state.mvp_matrix);
+            // 外部设置矩阵时，如果当前是VR模式，只更新MVP矩阵但不改变触控标志
+            if (!state.vr_config.enabled) {
                 // 普通模式下，外部设置矩阵则禁用触控
-                use_touch_control_ = false;
+                state.use_touch_control = false;
             }
+        });
+        if (changed) {
+            RequestRender();
         }
     }
 
     virtual void UpdateTouchDelta(float deltaX, float deltaY) override {
-        std::lock_guard<std::mutex> lock(mutex_);
-        
-        // 累积触摸delta值
-        float old_touch_x = touch_delta_x_;
-        float old_touch_y = touch_delta_y_;
-        touch_delta_x_ += deltaX;
-        touch_delta_y_ += deltaY;
-        
-        use_touch_control_ = true;
-        mvp_matrix_dirty_ = true;
+        // 累积触摸delta值，GL线程发现累积值变化时重新计算视图矩阵
+        state_.Update([&](RenderState& state) {
+            state.touch_delta_x += deltaX;
+            state.touch_delta_y += deltaY;
+            state.use_touch_control = true;
+        });
+        if (deltaX != 0.0f || deltaY != 0.0f) {
+            RequestRender();
+        }
     }
 
     virtual uint64_t GetVideoSurfaceId() override {
-        return surface_id_;
+        return video_source_->GetSurfaceId();
+    }
+
+    virtual int ShareVideoFrom(std::shared_ptr<MD360RendererAPI> other) override {
+        auto source = std::dynamic_pointer_cast<MD360RendererPrivate>(other);
+        if (is_init_ || source == nullptr || source.get() == this) {
+            MD_LOGW("MD360RendererPrivate::ShareVideoFrom: must be called before Init with another renderer, ignored");
+            return MD_ERR;
+        }
+        MD_LOGI("MD360RendererPrivate::ShareVideoFrom: share video source with %p", source.get());
+        video_share_from_ = source;
+        video_source_ = source->video_source_;
+        return MD_OK;
     }
 
     virtual void SetClearColor(float r, float g, float b, float a) override {
-        std::lock_guard<std::mutex> lock(mutex_);
         MD_LOGI("MD360RendererPrivate::SetClearColor called: r=%.3f, g=%.3f, b=%.3f, a=%.3f", r, g, b, a);
-        clear_color_[0] = r;
-        clear_color_[1] = g;
-        clear_color_[2] = b;
-        clear_color_[3] = a;
+        state_.Update([&](RenderState& state) {
+            state.clear_color[0] = r;
+            state.clear_color[1] = g;
+            state.clear_color[2] = b;
+            state.clear_color[3] = a;
+        });
+        RequestRender();
     }
 
     virtual void SetCullFaceEnabled(bool enabled) override {
-        std::lock_guard<std::mutex> lock(mutex_);
         MD_LOGI("MD360RendererPrivate::SetCullFaceEnabled called: enabled=%s", enabled ? "true" : "false");
-        cull_face_enabled_ = enabled;
         // 状态会在 OnDrawFrame 中应用
+        state_.Update([&](RenderState& state) {
+            state.cull_face_enabled = enabled;
+        });
+        RequestRender();
     }
 
     virtual void SetDepthTestEnabled(bool enabled) override {
-        std::lock_guard<std::mutex> lock(mutex_);
         MD_LOGI("MD360RendererPrivate::SetDepthTestEnabled called: enabled=%s", enabled ? "true" : "false");
-        depth_test_enabled_ = enabled;
         // 状态会在 OnDrawFrame 中应用
+        state_.Update([&](RenderState& state) {
+            state.depth_test_enabled = enabled;
+        });
+        RequestRender();
     }
 
     virtual void SetViewport(int x, int y, int width, int height) override {
-        std::lock_guard<std::mutex> lock(mutex_);
-        viewport_x_ = x;
-        viewport_y_ = y;
-        viewport_width_ = width;
-        viewport_height_ = height;
-        viewport_set_ = true;
+        bool changed = false;
+        state_.Update([&](RenderState& state) {
+            // 上层每帧都会重复设置视口，只有真正变化时才请求重绘
+            changed = !state.viewport_set || state.viewport_x != x || state.viewport_y != y ||
+                      state.viewport_width != width || state.viewport_height != height;
+            state.viewport_x = x;
+            state.viewport_y = y;
+            state.viewport_width = width;
+            state.viewport_height = height;
+            state.viewport_set = true;
+        });
+        if (changed) {
+            RequestRender();
+        }
     }
 
     virtual void SetScissor(int x, int y, int width, int height) override {
-        std::lock_guard<std::mutex> lock(mutex_);
-        scissor_x_ = x;
-        scissor_y_ = y;
-        scissor_width_ = width;
-        scissor_height_ = height;
+        bool changed = false;
+        state_.Update([&](RenderState& state) {
+            changed = state.scissor_x != x || state.scissor_y != y ||
+                      state.scissor_width != width || state.scissor_height != height;
+            state.scissor_x = x;
+            state.scissor_y = y;
+            state.scissor_width = width;
+            state.scissor_height = height;
+        });
+        if (changed) {
+            RequestRender();
+        }
     }
 
     virtual void SetScissorEnabled(bool enabled) override {
-        std::lock_guard<std::mutex> lock(mutex_);
-        scissor_enabled_ = enabled;
+        bool changed = false;
+        state_.Update([&](RenderState& state) {
+            changed = state.scissor_enabled != enabled;
+            state.scissor_enabled = enabled;
+        });
+        if (changed) {
+            RequestRender();
+        }
     }
 
     virtual void SetBlendEnabled(bool enabled) override {
-        std::lock_guard<std::mutex> lock(mutex_);
         MD_LOGI("MD360RendererPrivate::SetBlendEnabled called: enabled=%s", enabled ? "true" : "false");
-        blend_enabled_ = enabled;
+        state_.Update([&](RenderState& state) {
+            state.blend_enabled = enabled;
+        });
+        RequestRender();
     }
 
     virtual void SetBlendFunc(int src, int dst) override {
-        std::lock_guard<std::mutex> lock(mutex_);
         MD_LOGI("MD360RendererPrivate::SetBlendFunc called: src=0x%x, dst=0x%x", src, dst);
-        blend_src_ = src;
-        blend_dst_ = dst;
+        state_.Update([&](RenderState& state) {
+            state.blend_src = src;
+            state.blend_dst = dst;
+        });
+        RequestRender();
     }
 
     virtual void SetProjectionMode(int mode) override {
-        std::lock_guard<std::mutex> lock(mutex_);
         MD_LOGI("MD360RendererPrivate::SetProjectionMode called: mode=%d", mode);
         
-        // 在 GL 线程中重新创建 3D 对象
-        // 注意：这里只是标记需要更新，实际更新在 OnDrawFrame 中进行
-        pending_projection_mode_change_ = true;
-        pending_projection_mode_ = mode;
+        // 在 GL 线程中重新创建 3D 对象，连续切换时只执行最后一次
+        command_queue_.Push(MD_GL_CMD_SET_PROJECTION_MODE, mode);
+        RequestRender();
+    }
+
+    // GL线程执行完之前提交的所有命令后调用 callback（参数为 MD_OK，渲染器销毁时为 MD_ERR_CANCELLED）
+    virtual void Flush(std::function<void(int)> callback) override {
+        command_queue_.Push(MD_GL_CMD_FLUSH, 0, std::move(callback));
+        RequestRender();
     }
     
-    // 在 GL 线程中更新投影模式（由 OnDrawFrame 调用）
-    void UpdateProjectionModeIfNeeded() {
-        std::lock_guard<std::mutex> lock(mutex_);
-        if (pending_projection_mode_change_) {
-            pending_projection_mode_change_ = false;
-            int mode = pending_projection_mode_;
-            
-            // 销毁旧的 3D 对象
-            if (object3d_) {
-                object3d_->Destroy();
-                object3d_ = nullptr;
+    // 在 GL 线程中切换投影模式（由命令队列调用）
+    void ApplyProjectionMode(int mode) {
+        // 销毁旧的 3D 对象
+        if (object3d_) {
+            object3d_->Destroy();
+            object3d_ = nullptr;
+        }
+        
+        // 创建新的 3D 对象，沿用当前的细分级别
+        object3d_ = std::make_shared<MDObject3D>();
+        object3d_->SetLodLevel(mesh_lod_level_.load());
+        stereo_layout_ = MDStereoLayout::FromProjectionMode(mode);
+        projection_mode_ = mode;
+        
+        // 根据模式加载不同的几何体
+        switch (mode) {
+            case 201: // PROJECTION_MODE_SPHERE
+                object3d_->LoadSphere();
+                MD_LOGI("MD360RendererPrivate::UpdateProjectionMode: Loaded SPHERE");
+                break;
+            case 206: // PROJECTION_MODE_STEREO_SPHERE
+            case 212: // PROJECTION_MODE_STEREO_SPHERE_HORIZONTAL
+            case 213: // PROJECTION_MODE_STEREO_SPHERE_VERTICAL
+                // 与单眼球面共用网格（和缓存、资源里的同一份），每只眼睛只换纹理坐标变换
+                object3d_->LoadSphere();
+                MD_LOGI("MD360RendererPrivate::UpdateProjectionMode: Loaded STEREO_SPHERE, layout=%d", stereo_layout_);
+                break;
+            case 202: // PROJECTION_MODE_DOME180
+                object3d_->LoadDome(180.0f, false);
+                MD_LOGI("MD360RendererPrivate::UpdateProjectionMode: Loaded DOME180");
+                break;
+            case 203: // PROJECTION_MODE_DOME230
+                object3d_->LoadDome(230.0f, false);
+                MD_LOGI("MD360RendererPrivate::UpdateProjectionMode: Loaded DOME230");
+                break;
+            case 204: // PROJECTION_MODE_DOME180_UPPER
+                object3d_->LoadDome(180.0f, true);
+                MD_LOGI("MD360RendererPrivate::UpdateProjectionMode: Loaded DOME180_UPPER");
+                break;
+            case 205: // PROJECTION_MODE_DOME230_UPPER
+                object3d_->LoadDome(230.0f, true);
+                MD_LOGI("MD360RendererPrivate::UpdateProjectionMode: Loaded DOME230_UPPER");
+                break;
+            case 207: // PROJECTION_MODE_PLANE_FIT
+            case 208: // PROJECTION_MODE_PLANE_CROP
+            case 209: { // PROJECTION_MODE_PLANE_FULL
+                // 缩放在绘制时按视频和视口的宽高比计算，网格只随眼镜模式的屏幕弧度变化
+                object3d_->SetPlaneCurve(PlaneCurve(state_.Read()));
+                object3d_->LoadPlane();
+                MD_LOGI("MD360RendererPrivate::UpdateProjectionMode: Loaded PLANE, mode=%d", mode);
+                break;
             }
-            
-            // 创建新的 3D 对象
-            object3d_ = std::make_shared<MDObject3D>();
-            
-            // 根据模式加载不同的几何体
-            switch (mode) {
-                case 201: // PROJECTION_MODE_SPHERE
-                    object3d_->LoadSphere();
-                    MD_LOGI("MD360RendererPrivate::UpdateProjectionMode: Loaded SPHERE");
-                    break;
-                case 202: // PROJECTION_MODE_DOME180
-                    object3d_->LoadDome(180.0f, false);
-                    MD_LOGI("MD360RendererPrivate::UpdateProjectionMode: Loaded DOME180");
-                    break;
-                case 203: // PROJECTION_MODE_DOME230
-                    object3d_->LoadDome(230.0f, false);
-                    MD_LOGI("MD360RendererPrivate::UpdateProjectionMode: Loaded DOME230");
-                    break;
-                case 204: // PROJECTION_MODE_DOME180_UPPER
-                    object3d_->LoadDome(180.0f, true);
-                    MD_LOGI("MD360RendererPrivate::UpdateProjectionMode: Loaded DOME180_UPPER");
-                    break;
-                case 205: // PROJECTION_MODE_DOME230_UPPER
-                    object3d_->LoadDome(230.0f, true);
-                    MD_LOGI("MD360RendererPrivate::UpdateProjectionMode: Loaded DOME230_UPPER");
-                    break;
-                case 214: // PROJECTION_MODE_CUBE
-                    object3d_->LoadCube();
-                    MD_LOGI("MD360RendererPrivate::UpdateProjectionMode: Loaded CUBE");
-                    break;
-                default:
-                    object3d_->LoadSphere();
-                    MD_LOGW("MD360RendererPrivate::UpdateProjectionMode: Unknown mode %d, using SPHERE", mode);
-                    break;
+            case 210: // PROJECTION_MODE_MULTI_FISH_EYE_HORIZONTAL
+            case 211: { // PROJECTION_MODE_MULTI_FISH_EYE_VERTICAL
+                // 直接取最新的标定，刚设置的标定不会先按旧值生成一次
+                bool vertical = mode == 211;
+                MDFisheyeLens lenses[MDDualFisheye::LENS_COUNT];
+                ResolveFisheyeLenses(state_.Read(), vertical, lenses);
+                object3d_->SetFisheyeLenses(lenses);
+                object3d_->LoadDualFisheye(vertical);
+                MD_LOGI("MD360RendererPrivate::UpdateProjectionMode: Loaded DUAL_FISHEYE, vertical=%d", vertical);
+                break;
             }
+            case 214: { // PROJECTION_MODE_CUBE
+                const RenderState& state = state_.Read();
+                object3d_->SetCubeLayout(state.cube_layout, state.cube_padding);
+                object3d_->LoadCube();
+                MD_LOGI("MD360RendererPrivate::UpdateProjectionMode: Loaded CUBE, layout=%d", state.cube_layout);
+                break;
+            }
+            default:
+                object3d_->LoadSphere();
+                MD_LOGW("MD360RendererPrivate::UpdateProjectionMode: Unknown mode %d, using SPHERE", mode);
+                break;
         }
     }
 
-    // 在 GL 线程中清理 VR 资源（由 OnDrawFrame 调用）
-    void CleanupVRResourcesIfNeeded() {
-        std::lock_guard<std::mutex> lock(mutex_);
-        if (pending_vr_cleanup_) {
-            pending_vr_cleanup_ = false;
-            
-            // 清理VR shader程序
-            if (vr_program_ != 0) {
-                glDeleteProgram(vr_program_);
-                vr_program_ = 0;
-            }
-            
-            vr_shaders_initialized_ = false;
-            vr_mvp_matrix_loc_ = -1;
-            vr_st_matrix_loc_ = -1;
-            vr_texture_loc_ = -1;
-            vr_distortion_params_loc_ = -1;
-            vr_eye_offset_loc_ = -1;
+    // 在 GL 线程中清理 VR 资源（由命令队列调用）
+    void ResetVRResources() {
+        // 清理VR shader程序，下次渲染VR时 InitVRShaders 会创建新的
+        if (vr_program_ != 0) {
+            glDeleteProgram(vr_program_);
+            vr_program_ = 0;
         }
+        
+        vr_shaders_initialized_ = false;
+        reprojector_.Invalidate();
+        vr_mvp_matrix_loc_ = -1;
+        vr_st_matrix_loc_ = -1;
+        vr_texture_loc_ = -1;
+        vr_distortion_params_loc_ = -1;
+        vr_eye_offset_loc_ = -1;
     }
 
     // VR模式接口实现
     virtual void SetVRModeEnabled(bool enabled) override {
-        std::lock_guard<std::mutex> lock(mutex_);
-        
-        // 如果切换到VR模式，需要先清理旧的VR shader资源
-        if (enabled && vr_shaders_initialized_) {
-            // 标记需要清理，下一帧会在GL线程中清理旧资源
-            // 然后 InitVRShaders 会创建新的
-            pending_vr_cleanup_ = true;
-        }
-        
-        vr_config_.enabled = enabled;
-        
-        // 设置合理的默认参数
-        if (enabled) {
-            // 默认瞳距64mm
-            vr_config_.ipd = 0.064f;
-            // 默认眼偏移
-            vr_config_.eyeOffset = 0.03f;
-            // 默认桶形畸变参数（轻微畸变）
-            vr_config_.k1 = 0.9f;
-            vr_config_.k2 = 0.1f;
-            vr_config_.scale = 0.95f;
-            vr_config_.barrelDistortionEnabled = true;
+        state_.Update([&](RenderState& state) {
+            state.vr_config.enabled = enabled;
             
-            // 重置着色器状态，下次渲染时会重新初始化
-            // 注意：不要在这里删除shader，因为不在GL线程
-            vr_shaders_initialized_ = false;
+            // 设置合理的默认参数
+            if (enabled) {
+                // 默认瞳距64mm
+                state.vr_config.ipd = 0.064f;
+                // 默认眼偏移
+                state.vr_config.eyeOffset = 0.03f;
+                // 默认桶形畸变参数（轻微畸变）
+                state.vr_config.k1 = 0.9f;
+                state.vr_config.k2 = 0.1f;
+                state.vr_config.scale = 0.95f;
+                state.vr_config.barrelDistortionEnabled = true;
+                
+                // VR模式下也启用触控
+                state.use_touch_control = true;
+            }
             
-            // VR模式下也启用触控
-            use_touch_control_ = true;
-        } else {
-            // 切换到非VR模式时，标记需要清理VR资源
-            // 实际清理会在GL线程的下一帧进行
-            pending_vr_cleanup_ = true;
-        }
+        });
+        // 切换模式时需要重建VR资源，实际清理在GL线程的下一帧进行
+        // 注意：不要在这里删除shader，因为不在GL线程
+        command_queue_.Push(MD_GL_CMD_RESET_VR_RESOURCES, 0);
+        vr_enabled_ = enabled;
+        RequestRender();
     }
 
     virtual void SetIPD(float ipd) override {
-        std::lock_guard<std::mutex> lock(mutex_);
-        vr_config_.ipd = ipd;
+        state_.Update([&](RenderState& state) {
+            state.vr_config.ipd = ipd;
+        });
         MD_LOGI("MD360RendererPrivate::SetIPD: %f", ipd);
+        RequestRender();
     }
 
     virtual void SetBarrelDistortionEnabled(bool enabled) override {
-        std::lock_guard<std::mutex> lock(mutex_);
-        vr_config_.barrelDistortionEnabled = enabled;
+        state_.Update([&](RenderState& state) {
+            state.vr_config.barrelDistortionEnabled = enabled;
+        });
         MD_LOGI("MD360RendererPrivate::SetBarrelDistortionEnabled: %s", enabled ? "true" : "false");
+        RequestRender();
     }
 
     virtual void SetBarrelDistortionParams(float k1, float k2, float scale) override {
-        std::lock_guard<std::mutex> lock(mutex_);
-        
         if (k1 < 0.1f || k1 > 2.0f) {
             MD_LOGW("MD360RendererPrivate::SetBarrelDistortionParams: k1=%f out of range (0.1-2.0), clamping", k1);
             k1 = std::max(0.1f, std::min(k1, 2.0f));
@@ -421,96 +601,119 @@ public:
             scale = std::max(0.1f, std::min(scale, 2.0f));
         }
         
-        vr_config_.k1 = k1;
-        vr_config_.k2 = k2;
-        vr_config_.scale = scale;
+        state_.Update([&](RenderState& state) {
+            state.vr_config.k1 = k1;
+            state.vr_config.k2 = k2;
+            state.vr_config.scale = scale;
+        });
         
         MD_LOGI("MD360RendererPrivate::SetBarrelDistortionParams: k1=%f, k2=%f, scale=%f", k1, k2, scale);
+        RequestRender();
     }
 
     virtual void SetEyeOffset(float offset) override {
-        std::lock_guard<std::mutex> lock(mutex_);
-        vr_config_.eyeOffset = offset;
+        state_.Update([&](RenderState& state) {
+            state.vr_config.eyeOffset = offset;
+        });
         MD_LOGI("MD360RendererPrivate::SetEyeOffset: %f", offset);
+        RequestRender();
     }
 
     virtual bool IsVRModeEnabled() const override {
-        return vr_config_.enabled;
+        return vr_enabled_;
     }
     
     virtual void UpdateSensorMatrix(float* matrix) override {
-        std::lock_guard<std::mutex> lock(mutex_);
-        if (matrix) {
-            std::copy(matrix, matrix + 16, sensor_matrix_);
-            sensor_matrix_updated_ = true;
-            MD_LOGI("UpdateSensorMatrix: matrix[0-3]=[%.3f, %.3f, %.3f, %.3f]", 
-                   sensor_matrix_[0], sensor_matrix_[1], sensor_matrix_[2], sensor_matrix_[3]);
+        if (!matrix) {
+            return;
+        }
+        // 只投递到姿态信箱，GL线程在上传每只眼睛的矩阵前才取最新值
+        if (pose_mailbox_.Publish(matrix, MDNowNs())) {
+            RequestRender();
         }
     }
 
     virtual int OnDrawFrame() override {
-        // 检查是否需要更新投影模式
-        UpdateProjectionModeIfNeeded();
+        const RenderState& state = frame_state_;
+
+        // 动态分辨率：VR重投影时眼睛本来就渲染到离屏缓冲，直接缩小眼睛缓冲（见 RenderVRStereo）；
+        // 其他情况渲染到缩小的离屏缓冲，最后放大到窗口
+        bool eye_targets = state.vr_config.enabled && reprojection_enabled_;
+        scaled_target_ = !eye_targets && resolution_scaler_.BeginTarget(surface_width_, surface_height_);
+        render_scaled_ = scaled_target_;
+
+        // 设置清除颜色和渲染状态
+        glClearColor(state.clear_color[0], state.clear_color[1], state.clear_color[2], state.clear_color[3]);
         
-        // 检查是否需要清理VR资源（在GL线程中执行）
-        CleanupVRResourcesIfNeeded();
+        // 应用渲染状态
+        if (state.cull_face_enabled) {
+            glEnable(GL_CULL_FACE);
+            // 对于360度视频，需要从球体内部看，所以设置顺时针为正面
+            glFrontFace(GL_CW);
+        } else {
+            glDisable(GL_CULL_FACE);
+        }
         
-        // 设置清除颜色和渲染状态
-        {
-            std::lock_guard<std::mutex> lock(mutex_);
-            glClearColor(clear_color_[0], clear_color_[1], clear_color_[2], clear_color_[3]);
-            
-            // 应用渲染状态
-            if (cull_face_enabled_) {
-                glEnable(GL_CULL_FACE);
-                // 对于360度视频，需要从球体内部看，所以设置顺时针为正面
-                glFrontFace(GL_CW);
-            } else {
-                glDisable(GL_CULL_FACE);
-            }
-            
-            if (depth_test_enabled_) {
-                glEnable(GL_DEPTH_TEST);
-                glDepthFunc(GL_LEQUAL);
+        if (state.depth_test_enabled) {
+            glEnable(GL_DEPTH_TEST);
+            glDepthFunc(GL_LEQUAL);
+        } else {
+            glDisable(GL_DEPTH_TEST);
+        }
+        
+        // VR模式下不在这里设置viewport，由RenderVRStereo处理
+        if (!state.vr_config.enabled) {
+            if (state.viewport_set) {
+                glViewport(RenderSize(state.viewport_x), RenderSize(state.viewport_y),
+                           RenderSize(state.viewport_width), RenderSize(state.viewport_height));
             } else {
-                glDisable(GL_DEPTH_TEST);
-            }
-            
-            // VR模式下不在这里设置viewport，由RenderVRStereo处理
-            if (!vr_config_.enabled) {
-                if (viewport_set_) {
-                    glViewport(viewport_x_, viewport_y_, viewport_width_, viewport_height_);
-                } else {
-                    int viewport_width = surface_width_ > 0 ? surface_width_ : 1920;
-                    int viewport_height = surface_height_ > 0 ? surface_height_ : 1080;
-                    glViewport(0, 0, viewport_width, viewport_height);
-                }
-                
-                // 应用裁剪状态
-                if (scissor_enabled_) {
-                    glEnable(GL_SCISSOR_TEST);
-                    glScissor(scissor_x_, scissor_y_, scissor_width_, scissor_height_);
-                } else {
-                    glDisable(GL_SCISSOR_TEST);
-                }
+                int viewport_width = surface_width_ > 0 ? surface_width_ : 1920;
+                int viewport_height = surface_height_ > 0 ? surface_height_ : 1080;
+                glViewport(0, 0, RenderSize(viewport_width), RenderSize(viewport_height));
             }
             
-            // 应用混合状态
-            if (blend_enabled_) {
-                glEnable(GL_BLEND);
-                glBlendFunc(blend_src_, blend_dst_);
+            // 应用裁剪状态
+            if (state.scissor_enabled) {
+                glEnable(GL_SCISSOR_TEST);
+                glScissor(RenderSize(state.scissor_x), RenderSize(state.scissor_y),
+                          RenderSize(state.scissor_width), RenderSize(state.scissor_height));
             } else {
-                glDisable(GL_BLEND);
+                glDisable(GL_SCISSOR_TEST);
             }
         }
         
+        // 应用混合状态
+        if (state.blend_enabled) {
+            glEnable(GL_BLEND);
+            glBlendFunc(state.blend_src, state.blend_dst);
+        } else {
+            glDisable(GL_BLEND);
+        }
+        
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
         
-        if (vr_config_.enabled) {
-            return RenderVRStereo();
+        frame_mesh_triangles_ = 0;
+        frame_submitted_triangles_ = 0;
+        frame_draw_calls_ = 0;
+        int result = MD_OK;
+        if (state.vr_config.enabled) {
+            result = RenderVRStereo();
         } else {
-            return RenderNormalMode();
+            result = RenderNormalMode();
+        }
+        if (frame_mesh_triangles_ > 0) {
+            mesh_culled_ratio_ = 1.0 - static_cast<double>(frame_submitted_triangles_) / frame_mesh_triangles_;
+            mesh_draw_calls_ = frame_draw_calls_;
         }
+        if (scaled_target_) {
+            resolution_scaler_.EndTarget(surface_width_, surface_height_);
+        }
+        return result;
+    }
+
+    // 本帧渲染目标上的尺寸：缩小渲染时按动态分辨率比例换算窗口坐标
+    int RenderSize(int size) const {
+        return render_scaled_ ? resolution_scaler_.ScaledSize(size) : size;
     }
 
     //// MD360LifecycleAPI
@@ -519,43 +722,551 @@ public:
             return MD_OK;
         }
         is_init_ = true;
-        // 使用 this->shared_from_this() 来明确调用基类的方法
-        std::weak_ptr<MD360RendererPrivate> weak_this = this->shared_from_this();
-        thread_ = std::thread([=]() {
-            auto shared_this = weak_this.lock();
-            if (shared_this == nullptr) {
-                return;
-            }
-            shared_this->RunGL();
-            MD_LOGI("MD360RendererPrivate gl thread exit ok.");
-        });
+        host_ = AcquireHost();
+        video_share_from_ = nullptr;
+        frame_scheduler_ = host_->GetScheduler();
+        egl_->SetSharedContext(host_->GetEglContext());
+        host_->AddClient(this->shared_from_this());
         return MD_OK;
     }
+
+    // 默认挂到进程共享的渲染宿主上，多个渲染器共用一个GL线程和上下文；指定了时钟的单独建一个宿主
+    // 共享视频源时必须和视频源的所有者在同一个宿主（同一个GL上下文）上，纹理才能共用
+    std::shared_ptr<MDRenderHost> AcquireHost() {
+        if (host_ == nullptr) {
+            if (video_share_from_ != nullptr) {
+                host_ = video_share_from_->AcquireHost();
+            } else if (frame_clock_ != nullptr) {
+                host_ = std::make_shared<MDRenderHost>(frame_clock_);
+            } else {
+                host_ = MDRenderHost::GetShared();
+            }
+        }
+        return host_;
+    }
+
     virtual int Destroy() override {
         if (is_destroyed_) {
             return MD_OK;
         }
         is_destroyed_ = true;
         MD_LOGI("MD360RendererPrivate::Destroy");
-        
-        // 等待渲染线程退出
-        if (thread_.joinable()) {
-            thread_.join();
-            MD_LOGI("MD360RendererPrivate::Destroy thread joined");
+        // 等待GL线程释放这个渲染器的资源
+        if (host_ != nullptr) {
+            host_->RemoveClient(this);
+            MD_LOGI("MD360RendererPrivate::Destroy released from render host");
         }
+        // 离开宿主后不再持有它：否则渲染器最后在哪个线程析构，宿主就可能跟着在哪个线程析构，
+        // 落在宿主自己的GL线程上时会 join 自己。RequestRender 可能在其他线程同时读取，原子地置空
+        std::atomic_store(&host_, std::shared_ptr<MDRenderHost>());
+        // 还没执行的命令不会再执行了，通知等待者
+        command_queue_.Close(MD_ERR_CANCELLED);
         
         return MD_OK;
     }
     virtual int Resume() override {
+        if (is_paused_) {
+            // 从这里开始计时，恢复后第一帧交换完成时记录
+            resume_request_ns_ = MDNowNs();
+        }
         is_paused_ = false;
+        RequestRender();
         return MD_OK;
     }
     virtual int Pause() override {
-        is_paused_ = true;
+        return Suspend(false);
+    }
+
+    // 挂起后 NeedsFrame 返回 false，宿主上所有渲染器都不需要绘制时GL线程在条件变量上休眠，不再按vsync空转
+    virtual int Suspend(bool release_gpu_memory) override {
+        MD_LOGI("MD360RendererPrivate::Suspend: release_gpu_memory=%d", release_gpu_memory);
+        if (!is_paused_.exchange(true)) {
+            suspend_count_++;
+        }
+        resume_request_ns_ = 0;
+        if (release_gpu_memory) {
+            // 挂起时仍会执行待处理的命令，释放完成后宿主才休眠
+            command_queue_.Push(MD_GL_CMD_RELEASE_GPU_RESOURCES, 0);
+        }
+        RequestRender();
         return MD_OK;
     }
+
+    virtual MDSuspendStats GetSuspendStats() override {
+        MDSuspendStats stats;
+        stats.suspend_count = suspend_count_.load();
+        stats.gpu_released = gpu_released_.load();
+        stats.last_rebuild_ms = last_rebuild_ns_.load() / 1000000.0;
+        stats.last_resume_to_first_frame_ms = last_resume_to_first_frame_ns_.load() / 1000000.0;
+        stats.program_binary_hits = MDProgramCache::GetInstance().GetHitCount();
+        stats.program_binary_misses = MDProgramCache::GetInstance().GetMissCount();
+        return stats;
+    }
+
+    virtual void SetFrameClock(std::shared_ptr<MDFrameClock> clock) override {
+        if (is_init_) {
+            MD_LOGW("MD360RendererPrivate::SetFrameClock: must be called before Init, ignored");
+            return;
+        }
+        frame_clock_ = clock;
+    }
+
+    virtual MDFrameSchedulerStats GetFrameSchedulerStats() override {
+        auto scheduler = frame_scheduler_;
+        return scheduler ? scheduler->GetStats() : MDFrameSchedulerStats();
+    }
+
+    virtual void SetRenderMode(int mode) override {
+        if (mode != MD_RENDER_MODE_WHEN_DIRTY && mode != MD_RENDER_MODE_CONTINUOUSLY) {
+            MD_LOGW("MD360RendererPrivate::SetRenderMode: invalid mode %d, ignored", mode);
+            return;
+        }
+        MD_LOGI("MD360RendererPrivate::SetRenderMode: mode=%d", mode);
+        render_mode_ = mode;
+        RequestRender();
+    }
+
+    virtual void RequestRender() override {
+        render_requested_ = true;
+        std::shared_ptr<MDRenderHost> host = std::atomic_load(&host_);
+        if (host != nullptr) {
+            host->Wakeup();
+        }
+    }
+
+    virtual uint64_t GetSkippedFrameCount() override {
+        return skipped_frame_count_.load();
+    }
+
+    virtual void GetFrameStats(std::vector<MDStageStats>* stages) override {
+        frame_stats_.GetSnapshot(stages);
+    }
+
+    virtual void ResetFrameStats() override {
+        frame_stats_.Reset();
+    }
+
+    virtual void SetReprojectionEnabled(bool enabled) override {
+        MD_LOGI("MD360RendererPrivate::SetReprojectionEnabled: %d", enabled);
+        reprojection_enabled_ = enabled;
+        RequestRender();
+    }
+
+    virtual MDReprojectionStats GetReprojectionStats() override {
+        MDReprojectionStats stats;
+        stats.rendered_frames = rendered_frame_count_.load();
+        stats.reprojected_frames = reprojected_frame_count_.load();
+        return stats;
+    }
+
+    virtual void SetDynamicResolution(bool enabled, float min_scale, float max_scale) override {
+        MD_LOGI("MD360RendererPrivate::SetDynamicResolution: enabled=%d, scale=[%f, %f]", enabled, min_scale, max_scale);
+        resolution_scaler_.SetScaleRange(min_scale, max_scale);
+        resolution_scaler_.SetEnabled(enabled);
+        RequestRender();
+    }
+
+    virtual MDResolutionStats GetResolutionStats() override {
+        MDResolutionStats stats;
+        resolution_scaler_.GetStats(&stats);
+        return stats;
+    }
+
+    virtual void SetMeshLodLevel(int level) override {
+        MD_LOGI("MD360RendererPrivate::SetMeshLodLevel: %d", level);
+        mesh_lod_override_ = (level >= 0 && level < MD_MESH_LOD_COUNT) ? level : MD_MESH_LOD_AUTO;
+        RequestRender();
+    }
+
+    virtual MDMeshLodStats GetMeshLodStats() override {
+        MDMeshLodStats stats;
+        stats.auto_select = mesh_lod_override_.load() == MD_MESH_LOD_AUTO;
+        stats.level = mesh_lod_level_.load();
+        stats.triangles = mesh_triangles_.load();
+        stats.switch_count = mesh_lod_switch_count_.load();
+        return stats;
+    }
+
+    virtual void SetFrustumCullingEnabled(bool enabled) override {
+        MD_LOGI("MD360RendererPrivate::SetFrustumCullingEnabled: %d", enabled);
+        frustum_culling_enabled_ = enabled;
+        RequestRender();
+    }
+
+    virtual MDCullingStats GetCullingStats() override {
+        MDCullingStats stats;
+        stats.enabled = frustum_culling_enabled_.load();
+        stats.culled_ratio = mesh_culled_ratio_.load();
+        stats.draw_calls = mesh_draw_calls_.load();
+        stats.submitted_triangles = mesh_submitted_triangles_.load();
+        stats.culled_triangles = mesh_culled_triangles_.load();
+        return stats;
+    }
+
+    virtual void SetRayCastEnabled(int projection_mode, bool enabled) override {
+        MD_LOGI("MD360RendererPrivate::SetRayCastEnabled: mode=%d, enabled=%d", projection_mode, enabled);
+        if (!MDRayCaster::SupportsProjection(projection_mode)) {
+            MD_LOGW("MD360RendererPrivate::SetRayCastEnabled: mode %d not supported, keeping the mesh", projection_mode);
+            return;
+        }
+        uint32_t bit = 1u << (projection_mode - MDObject3D::SPHERE);
+        if (enabled) {
+            ray_cast_modes_ |= bit;
+        } else {
+            ray_cast_modes_ &= ~bit;
+        }
+        RequestRender();
+    }
+
+    virtual MDRayCastStats GetRayCastStats() override {
+        MDRayCastStats stats;
+        stats.mode_mask = ray_cast_modes_.load();
+        stats.active = ray_cast_active_.load();
+        stats.draws = ray_cast_draws_.load();
+        return stats;
+    }
+
+    virtual int LoadMeshAsset(int fd, int64_t offset, int64_t length) override {
+        int error = MD_OK;
+        std::shared_ptr<MDMeshAsset> asset = MDMeshAsset::Open(fd, offset, length, &error);
+        if (asset == nullptr) {
+            MD_LOGE("MD360RendererPrivate::LoadMeshAsset: failed to load mesh asset, error=%d", error);
+            return error;
+        }
+        MD_LOGI("MD360RendererPrivate::LoadMeshAsset: %d meshes, %zu bytes", asset->GetEntryCount(), asset->GetSize());
+        MDMeshCache::GetInstance().SetAsset(asset);
+        return MD_OK;
+    }
+
+    virtual int SetFisheyeLens(int index, float center_x, float center_y, float radius_x, float radius_y,
+                               float fov) override {
+        MD_LOGI("MD360RendererPrivate::SetFisheyeLens: lens=%d, center=(%f, %f), radius=(%f, %f), fov=%f",
+                index, center_x, center_y, radius_x, radius_y, fov);
+        MDFisheyeLens lens;
+        if (fov > 0.0f) {
+            lens.center_x = center_x;
+            lens.center_y = center_y;
+            lens.radius_x = radius_x;
+            lens.radius_y = radius_y;
+            lens.fov = fov;
+        }
+        if (index < 0 || index >= MDDualFisheye::LENS_COUNT || (fov > 0.0f && !MDDualFisheye::IsValidLens(lens))) {
+            MD_LOGW("MD360RendererPrivate::SetFisheyeLens: invalid lens %d", index);
+            return MD_ERR_INVALID_PARAM;
+        }
+        state_.Update([&](RenderState& state) {
+            state.fisheye_lenses[index] = lens;
+        });
+        RequestRender();
+        return MD_OK;
+    }
+
+    virtual int SetCubeLayout(int layout, bool equi_angular, float padding) override {
+        MD_LOGI("MD360RendererPrivate::SetCubeLayout: layout=%d, equi_angular=%d, padding=%f", layout, equi_angular,
+                padding);
+        if (!MDCubeLayout::IsValid(layout, padding)) {
+            MD_LOGW("MD360RendererPrivate::SetCubeLayout: invalid layout %d or padding %f", layout, padding);
+            return MD_ERR_INVALID_PARAM;
+        }
+        state_.Update([&](RenderState& state) {
+            state.cube_layout = layout;
+            state.cube_padding = padding;
+            state.cube_equi_angular = equi_angular;
+        });
+        RequestRender();
+        return MD_OK;
+    }
+
+    virtual int SetStereoEyeOffset(float left_yaw, float right_yaw) override {
+        MD_LOGI("MD360RendererPrivate::SetStereoEyeOffset: left=%f, right=%f", left_yaw, right_yaw);
+        if (!(std::fabs(left_yaw) <= 180.0f) || !(std::fabs(right_yaw) <= 180.0f)) {
+            MD_LOGW("MD360RendererPrivate::SetStereoEyeOffset: offset out of range");
+            return MD_ERR_INVALID_PARAM;
+        }
+        state_.Update([&](RenderState& state) {
+            state.stereo_eye_yaw[0] = left_yaw;
+            state.stereo_eye_yaw[1] = right_yaw;
+        });
+        RequestRender();
+        return MD_OK;
+    }
+
+    virtual int SetPlaneOptions(int scale_type, float curve_degree) override {
+        MD_LOGI("MD360RendererPrivate::SetPlaneOptions: scale_type=%d, curve=%f", scale_type, curve_degree);
+        if (!MDPlaneScale::IsValid(scale_type, curve_degree)) {
+            MD_LOGW("MD360RendererPrivate::SetPlaneOptions: invalid scale type %d or curve %f", scale_type,
+                    curve_degree);
+            return MD_ERR_INVALID_PARAM;
+        }
+        state_.Update([&](RenderState& state) {
+            state.plane_scale_type = scale_type;
+            state.plane_curve_degree = curve_degree;
+        });
+        RequestRender();
+        return MD_OK;
+    }
+
+    virtual void SetVideoCadenceEnabled(bool enabled) override {
+        MD_LOGI("MD360RendererPrivate::SetVideoCadenceEnabled: %d", enabled);
+        video_cadence_enabled_ = enabled;
+        RequestRender();
+    }
+
+    virtual MDVideoCadenceStats GetVideoCadenceStats() override {
+        MDVideoCadenceStats stats;
+        int64_t period_ns = video_source_->GetFramePeriodNs();
+        stats.source_fps = period_ns > 0 ? 1000000000.0 / period_ns : 0.0;
+        stats.active = video_cadence_active_.load();
+        stats.held_vsyncs = held_vsync_count_.load();
+        return stats;
+    }
+
+    virtual void SetPosePrediction(bool enabled, float latency_ms) override {
+        MD_LOGI("MD360RendererPrivate::SetPosePrediction: enabled=%d, latency=%fms", enabled, latency_ms);
+        pose_prediction_enabled_ = enabled;
+        prediction_latency_ns_ = latency_ms < 0.0f ? -1 : static_cast<int64_t>(latency_ms * 1000000.0f);
+        RequestRender();
+    }
 private:
 
+    // 按需渲染：没有新的视频帧、姿态或状态变化时不需要绘制，宿主所有渲染器都不需要时GL线程休眠
+    virtual bool NeedsFrame() override {
+        if (is_destroyed_) {
+            return false;
+        }
+        // 有待执行的GL命令时即使暂停也要处理（只执行命令，不绘制）
+        if (!command_queue_.IsEmpty()) {
+            return true;
+        }
+        if (is_paused_) {
+            return false;
+        }
+        if (render_mode_ != MD_RENDER_MODE_WHEN_DIRTY || !frame_listener_ok_) {
+            // 没有新帧通知时无法安全休眠，退化为每个vsync检查一次
+            return true;
+        }
+        return render_requested_;
+    }
+
+    static void CaptureRenderState(const RenderState& state, RenderStateSnapshot* snapshot) {
+        memset(snapshot, 0, sizeof(RenderStateSnapshot));
+        std::copy(state.clear_color, state.clear_color + 4, snapshot->clear_color);
+        std::copy(state.mvp_matrix, state.mvp_matrix + 16, snapshot->mvp_matrix);
+        snapshot->touch_delta[0] = state.touch_delta_x;
+        snapshot->touch_delta[1] = state.touch_delta_y;
+        snapshot->vr_params[0] = state.vr_config.ipd;
+        snapshot->vr_params[1] = state.vr_config.eyeOffset;
+        snapshot->vr_params[2] = state.vr_config.k1;
+        snapshot->vr_params[3] = state.vr_config.k2;
+        snapshot->vr_params[4] = state.vr_config.scale;
+        snapshot->stereo_eye_yaw[0] = state.stereo_eye_yaw[0];
+        snapshot->stereo_eye_yaw[1] = state.stereo_eye_yaw[1];
+        snapshot->plane_curve_degree = state.plane_curve_degree;
+        snapshot->viewport[0] = state.viewport_x;
+        snapshot->viewport[1] = state.viewport_y;
+        snapshot->viewport[2] = state.viewport_width;
+        snapshot->viewport[3] = state.viewport_height;
+        snapshot->scissor[0] = state.scissor_x;
+        snapshot->scissor[1] = state.scissor_y;
+        snapshot->scissor[2] = state.scissor_width;
+        snapshot->scissor[3] = state.scissor_height;
+        snapshot->blend_func[0] = state.blend_src;
+        snapshot->blend_func[1] = state.blend_dst;
+        snapshot->flags[0] = state.cull_face_enabled;
+        snapshot->flags[1] = state.depth_test_enabled;
+        snapshot->flags[2] = state.viewport_set;
+        snapshot->flags[3] = state.scissor_enabled;
+        snapshot->flags[4] = state.blend_enabled;
+        snapshot->flags[5] = state.vr_config.enabled;
+        snapshot->flags[6] = state.vr_config.barrelDistortionEnabled;
+        snapshot->flags[7] = state.use_touch_control;
+        snapshot->flags[8] = state.cube_equi_angular;
+        snapshot->flags[9] = state.plane_scale_type;
+    }
+
+    // 决定本帧怎么出图：
+    // 按需模式（或按片源节奏出图）下内容、状态、姿态都没变时跳过；开启重投影的VR模式下，场景状态没变且没有新视频帧
+    // （或这一帧已经来不及完整渲染）时只做重投影，仍然每个vsync出一帧；其他情况完整渲染
+    FrameAction DecideFrameAction(bool content_changed, bool cadence_active) {
+        RenderStateSnapshot state;
+        CaptureRenderState(frame_state_, &state);
+        MDPose pose = pose_mailbox_.Latch();
+        bool state_changed = !has_drawn_state_ ||
+                             memcmp(&state, &last_drawn_state_, sizeof(RenderStateSnapshot)) != 0;
+        bool pose_changed = !has_drawn_state_ || pose.sequence != last_drawn_pose_sequence_;
+        content_changed = content_changed || pending_content_;
+        bool on_demand = render_mode_ == MD_RENDER_MODE_WHEN_DIRTY || cadence_active;
+        if (on_demand && !content_changed && !state_changed && !pose_changed) {
+            return FRAME_ACTION_SKIP;
+        }
+        last_drawn_state_ = state;
+        last_drawn_pose_sequence_ = pose.sequence;
+        has_drawn_state_ = true;
+
+        if (!state_changed && CanReproject()) {
+            if (!content_changed) {
+                return FRAME_ACTION_REPROJECT;
+            }
+            // 新视频帧已经更新到纹理里，来不及完整渲染时先重投影，下一帧再完整渲染（不会连续推迟两次）
+            if (!pending_content_ && IsLateForFullRender()) {
+                pending_content_ = true;
+                return FRAME_ACTION_REPROJECT;
+            }
+        }
+        pending_content_ = false;
+        return FRAME_ACTION_RENDER;
+    }
+
+    // 按本帧的输出分辨率和视野选择网格细分级别，级别变化时重新加载网格并强制完整渲染一帧
+    // 动态分辨率的缩放不参与选择，避免缩放比例调整时跟着切换网格
+    void UpdateMeshLod() {
+        if (object3d_ == nullptr) {
+            return;
+        }
+        const RenderState& state = frame_state_;
+        int level = mesh_lod_override_.load();
+        if (level == MD_MESH_LOD_AUTO) {
+            int viewport_height = surface_height_;
+            float fov_y = MD_VR_EYE_FOV_Y;
+            if (!state.vr_config.enabled) {
+                if (state.viewport_set) {
+                    viewport_height = state.viewport_height;
+                }
+                fov_y = MDMeshLod::FovYFromMatrix(state.mvp_matrix, MD_NORMAL_FOV_Y);
+            }
+            level = MDMeshLod::SelectLevel(object3d_->GetLodLevel(), viewport_height, fov_y);
+        }
+        if (level != object3d_->GetLodLevel()) {
+            MD_LOGI("MD360RendererPrivate::UpdateMeshLod: level %d -> %d", object3d_->GetLodLevel(), level);
+            object3d_->SetLodLevel(level);
+            mesh_lod_switch_count_++;
+            has_drawn_state_ = false;
+        }
+        mesh_lod_level_ = object3d_->GetLodLevel();
+        mesh_triangles_ = object3d_->GetTriangleCount();
+    }
+
+    static void ResolveFisheyeLenses(const RenderState& state, bool vertical,
+                                     MDFisheyeLens lenses[MDDualFisheye::LENS_COUNT]) {
+        for (int i = 0; i < MDDualFisheye::LENS_COUNT; i++) {
+            lenses[i] = MDDualFisheye::ResolveLens(state.fisheye_lenses[i], vertical, i);
+        }
+    }
+
+    // 把本帧的投影参数（双鱼眼的镜头标定、立方体贴图的排列）交给3D对象，变化时在工作线程中重新生成网格，
+    // 就绪前继续绘制旧网格
+    void UpdateProjectionParams() {
+        if (object3d_ == nullptr) {
+            return;
+        }
+        int type = object3d_->GetProjectionType();
+        if (MDObject3D::IsDualFisheye(type)) {
+            MDFisheyeLens lenses[MDDualFisheye::LENS_COUNT];
+            ResolveFisheyeLenses(frame_state_, type == MDObject3D::DUAL_FISHEYE_VERTICAL, lenses);
+            object3d_->SetFisheyeLenses(lenses);
+        } else if (type == MDObject3D::CUBE) {
+            object3d_->SetCubeLayout(frame_state_.cube_layout, frame_state_.cube_padding);
+        } else if (type == MDObject3D::PLANE) {
+            object3d_->SetPlaneCurve(PlaneCurve(frame_state_));
+        }
+    }
+
+    // 弧形屏幕只在眼镜模式下使用，普通模式下平面铺在视口里
+    static float PlaneCurve(const RenderState& state) {
+        return state.vr_config.enabled ? state.plane_curve_degree : 0.0f;
+    }
+
+    // 视频画面的宽高比（NativeImage 缓冲区尺寸经过纹理坐标变换），还没有视频帧时按 16:9
+    float VideoRatio() {
+        int width = 0;
+        int height = 0;
+        if (video_source_ == nullptr || !video_source_->GetBufferSize(&width, &height)) {
+            return MDPlaneScale::DEFAULT_VIDEO_RATIO;
+        }
+        return MDPlaneScale::VideoRatio(width, height, st_matrix_);
+    }
+
+    // 普通模式下平面投影的 MVP：按缩放方式把单位平面缩放到视口里，深度放在0（不随触控和陀螺仪转动）
+    void CalculatePlaneMVPMatrix(float* result) {
+        const RenderState& state = frame_state_;
+        float viewport_width = static_cast<float>(state.viewport_set ? state.viewport_width : surface_width_);
+        float viewport_height = static_cast<float>(state.viewport_set ? state.viewport_height : surface_height_);
+        float viewport_ratio = viewport_width > 0.0f && viewport_height > 0.0f ? viewport_width / viewport_height
+                                                                               : 1920.0f / 1080.0f;
+        float scale_x = 1.0f;
+        float scale_y = 1.0f;
+        MDPlaneScale::Calculate(MDPlaneScale::Resolve(state.plane_scale_type, projection_mode_), VideoRatio(),
+                                viewport_ratio, &scale_x, &scale_y);
+        std::fill(result, result + 16, 0.0f);
+        result[0] = scale_x;
+        result[5] = scale_y;
+        result[15] = 1.0f;
+    }
+
+    // 绘制投影：当前模式开启了射线投射时画一个全屏三角形逐像素采样，否则绘制网格
+    // st_matrix 为这只眼睛的纹理坐标变换（EyeSTMatrix）
+    // distortion_params 只在VR模式传入，射线投射按它做和VR着色器相同的桶形畸变
+    // 双鱼眼网格换用混合两个镜头的程序（程序创建失败时用当前程序，只显示镜头0）；
+    // EAC 立方体换用做等角变换的程序（失败时按普通立方体贴图采样）
+    void DrawProjection(const float* mvp_matrix, const float* st_matrix, const float* distortion_params) {
+        int type = object3d_->GetProjectionType();
+        if (MDObject3D::IsDualFisheye(type)) {
+            dual_fisheye_program_.Use(mvp_matrix, st_matrix, texture_id_, distortion_params);
+            ray_cast_active_ = false;
+            DrawObject3D(mvp_matrix);
+            return;
+        }
+        if (type == MDObject3D::CUBE && frame_state_.cube_equi_angular) {
+            eac_program_.Use(mvp_matrix, st_matrix, texture_id_, object3d_->GetCubeLayout(),
+                             object3d_->GetCubePadding(), distortion_params);
+            ray_cast_active_ = false;
+            DrawObject3D(mvp_matrix);
+            return;
+        }
+        bool ray_cast = MDRayCaster::SupportsProjection(type) &&
+                        (ray_cast_modes_.load() & (1u << (type - MDObject3D::SPHERE))) != 0;
+        if (ray_cast && ray_caster_.Draw(type, mvp_matrix, st_matrix, texture_id_, distortion_params) == MD_OK) {
+            ray_cast_active_ = true;
+            ray_cast_draws_++;
+            return;
+        }
+        ray_cast_active_ = false;
+        DrawObject3D(mvp_matrix);
+    }
+
+    // 这只眼睛的纹理坐标变换：立体投影在视频的变换之前先取到自己的半边画面，其他投影直接用视频的变换
+    // 结果放在 eye_st_matrix_ 里，下一次调用前有效
+    const float* EyeSTMatrix(int eye_index) {
+        if (stereo_layout_ == MD_STEREO_LAYOUT_NONE) {
+            return st_matrix_;
+        }
+        MDStereoLayout::TransformSTMatrix(stereo_layout_, eye_index, st_matrix_, eye_st_matrix_);
+        return eye_st_matrix_;
+    }
+
+    // 绘制投影网格：开启视锥剔除时只提交这个 MVP 下可见的分块，并累计本帧和总的剔除统计
+    void DrawObject3D(const float* mvp_matrix) {
+        int draw_calls = 0;
+        int total = object3d_->GetTriangleCount();
+        int submitted = object3d_->Draw(frustum_culling_enabled_ ? mvp_matrix : nullptr, &draw_calls);
+        frame_mesh_triangles_ += total;
+        frame_submitted_triangles_ += submitted;
+        frame_draw_calls_ += draw_calls;
+        mesh_submitted_triangles_ += submitted;
+        mesh_culled_triangles_ += total - submitted;
+    }
+
+    bool CanReproject() {
+        return reprojection_enabled_ && frame_state_.vr_config.enabled &&
+               reprojector_.HasEyeFrames(resolution_scaler_.ScaledSize(surface_width_ / 2),
+                                         resolution_scaler_.ScaledSize(surface_height_));
+    }
+
+    // 上一帧超时，或者剩余预算不够一次完整渲染（按最近完整渲染的耗时估计）
+    bool IsLateForFullRender() {
+        return last_frame_missed_ || frame_scheduler_->GetRemainingBudgetNs() < full_render_cost_ns_;
+    }
+
     int RenderNormalMode() {
         if (program_ == 0) {
             MD_LOGE("MD360RendererPrivate::OnDrawFrame: program_ is 0!");
@@ -594,21 +1305,21 @@ private:
             }
         }
         
-        float mvp[16];
-        {
-            std::lock_guard<std::mutex> lock(mutex_);
-            if (use_touch_control_ && mvp_matrix_dirty_) {
-                // 使用触摸控制：根据 deltaX/deltaY 计算旋转矩阵并更新 MVP
-                UpdateMVPMatrixFromTouch();
-                mvp_matrix_dirty_ = false;
-                
-            }
-            std::copy(current_mvp_matrix_, current_mvp_matrix_ + 16, mvp);
-        }
+        // 使用触摸控制：根据 deltaX/deltaY 计算旋转矩阵
+        UpdateViewMatrixFromTouchIfNeeded(frame_state_);
         
-        glUniformMatrix4fv(u_mvp_matrix_loc_, 1, GL_FALSE, mvp);
+        // 平面投影不用场景的 MVP，直接缩放到视口里
+        float plane_mvp_matrix[16];
+        bool plane = object3d_ != nullptr && object3d_->GetProjectionType() == MDObject3D::PLANE;
+        if (plane) {
+            CalculatePlaneMVPMatrix(plane_mvp_matrix);
+        }
+        const float* mvp_matrix = plane ? plane_mvp_matrix : frame_state_.mvp_matrix;
+        glUniformMatrix4fv(u_mvp_matrix_loc_, 1, GL_FALSE, mvp_matrix);
         
-        glUniformMatrix4fv(u_st_matrix_loc_, 1, GL_FALSE, st_matrix_);
+        // 立体投影在非VR模式下只显示左眼
+        const float* st_matrix = EyeSTMatrix(0);
+        glUniformMatrix4fv(u_st_matrix_loc_, 1, GL_FALSE, st_matrix);
         
         // 每 60 帧记录一次渲染状态
         static int draw_frame_count = 0;
@@ -619,7 +1330,7 @@ private:
         }
         
         if (object3d_) {
-            object3d_->Draw();
+            DrawProjection(mvp_matrix, st_matrix, nullptr);
         } else {
             MD_LOGE("MD360RendererPrivate::OnDrawFrame: object3d_ is null!");
         }
@@ -646,26 +1357,57 @@ private:
         }
         
         // VR模式也处理触控更新
-        {
-            std::lock_guard<std::mutex> lock(mutex_);
-            if (use_touch_control_ && mvp_matrix_dirty_) {
-                UpdateMVPMatrixFromTouch();
-                mvp_matrix_dirty_ = false;
-                
-            }
+        UpdateViewMatrixFromTouchIfNeeded(frame_state_);
+        // 开启重投影时眼睛先渲染到离屏缓冲（按动态分辨率比例缩小），再按最新姿态合成上屏
+        if (!reprojection_enabled_ && reprojector_.IsCreated()) {
+            reprojector_.Destroy();
         }
+        eye_offscreen_ = reprojection_enabled_ &&
+                         reprojector_.EnsureEyeTargets(resolution_scaler_.ScaledSize(surface_width_ / 2),
+                                                       resolution_scaler_.ScaledSize(surface_height_)) == MD_OK;
+        render_scaled_ = eye_offscreen_ || scaled_target_;
+
         // 计算每个眼睛的视口
-        int eye_width = surface_width_ / 2;
-        int eye_height = surface_height_;
+        int eye_width = RenderSize(surface_width_ / 2);
+        int eye_height = RenderSize(surface_height_);
         
         // 渲染左右眼
         for (int eye_index = 0; eye_index < 2; eye_index++) {
+            MDFrameStage stage = eye_index == 0 ? MD_STAGE_RENDER_EYE_LEFT : MD_STAGE_RENDER_EYE_RIGHT;
+            MDScopedStageTimer timer(&frame_stats_, stage);
             RenderEye(eye_index, eye_width, eye_height);
         }
+
+        if (eye_offscreen_) {
+            ComposeEyes();
+        }
         
         return MD_OK;
     }
 
+    // 只重投影上一次渲染的眼睛画面，不重新绘制场景
+    int OnReprojectFrame() {
+        glDisable(GL_SCISSOR_TEST);
+        glClearColor(frame_state_.clear_color[0], frame_state_.clear_color[1],
+                     frame_state_.clear_color[2], frame_state_.clear_color[3]);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        ComposeEyes();
+        return MD_OK;
+    }
+
+    // 用上屏前最后一刻的姿态把两只眼睛的离屏画面合成到屏幕
+    void ComposeEyes() {
+        int eye_width = surface_width_ / 2;
+        int eye_height = surface_height_;
+        for (int eye_index = 0; eye_index < 2; eye_index++) {
+            EyeType eye = (eye_index == 0) ? LEFT_EYE : RIGHT_EYE;
+            LatchEyePose(eye_index);
+            float eye_mvp_matrix[16];
+            CalculateEyeMVPMatrix(eye, eye_pose_[eye_index], eye_mvp_matrix);
+            reprojector_.ComposeEye(eye_index, eye_mvp_matrix, eye_width * eye_index, 0, eye_width, eye_height);
+        }
+    }
+
     void RenderEye(int eye_index, int width, int height) {
         if (!vr_shaders_initialized_) {
             if (InitVRShaders() != MD_OK) return;
@@ -673,8 +1415,11 @@ private:
         
         glUseProgram(vr_program_);
         
-        // 设置视口
-        int viewport_x = (width * eye_index);
+        // 设置视口（离屏渲染时每只眼睛有自己的缓冲，从原点开始）
+        if (eye_offscreen_) {
+            reprojector_.BeginEye(eye_index);
+        }
+        int viewport_x = eye_offscreen_ ? 0 : (width * eye_index);
         int viewport_y = 0;
         glViewport(viewport_x, viewport_y, width, height);
         
@@ -685,37 +1430,42 @@ private:
         // 清空当前眼睛区域
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
         
-        // 计算MVP矩阵
+        // 计算MVP矩阵：紧挨着上传 uniform 之前取最新姿态（late latch）
         EyeType eye = (eye_index == 0) ? LEFT_EYE : RIGHT_EYE;
+        LatchEyePose(eye_index);
         float eye_mvp_matrix[16];
-        CalculateEyeMVPMatrix(eye, eye_mvp_matrix);
+        CalculateEyeMVPMatrix(eye, eye_pose_[eye_index], eye_mvp_matrix);
         
         // 传递矩阵到shader
         glUniformMatrix4fv(vr_mvp_matrix_loc_, 1, GL_FALSE, eye_mvp_matrix);
-        glUniformMatrix4fv(vr_st_matrix_loc_, 1, GL_FALSE, st_matrix_);
-        
-        // 设置桶形畸变参数
-        if (vr_config_.barrelDistortionEnabled) {
-            float distortion_params[4] = {vr_config_.k1, vr_config_.k2, 0.0f, 0.0f};
-            glUniform4f(vr_distortion_params_loc_, 
-                    distortion_params[0], distortion_params[1], 
-                    distortion_params[2], distortion_params[3]);
-        } else {
-            // 禁用桶形畸变
-            glUniform4f(vr_distortion_params_loc_, 1.0f, 0.0f, 0.0f, 0.0f);
+        const float* st_matrix = EyeSTMatrix(eye_index);
+        glUniformMatrix4fv(vr_st_matrix_loc_, 1, GL_FALSE, st_matrix);
+        
+        // 设置桶形畸变参数（禁用时为 1, 0：纹理坐标不变）
+        const VRModeConfig& vr_config = frame_state_.vr_config;
+        float distortion_params[4] = {1.0f, 0.0f, 0.0f, 0.0f};
+        if (vr_config.barrelDistortionEnabled) {
+            distortion_params[0] = vr_config.k1;
+            distortion_params[1] = vr_config.k2;
         }
+        glUniform4f(vr_distortion_params_loc_, 
+                distortion_params[0], distortion_params[1], 
+                distortion_params[2], distortion_params[3]);
         
         // 绑定纹理
         glActiveTexture(GL_TEXTURE0);
         glBindTexture(GL_TEXTURE_EXTERNAL_OES, texture_id_);
         glUniform1i(vr_texture_loc_, 0);
         
-        // 渲染
+        // 渲染（网格按这只眼睛的视锥剔除）
         if (object3d_) {
-            object3d_->Draw();
+            DrawProjection(eye_mvp_matrix, st_matrix, distortion_params);
         }
         
         glDisable(GL_SCISSOR_TEST);
+        if (eye_offscreen_) {
+            reprojector_.EndEye(eye_index, eye_mvp_matrix);
+        }
     }
 
     void CalculateEyeViewport(EyeType eye, int& x, int& y, int& width, int& height) {
@@ -745,11 +1495,8 @@ private:
     }
     void CalculateEyeMVPMatrixSimple(EyeType eye, float* resultMvp) {
         // 使用统一的MVP矩阵作为基础
-        std::lock_guard<std::mutex> lock(mutex_);
-        
-        // 复制当前的MVP矩阵
         float base_mvp[16];
-        std::copy(current_mvp_matrix_, current_mvp_matrix_ + 16, base_mvp);
+        std::copy(frame_state_.mvp_matrix, frame_state_.mvp_matrix + 16, base_mvp);
         
         // 计算眼睛的宽高比
         float eye_width = static_cast<float>(surface_width_) / 2.0f;
@@ -766,7 +1513,8 @@ private:
         MultiplyMatrix(resultMvp, vr_projection, mv_matrix);
         
         // 应用眼偏移（通过调整视图矩阵实现立体效果）
-        float eye_offset = (eye == LEFT_EYE) ? -vr_config_.ipd * 0.5f : vr_config_.ipd * 0.5f;
+        float ipd = frame_state_.vr_config.ipd;
+        float eye_offset = (eye == LEFT_EYE) ? -ipd * 0.5f : ipd * 0.5f;
         resultMvp[12] += eye_offset;
     }
     int InitVRShaders() {
@@ -779,55 +1527,13 @@ private:
             glDeleteProgram(vr_program_);
             vr_program_ = 0;
         }
-        // shader对象在之前的InitVRShaders中已经被删除了，所以不需要再删除
-        
-        // 加载顶点着色器
-        vr_vertex_shader_ = LoadShader(GL_VERTEX_SHADER, VR_VERTEX_SHADER);
-        if (vr_vertex_shader_ == 0) {
-            MD_LOGE("InitVRShaders: Failed to load vertex shader");
-            return MD_ERR_SHADER_COMPILE;
-        }
-        
-        // 加载片段着色器
-        vr_fragment_shader_ = LoadShader(GL_FRAGMENT_SHADER, VR_FRAGMENT_SHADER);
-        if (vr_fragment_shader_ == 0) {
-            MD_LOGE("InitVRShaders: Failed to load fragment shader");
-            glDeleteShader(vr_vertex_shader_);
-            vr_vertex_shader_ = 0;
-            return MD_ERR_SHADER_COMPILE;
-        }
-        
-        // 创建程序
-        vr_program_ = glCreateProgram();
-        glAttachShader(vr_program_, vr_vertex_shader_);
-        glAttachShader(vr_program_, vr_fragment_shader_);
-        
-        // 绑定属性
-        glBindAttribLocation(vr_program_, 0, "a_Position");
-        glBindAttribLocation(vr_program_, 1, "a_TexCoordinate");
-        
-        // 链接程序
-        glLinkProgram(vr_program_);
-        
-        GLint linked;
-        glGetProgramiv(vr_program_, GL_LINK_STATUS, &linked);
-        if (!linked) {
-            MD_LOGE("InitVRShaders: Program link failed");
-            GLint infoLen = 0;
-            glGetProgramiv(vr_program_, GL_INFO_LOG_LENGTH, &infoLen);
-            if (infoLen > 1) {
-                char* infoLog = new char[infoLen];
-                glGetProgramInfoLog(vr_program_, infoLen, nullptr, infoLog);
-                MD_LOGE("InitVRShaders: Link error: %s", infoLog);
-                delete[] infoLog;
-            }
-            glDeleteProgram(vr_program_);
-            glDeleteShader(vr_vertex_shader_);
-            glDeleteShader(vr_fragment_shader_);
-            vr_program_ = 0;
-            vr_vertex_shader_ = 0;
-            vr_fragment_shader_ = 0;
-            return MD_ERR_SHADER_LINK;
+        // 经过程序二进制缓存创建，第二次起（例如挂起后恢复）不需要重新编译链接
+        int error = MD_OK;
+        vr_program_ = MDProgramCache::GetInstance().CreateProgram(VR_VERTEX_SHADER, VR_FRAGMENT_SHADER,
+                                                                  {"a_Position", "a_TexCoordinate"}, &error);
+        if (vr_program_ == 0) {
+            MD_LOGE("InitVRShaders: Failed to create program, error=%d", error);
+            return error;
         }
         
         // 获取uniform位置
@@ -836,24 +1542,40 @@ private:
         vr_texture_loc_ = glGetUniformLocation(vr_program_, "u_Texture");
         vr_distortion_params_loc_ = glGetUniformLocation(vr_program_, "u_DistortionParams");
         
-        // 清理着色器对象
-        glDeleteShader(vr_vertex_shader_);
-        glDeleteShader(vr_fragment_shader_);
-        
         vr_shaders_initialized_ = true;
         return MD_OK;
     }
 
-    void CalculateEyeMVPMatrix(EyeType eye, float* resultMvp) {
-        std::lock_guard<std::mutex> lock(mutex_);
-        
+    // 从姿态信箱取最新姿态，记录本眼实际使用的姿态及其采样到使用的延迟
+    // 开启预测时按角速度外推到预计上屏时间：下一个vsync + 管线延迟（默认一个帧周期，即合成器晚一帧上屏）
+    void LatchEyePose(int eye_index) {
+        MDPose pose = pose_mailbox_.Latch();
+        if (pose.sequence != 0) {
+            frame_stats_.Record(MD_STAGE_POSE_AGE, MDNowNs() - pose.timestamp_ns);
+            if (pose_prediction_enabled_) {
+                int64_t latency_ns = prediction_latency_ns_.load();
+                if (latency_ns < 0) {
+                    latency_ns = frame_scheduler_->GetFramePeriodNs();
+                }
+                int64_t target_ns = frame_scheduler_->GetNextVsyncNs() + latency_ns;
+                int64_t horizon_ns = MDPosePredictor::Predict(pose, target_ns, MD_MAX_PREDICTION_HORIZON_NS,
+                                                              pose.matrix);
+                frame_stats_.Record(MD_STAGE_PREDICTION_HORIZON, horizon_ns);
+            }
+        }
+        eye_pose_[eye_index] = pose;
+    }
+
+    void CalculateEyeMVPMatrix(EyeType eye, const MDPose& pose, float* resultMvp) {
+        const RenderState& state = frame_state_;
+
         // 对于VR模式，使用透视投影矩阵
         float eye_width = static_cast<float>(surface_width_) / 2.0f;
         float eye_height = static_cast<float>(surface_height_);
         float eye_aspect_ratio = eye_width / eye_height;
         
         // 使用适当的视野角度
-        const float fovY = 120.0f; // 垂直视野120度
+        const float fovY = MD_VR_EYE_FOV_Y;
         const float nearPlane = 0.1f;
         const float farPlane = 100.0f;
         
@@ -884,29 +1606,45 @@ private:
         
         // 组合视图矩阵：传感器矩阵 × 触控旋转矩阵
         float combined_view[16];
-        if (sensor_matrix_updated_) {
+        if (pose.sequence != 0) {
             // 如果有传感器数据，使用传感器矩阵 × 触控视图矩阵
-            MultiplyMatrix(combined_view, sensor_matrix_, view_matrix_);
+            MultiplyMatrix(combined_view, pose.matrix, view_matrix_);
         } else {
             // 否则只使用触控视图矩阵
             std::copy(view_matrix_, view_matrix_ + 16, combined_view);
         }
         
         // 应用眼偏移（实现立体效果）
-        float eye_offset = (eye == LEFT_EYE) ? -vr_config_.ipd * 0.5f : vr_config_.ipd * 0.5f;
+        float eye_offset = (eye == LEFT_EYE) ? -state.vr_config.ipd * 0.5f : state.vr_config.ipd * 0.5f;
         combined_view[12] += eye_offset;
         
-        // 模型矩阵
+        // 模型矩阵：立体投影按这只眼睛的偏转绕 Y 轴旋转球面（正值画面向左移），重投影合成时同样经过这里
         float model_matrix[16] = {
             1.0f, 0.0f, 0.0f, 0.0f,
             0.0f, 1.0f, 0.0f, 0.0f,
             0.0f, 0.0f, 1.0f, 0.0f,
             0.0f, 0.0f, 0.0f, 1.0f
         };
+        float yaw = stereo_layout_ != MD_STEREO_LAYOUT_NONE ? state.stereo_eye_yaw[eye == LEFT_EYE ? 0 : 1] : 0.0f;
+        if (yaw != 0.0f) {
+            float radians = yaw * static_cast<float>(M_PI) / 180.0f;
+            model_matrix[0] = cosf(radians);
+            model_matrix[2] = -sinf(radians);
+            model_matrix[8] = sinf(radians);
+            model_matrix[10] = cosf(radians);
+        }
+        // 平面投影：单位平面（或弧形屏幕）按视频宽高比缩放成观看者前方的屏幕
+        if (object3d_ != nullptr && object3d_->GetProjectionType() == MDObject3D::PLANE) {
+            float scale[3];
+            MDPlaneScale::ScreenScale(VideoRatio(), object3d_->GetPlaneCurve(), scale);
+            model_matrix[0] = scale[0];
+            model_matrix[5] = scale[1];
+            model_matrix[10] = scale[2];
+        }
         
-        // 计算MVP矩阵：Projection × View × Model
+        // 计算MVP矩阵：Projection × View × Model（MultiplyMatrix 按行主序相乘，列主序下参数顺序相反）
         float mv_matrix[16];
-        MultiplyMatrix(mv_matrix, combined_view, model_matrix);
+        MultiplyMatrix(mv_matrix, model_matrix, combined_view);
         MultiplyMatrix(resultMvp, mv_matrix, eye_projection);
     }
 
@@ -916,59 +1654,21 @@ private:
         return MD_OK;
     }
 
-    GLuint LoadShader(GLenum type, const char* shaderSrc) {
-        GLuint shader = glCreateShader(type);
-        glShaderSource(shader, 1, &shaderSrc, nullptr);
-        glCompileShader(shader);
-        GLint compiled;
-        glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
-        if (!compiled) {
-            GLint infoLen = 0;
-            glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &infoLen);
-            if (infoLen > 1) {
-                char* infoLog = new char[infoLen];
-                glGetShaderInfoLog(shader, infoLen, nullptr, infoLog);
-                MD_LOGE("Error compiling shader: %s", infoLog);
-                delete[] infoLog;
-            }
-            glDeleteShader(shader);
-            return 0;
-        }
-        return shader;
-    }
-
     void InitShaders() {
-        GLuint vertexShader = LoadShader(GL_VERTEX_SHADER, VERTEX_SHADER);
-        GLuint fragmentShader = LoadShader(GL_FRAGMENT_SHADER, FRAGMENT_SHADER);
-        
-        program_ = glCreateProgram();
-        glAttachShader(program_, vertexShader);
-        glAttachShader(program_, fragmentShader);
-        
-        // Bind attributes before linking
-        glBindAttribLocation(program_, 0, "a_Position");
-        glBindAttribLocation(program_, 1, "a_TexCoordinate");
-        
-        glLinkProgram(program_);
-        
-        GLint linked;
-        glGetProgramiv(program_, GL_LINK_STATUS, &linked);
-        if (!linked) {
+        program_ = MDProgramCache::GetInstance().CreateProgram(VERTEX_SHADER, FRAGMENT_SHADER,
+                                                               {"a_Position", "a_TexCoordinate"});
+        if (program_ == 0) {
             MD_LOGE("Error linking program");
-            glDeleteProgram(program_);
-            program_ = 0;
             return;
         }
         
         u_mvp_matrix_loc_ = glGetUniformLocation(program_, "u_MVPMatrix");
         u_texture_loc_ = glGetUniformLocation(program_, "u_Texture");
         u_st_matrix_loc_ = glGetUniformLocation(program_, "u_STMatrix");
-        
-        glDeleteShader(vertexShader);
-        glDeleteShader(fragmentShader);
     }
 
-    int RunGL() {
+    // 在宿主GL线程中初始化本渲染器的GL资源（共享宿主的上下文，窗口是自己的）
+    virtual int OnHostInitGL() override {
         if (is_destroyed_) {
             return MD_OK;
         }
@@ -981,10 +1681,6 @@ private:
             MD_LOGE("egl_->MakeCurrent failed");
         }
 
-        if (surface_size_dirty_) {
-            UpdateSurfaceSizeInGLThread();
-        }
-
         // Init GL resources
         InitShaders();
         
@@ -995,110 +1691,291 @@ private:
         
         // 始终使用球面投影（对于360度视频）
         object3d_->SetProjectionType(MDObject3D::SPHERE);
-        MD_LOGI("MD360RendererPrivate::RunGL: Using SPHERE projection for 360 video");
+        MD_LOGI("MD360RendererPrivate::OnHostInitGL: Using SPHERE projection for 360 video");
         
         // 初始化渲染状态（默认启用）
         {
-            std::lock_guard<std::mutex> lock(mutex_);
-            MD_LOGI("MD360RendererPrivate::RunGL initializing render states");
+            MD_LOGI("MD360RendererPrivate::OnHostInitGL initializing render states");
             
             // 对于360度视频，需要从球体内部看，所以禁用面剔除或设置正确的正面
             glDisable(GL_CULL_FACE);
             glEnable(GL_DEPTH_TEST);
             glDepthFunc(GL_LEQUAL);
             
-            cull_face_enabled_ = false;  // 禁用面剔除
-            depth_test_enabled_ = true;  // 启用深度测试
+            state_.Update([](RenderState& state) {
+                state.cull_face_enabled = false;  // 禁用面剔除
+                state.depth_test_enabled = true;  // 启用深度测试
+            });
         }
         
-        glGenTextures(1, &texture_id_);
-        MD_LOGI("MD360RendererPrivate::RunGL: Generated texture_id=%u", texture_id_);
-        
-        // 绑定纹理并设置纹理参数（必须在创建 NativeImage 之前）
-        glBindTexture(GL_TEXTURE_EXTERNAL_OES, texture_id_);
-        glTexParameteri(GL_TEXTURE_EXTERNAL_OES, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_EXTERNAL_OES, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_EXTERNAL_OES, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_EXTERNAL_OES, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-        MD_LOGI("MD360RendererPrivate::RunGL: Set texture parameters for texture_id=%u", texture_id_);
-        
-        // 创建NativeImage
-        std::shared_ptr<MDNativeImageRef> native_image_ref = std::make_shared<MDNativeImageRef>(texture_id_);
-        if (!native_image_ref->IsValid()) {
-            MD_LOGE("MD360RendererPrivate::RunGL: Failed to create valid MDNativeImageRef!");
-        }
-        surface_id_ = native_image_ref->GetSurfaceId();
-        MD_LOGI("MD360RendererPrivate::RunGL: Created NativeImage, surface_id=%llu", surface_id_);
+        // 视频纹理和 NativeImage 由视频源管理，共享视频源的渲染器复用同一个纹理
+        video_source_->AcquireGL();
+        texture_id_ = video_source_->GetTextureId();
+        surface_id_ = video_source_->GetSurfaceId();
         OnSurfaceIdChanged(surface_id_);
-        
-        // 解绑纹理
-        glBindTexture(GL_TEXTURE_EXTERNAL_OES, 0);
-        
-        // 渲染循环
-        while (!is_destroyed_) {
-            ret = egl_->Prepare();
-            if (ret != MD_OK) {
-                MD_LOGE("egl_->Prepare failed");
-                break;
+
+        // 新视频帧到达时唤醒渲染线程（按需渲染模式）
+        std::weak_ptr<MD360RendererPrivate> weak_this = this->shared_from_this();
+        frame_listener_ok_ = video_source_->AddFrameListener(this, [weak_this]() {
+            auto shared_this = weak_this.lock();
+            if (shared_this != nullptr) {
+                shared_this->RequestRender();
             }
-            
+        });
+        gl_ready_ = true;
+        return MD_OK;
+    }
+
+    // 宿主每个vsync调用一次：切到自己的窗口绘制并交换（截止时间为宿主帧调度器的下一个vsync）
+    virtual void OnHostFrame(int64_t idle_ns) override {
+        if (is_destroyed_ || !gl_ready_) {
+            return;
+        }
+        // 宿主休眠期间错过的vsync都算作跳过的帧
+        int64_t period = frame_scheduler_->GetFramePeriodNs();
+        if (idle_ns > 0 && period > 0) {
+            skipped_frame_count_ += idle_ns / period;
+        }
+        // 其他渲染器需要绘制而本渲染器没有变化时直接跳过
+        if (!NeedsFrame()) {
             if (!is_paused_) {
-                egl_->MakeCurrent(true);
+                skipped_frame_count_++;
+            }
+            return;
+        }
+        render_requested_ = false;
+        int ret = MD_OK;
+        int64_t frame_start_ns = MDNowNs();
+        {
+            MDScopedStageTimer timer(&frame_stats_, MD_STAGE_EGL_PREPARE);
+            ret = egl_->Prepare();
+        }
+        if (ret != MD_OK) {
+            MD_LOGE("egl_->Prepare failed");
+            return;
+        }
 
-                // 在渲染循环中检查是否需要更新surface尺寸
-                if (surface_size_dirty_) {
-                    UpdateSurfaceSizeInGLThread();
-                }
+        {
+            MDScopedStageTimer timer(&frame_stats_, MD_STAGE_MAKE_CURRENT);
+            egl_->MakeCurrent(true);
+        }
 
-                // 更新Surface
-                int update_result = native_image_ref->UpdateSurface(st_matrix_);
-                
-                // 检查视频连接状态
-                static int consecutive_success_count = 0;
-                static int consecutive_fail_count = 0;
-                
-                if (update_result == MD_OK) {
-                    consecutive_success_count++;
-                    consecutive_fail_count = 0;
-                    
-                    if (consecutive_success_count >= 3) {
-                        if (!video_connected_) {
-                            MD_LOGI("MD360RendererPrivate: Video surface connected!");
-                        }
-                        video_connected_ = true;
-                    }
-                } else {
-                    consecutive_fail_count++;
-                    consecutive_success_count = 0;
-                    
-                    if (consecutive_fail_count >= 3) {
-                        if (video_connected_) {
-                            MD_LOGW("MD360RendererPrivate: Video surface disconnected");
-                        }
-                        video_connected_ = false;
-                    }
+        // 每帧执行一次其他线程提交的GL命令（surface变化、投影模式切换等）
+        bool commands_executed = command_queue_.Drain([this](const MDGLCommand& command) {
+            return ExecuteGLCommand(command);
+        }) > 0;
+        if (is_paused_) {
+            return;
+        }
+        if (gpu_released_) {
+            RestoreGpuResources();
+        }
+        // 刚恢复：强制完整渲染一帧，交换完成时记录恢复到首帧的耗时
+        int64_t resume_ns = resume_request_ns_.exchange(0);
+        if (resume_ns > 0) {
+            resume_start_ns_ = resume_ns;
+            has_drawn_state_ = false;
+        }
+
+        // 每帧只取一次渲染状态快照，不会被设置接口阻塞
+        frame_state_ = state_.Read();
+        UpdateMeshLod();
+        UpdateProjectionParams();
+        // 网格在工作线程中生成：就绪后换上并完整渲染一帧，生成期间保持唤醒（按需模式下宿主可能休眠）
+        if (object3d_ != nullptr) {
+            if (object3d_->PollPendingMesh()) {
+                has_drawn_state_ = false;
+            }
+            if (object3d_->IsLoading()) {
+                render_requested_ = true;
+            }
+        }
+
+        // 没有头部跟踪时按片源帧率的节奏取帧（例如60Hz屏上的24fps按3:2交替保持），
+        // 不在节拍上的vsync不取新帧，画面和状态也没变时不重绘
+        bool cadence_active = IsVideoCadenceActive();
+        video_cadence_active_ = cadence_active;
+        bool video_tick = !cadence_active ||
+                          video_cadence_.Tick(frame_scheduler_->GetNextVsyncNs(), frame_scheduler_->GetFramePeriodNs(),
+                                              video_source_->GetFramePeriodNs());
+        bool has_new_video_frame = false;
+        if (!video_tick) {
+            held_vsync_count_++;
+            // 按需模式下宿主可能休眠，保持唤醒直到下一个节拍把新帧取出来
+            render_requested_ = true;
+        } else {
+            UpdateVideoFrame();
+            uint64_t video_generation = video_source_->GetFrameGeneration();
+            has_new_video_frame = video_generation != seen_video_generation_;
+            seen_video_generation_ = video_generation;
+        }
+        
+        // 按需渲染：没有新帧、姿态和状态都没变时跳过绘制和交换
+        FrameAction action = DecideFrameAction(has_new_video_frame || commands_executed, cadence_active);
+        if (action == FRAME_ACTION_SKIP) {
+            skipped_frame_count_++;
+            return;
+        }
+
+        // 每60帧记录一次状态
+        frame_count_++;
+        if (frame_count_ % 60 == 0) {
+            MD_LOGI("MD360RendererPrivate: Frame %d, video_connected_=%s", 
+                    frame_count_, video_connected_ ? "true" : "false");
+        }
+        
+        int64_t draw_start_ns = MDNowNs();
+        if (action == FRAME_ACTION_REPROJECT) {
+            MDScopedStageTimer timer(&frame_stats_, MD_STAGE_REPROJECT);
+            OnReprojectFrame();
+            reprojected_frame_count_++;
+        } else {
+            MDScopedStageTimer timer(&frame_stats_, MD_STAGE_DRAW_FRAME);
+            resolution_scaler_.BeginGpuTiming();
+            OnDrawFrame();
+            resolution_scaler_.EndGpuTiming();
+            // 完整渲染耗时的滑动平均，用来判断下一帧是否来得及完整渲染
+            full_render_cost_ns_ += (MDNowNs() - draw_start_ns - full_render_cost_ns_) / 8;
+            rendered_frame_count_++;
+        }
+        {
+            MDScopedStageTimer timer(&frame_stats_, MD_STAGE_SWAP_BUFFER);
+            egl_->SwapBuffer();
+        }
+        // 按本帧的GPU耗时（不支持 timer query 时用渲染+交换的耗时）调整下一帧的渲染比例
+        if (action == FRAME_ACTION_RENDER) {
+            int64_t gpu_ns = resolution_scaler_.Update(frame_scheduler_->GetFramePeriodNs(), MDNowNs() - draw_start_ns);
+            if (gpu_ns >= 0) {
+                frame_stats_.Record(MD_STAGE_GPU_FRAME, gpu_ns);
+            }
+        }
+        // 同一个vsync里排在前面的渲染器也会占用预算，按本渲染器交换完成时是否超过截止时间判断
+        last_frame_missed_ = frame_scheduler_->GetRemainingBudgetNs() < 0;
+        if (resume_start_ns_ > 0) {
+            int64_t resume_cost_ns = MDNowNs() - resume_start_ns_;
+            resume_start_ns_ = 0;
+            last_resume_to_first_frame_ns_ = resume_cost_ns;
+            frame_stats_.Record(MD_STAGE_RESUME_FIRST_FRAME, resume_cost_ns);
+            MD_LOGI("MD360RendererPrivate: first frame after resume in %.3fms", resume_cost_ns / 1000000.0);
+        }
+        frame_stats_.Record(MD_STAGE_FRAME_TOTAL, MDNowNs() - frame_start_ns);
+    }
+
+    // 取新的视频帧（共享视频源时同一个宿主帧只有第一个渲染器真正 UpdateSurface），并更新视频连接状态
+    void UpdateVideoFrame() {
+        int update_result = MD_OK;
+        {
+            MDScopedStageTimer timer(&frame_stats_, MD_STAGE_UPDATE_SURFACE);
+            update_result = video_source_->Update(host_->GetFrameSerial(), st_matrix_);
+        }
+        
+        // 检查视频连接状态
+        if (update_result == MD_OK) {
+            consecutive_success_count_++;
+            consecutive_fail_count_ = 0;
+            
+            if (consecutive_success_count_ >= 3) {
+                if (!video_connected_) {
+                    MD_LOGI("MD360RendererPrivate: Video surface connected!");
                 }
-                
-                // 每60帧记录一次状态
-                static int frame_count = 0;
-                frame_count++;
-                if (frame_count % 60 == 0) {
-                    MD_LOGI("MD360RendererPrivate: Frame %d, video_connected_=%s", 
-                            frame_count, video_connected_ ? "true" : "false");
+                video_connected_ = true;
+            }
+        } else {
+            consecutive_fail_count_++;
+            consecutive_success_count_ = 0;
+            
+            if (consecutive_fail_count_ >= 3) {
+                if (video_connected_) {
+                    MD_LOGW("MD360RendererPrivate: Video surface disconnected");
                 }
-                
-                OnDrawFrame();
-                egl_->SwapBuffer();
-                egl_->MakeCurrent(false);
+                video_connected_ = false;
             }
-            usleep(17 * 1000); // 约60fps
         }
+    }
+
+    // 按片源节奏出图的条件：开启了该功能、已估计出片源帧率，且没有头部跟踪
+    // （VR模式或最近还在收到传感器姿态时按屏幕刷新率渲染，保证头动跟手）
+    bool IsVideoCadenceActive() {
+        if (!video_cadence_enabled_ || frame_state_.vr_config.enabled || video_source_->GetFramePeriodNs() <= 0) {
+            return false;
+        }
+        MDPose pose = pose_mailbox_.Latch();
+        return pose.sequence == 0 || MDNowNs() - pose.timestamp_ns > MD_HEAD_TRACKING_IDLE_NS;
+    }
+
+    // 挂起时在GL线程释放大块GPU资源：顶点缓冲（网格数据仍在网格缓存里）、着色器程序和离屏缓冲
+    // 视频纹理和 NativeImage 不释放，解码器拿到的 surface 保持有效
+    void ReleaseGpuResources() {
+        if (gpu_released_) {
+            return;
+        }
+        if (object3d_) {
+            object3d_->Destroy();
+        }
+        // 同一上下文的其他渲染器还在用的网格缓冲会保留
+        MDMeshCache::GetInstance().ReleaseUnusedBuffers();
+        if (program_ != 0) {
+            glDeleteProgram(program_);
+            program_ = 0;
+        }
+        ResetVRResources();
+        reprojector_.Destroy();
+        ray_caster_.Destroy();
+        dual_fisheye_program_.Destroy();
+        eac_program_.Destroy();
+        resolution_scaler_.Destroy();
+        gpu_released_ = true;
+        MD_LOGI("MD360RendererPrivate::ReleaseGpuResources: released");
+    }
+
+    // 恢复后第一帧前重建：程序从二进制缓存加载，网格直接上传内存中的数据；VR程序和离屏缓冲用到时再创建
+    void RestoreGpuResources() {
+        int64_t start_ns = MDNowNs();
+        InitShaders();
+        if (object3d_) {
+            object3d_->UploadData();
+        }
+        gpu_released_ = false;
+        last_rebuild_ns_ = MDNowNs() - start_ns;
+        MD_LOGI("MD360RendererPrivate::RestoreGpuResources: rebuilt in %.3fms", last_rebuild_ns_.load() / 1000000.0);
+    }
+
+    int ExecuteGLCommand(const MDGLCommand& command) {
+        switch (command.type) {
+            case MD_GL_CMD_SURFACE_CHANGED:
+                UpdateSurfaceSizeInGLThread();
+                return MD_OK;
+            case MD_GL_CMD_SET_PROJECTION_MODE:
+                ApplyProjectionMode(command.arg);
+                return MD_OK;
+            case MD_GL_CMD_RESET_VR_RESOURCES:
+                ResetVRResources();
+                return MD_OK;
+            case MD_GL_CMD_RELEASE_GPU_RESOURCES:
+                ReleaseGpuResources();
+                return MD_OK;
+            case MD_GL_CMD_FLUSH:
+                return MD_OK;
+            default:
+                MD_LOGW("MD360RendererPrivate::ExecuteGLCommand: unknown command %d", command.type);
+                return MD_ERR_CMD_UNKNOWN;
+        }
+    }
+
+    // 离开宿主前在GL线程中释放本渲染器的GL资源和窗口
+    virtual void OnHostReleaseGL() override {
+        egl_->MakeCurrent(true);
+        gl_ready_ = false;
+        // 先停掉新帧回调，最后一个使用者在GL线程中销毁NativeImage和视频纹理
+        video_source_->RemoveFrameListener(this);
+        frame_listener_ok_ = false;
         
         // 清理资源
         if (object3d_) {
             object3d_->Destroy();
             object3d_ = nullptr;
         }
+        MDMeshCache::GetInstance().ReleaseUnusedBuffers();
         if (program_ != 0) {
             glDeleteProgram(program_);
             program_ = 0;
@@ -1108,27 +1985,109 @@ private:
             glDeleteProgram(vr_program_);
             vr_program_ = 0;
         }
+        reprojector_.Destroy();
+        ray_caster_.Destroy();
+        dual_fisheye_program_.Destroy();
+        eac_program_.Destroy();
+        resolution_scaler_.Destroy();
         // 清理纹理（必须在EGL context有效时删除）
-        if (texture_id_ != 0) {
-            glDeleteTextures(1, &texture_id_);
-            texture_id_ = 0;
-        }
+        video_source_->ReleaseGL();
+        texture_id_ = 0;
         
         OnSurfaceIdChanged(0);
         egl_->Terminate();
-        return MD_OK;
     }
 
 private:
     bool is_init_ = false;
-    bool is_destroyed_ = false;
-    bool is_paused_ = false;
+    std::atomic<bool> is_destroyed_{false};
+    std::atomic<bool> is_paused_{false};
+    // 挂起/恢复相关：resume_request_ns_ 由 Resume 写入，GL线程取走后记到 resume_start_ns_（只在GL线程访问）
+    std::atomic<uint64_t> suspend_count_{0};
+    std::atomic<bool> gpu_released_{false};
+    std::atomic<int64_t> resume_request_ns_{0};
+    std::atomic<int64_t> last_rebuild_ns_{0};
+    std::atomic<int64_t> last_resume_to_first_frame_ns_{0};
+    int64_t resume_start_ns_ = 0;
     uint64_t surface_id_ = 0;
     int surface_width_ = 0;
     int surface_height_ = 0; 
     GLuint texture_id_ = 0;
-    std::thread thread_;
     std::shared_ptr<MDEgl> egl_ = MDEgl::CreateEgl();
+    // 渲染宿主：提供GL线程、共享的EGL上下文和帧调度器
+    std::shared_ptr<MDRenderHost> host_;
+    std::shared_ptr<MDFrameClock> frame_clock_;
+    std::shared_ptr<MDFrameScheduler> frame_scheduler_;
+    // 视频源（外部纹理 + NativeImage），可与其他渲染器共享
+    std::shared_ptr<MDVideoSource> video_source_ = std::make_shared<MDVideoSource>();
+    std::shared_ptr<MD360RendererPrivate> video_share_from_;
+    uint64_t seen_video_generation_ = 0;
+    bool gl_ready_ = false;
+    int consecutive_success_count_ = 0;
+    int consecutive_fail_count_ = 0;
+    int frame_count_ = 0;
+    // 分阶段耗时统计（GL线程记录，任意线程读取）
+    MDFrameStats frame_stats_;
+
+    // 按需渲染相关
+    std::atomic<int> render_mode_{MD_RENDER_MODE_CONTINUOUSLY};
+    std::atomic<uint64_t> skipped_frame_count_{0};
+    std::atomic<bool> render_requested_{true};
+    std::atomic<bool> frame_listener_ok_{false};
+    RenderStateSnapshot last_drawn_state_;
+    uint64_t last_drawn_pose_sequence_ = 0;
+    bool has_drawn_state_ = false;
+
+    // 重投影相关（除开关和计数外只在GL线程中访问）
+    std::atomic<bool> reprojection_enabled_{false};
+    std::atomic<uint64_t> rendered_frame_count_{0};
+    std::atomic<uint64_t> reprojected_frame_count_{0};
+    MDReprojector reprojector_;
+    bool eye_offscreen_ = false;
+
+    // 视频出图节奏（只在GL线程访问，开关和统计除外）
+    MDPresentCadence video_cadence_;
+    std::atomic<bool> video_cadence_enabled_{true};
+    std::atomic<bool> video_cadence_active_{false};
+    std::atomic<uint64_t> held_vsync_count_{0};
+
+    // 动态分辨率：scaled_target_ 表示本帧渲染到缩小的离屏缓冲，render_scaled_ 表示视口需要按比例换算
+    MDResolutionScaler resolution_scaler_;
+    bool scaled_target_ = false;
+    bool render_scaled_ = false;
+    bool pending_content_ = false;
+    bool last_frame_missed_ = false;
+    int64_t full_render_cost_ns_ = 0;
+
+    // 网格细分级别：覆盖值由接口写入，当前级别和三角形数由GL线程写入供统计读取
+    std::atomic<int> mesh_lod_override_{MD_MESH_LOD_AUTO};
+    std::atomic<int> mesh_lod_level_{MD_MESH_LOD_HIGH};
+    std::atomic<int> mesh_triangles_{0};
+    std::atomic<uint64_t> mesh_lod_switch_count_{0};
+
+    // 视锥剔除：frame_* 只在GL线程中按帧累计，结束时写入供统计读取的原子量
+    std::atomic<bool> frustum_culling_enabled_{true};
+    std::atomic<double> mesh_culled_ratio_{0.0};
+    std::atomic<int> mesh_draw_calls_{0};
+    std::atomic<uint64_t> mesh_submitted_triangles_{0};
+    std::atomic<uint64_t> mesh_culled_triangles_{0};
+    int64_t frame_mesh_triangles_ = 0;
+    int64_t frame_submitted_triangles_ = 0;
+    int frame_draw_calls_ = 0;
+
+    // 射线投射：开关按投影模式的位掩码，程序和三角形缓冲只在GL线程访问
+    std::atomic<uint32_t> ray_cast_modes_{0};
+    std::atomic<bool> ray_cast_active_{false};
+    std::atomic<uint64_t> ray_cast_draws_{0};
+    MDRayCaster ray_caster_;
+    // 双鱼眼混合程序和 EAC 立方体程序，只在GL线程访问
+    MDDualFisheyeProgram dual_fisheye_program_;
+    MDEacProgram eac_program_;
+    // 当前投影的立体排列（MDStereoLayoutType）和每只眼睛的纹理坐标变换，只在GL线程访问
+    int stereo_layout_ = MD_STEREO_LAYOUT_NONE;
+    // 当前的投影模式（平面投影按它决定默认的缩放方式），只在GL线程访问
+    int projection_mode_ = 0;
+    float eye_st_matrix_[16];
     
     std::shared_ptr<MDObject3D> object3d_;
     GLuint program_ = 0;
@@ -1144,25 +2103,29 @@ private:
         0.0f, 0.0f, 0.0f, 1.0f
     };
     
-    std::mutex mutex_;
-    // 初始化 MVP 矩阵为单位矩阵
-    // 注意：如果 MVP 矩阵是单位矩阵，球体可能不可见
-    // 这里设置一个简单的投影矩阵，确保球体可见
-    // 球体半径是 18.0，我们需要一个合适的投影矩阵
-    float current_mvp_matrix_[16] = {
-        1,0,0,0, 
-        0,1,0,0, 
-        0,0,1,0, 
-        0,0,0,1
-    };
+    // 可变渲染状态：设置接口写入并发布，GL线程每帧 Read 一次得到 frame_state_
+    // 注意：MVP 矩阵初始为单位矩阵时球体可能不可见，OnHostInitGL 中会设置默认投影矩阵
+    MDTripleBuffer<RenderState> state_;
+    RenderState frame_state_;
+    std::atomic<bool> vr_enabled_{false};
+
+    // 头部姿态信箱；eye_pose_ 是每只眼睛本帧实际使用的姿态（只在GL线程中访问）
+    MDPoseMailbox pose_mailbox_;
+    MDPose eye_pose_[2];
+    std::atomic<bool> pose_prediction_enabled_{true};
+    std::atomic<int64_t> prediction_latency_ns_{-1};  // 小于0表示使用一个帧周期
+
+    // 其他线程提交、GL线程每帧执行一次的命令
+    MDGLCommandQueue command_queue_;
+
+    // 以下只在GL线程中访问：记录已经应用的触摸累积值
+    float applied_touch_delta_x_ = 0.0f;
+    float applied_touch_delta_y_ = 0.0f;
+    bool view_matrix_dirty_ = false;
 
     // VR模式相关成员变量
-    VRModeConfig vr_config_;
     bool vr_shaders_initialized_ = false;
-    bool pending_vr_cleanup_ = false;  // 标记是否需要清理VR资源
     GLuint vr_program_ = 0;
-    GLuint vr_vertex_shader_ = 0;
-    GLuint vr_fragment_shader_ = 0;
     GLint vr_mvp_matrix_loc_ = -1;
     GLint vr_st_matrix_loc_ = -1;
     GLint vr_texture_loc_ = -1;
@@ -1196,38 +2159,38 @@ private:
         const float tb = 1.0f / (top - bottom);
         const float fn = 1.0f / (far - near);
         
-        current_mvp_matrix_[0] = 2.0f * near * rl;
-        current_mvp_matrix_[1] = 0.0f;
-        current_mvp_matrix_[2] = 0.0f;
-        current_mvp_matrix_[3] = 0.0f;
+        float matrix[16];
+        matrix[0] = 2.0f * near * rl;
+        matrix[1] = 0.0f;
+        matrix[2] = 0.0f;
+        matrix[3] = 0.0f;
         
-        current_mvp_matrix_[4] = 0.0f;
-        current_mvp_matrix_[5] = 2.0f * near * tb;
-        current_mvp_matrix_[6] = 0.0f;
-        current_mvp_matrix_[7] = 0.0f;
+        matrix[4] = 0.0f;
+        matrix[5] = 2.0f * near * tb;
+        matrix[6] = 0.0f;
+        matrix[7] = 0.0f;
         
-        current_mvp_matrix_[8] = (right + left) * rl;
-        current_mvp_matrix_[9] = (top + bottom) * tb;
-        current_mvp_matrix_[10] = -(far + near) * fn;
-        current_mvp_matrix_[11] = -1.0f;
+        matrix[8] = (right + left) * rl;
+        matrix[9] = (top + bottom) * tb;
+        matrix[10] = -(far + near) * fn;
+        matrix[11] = -1.0f;
         
-        current_mvp_matrix_[12] = 0.0f;
-        current_mvp_matrix_[13] = 0.0f;
-        current_mvp_matrix_[14] = -2.0f * far * near * fn;
-        current_mvp_matrix_[15] = 0.0f;
+        matrix[12] = 0.0f;
+        matrix[13] = 0.0f;
+        matrix[14] = -2.0f * far * near * fn;
+        matrix[15] = 0.0f;
         
         // 初始化时也设置使用触摸控制
-        use_touch_control_ = true;
-        mvp_matrix_dirty_ = true;
+        state_.Update([&](RenderState& state) {
+            std::copy(matrix, matrix + 16, state.mvp_matrix);
+            state.use_touch_control = true;
+        });
+        view_matrix_dirty_ = true;
         MD_LOGI("MD360RendererPrivate: Initialized default projection matrix");
     }
 
     // 在GL线程中更新surface尺寸
     void UpdateSurfaceSizeInGLThread() {
-        if (!surface_size_dirty_) {
-            return;
-        }
-        
         if (egl_->IsEglValid()) {
             // 获取当前surface的宽度和高度
             EGLint width = 0;
@@ -1246,12 +2209,9 @@ private:
                     UpdateProjectionMatrixForCurrentSurface();
                     
                     // 重置视口标志，确保使用新尺寸
-                    viewport_set_ = false;
-                    
-                    // 清除脏标志
-                    surface_size_dirty_ = false;
-                    pending_window_ref_ = nullptr;
-                    
+                    state_.Update([](RenderState& state) {
+                        state.viewport_set = false;
+                    });
                     return;
                 }
             }
@@ -1262,10 +2222,6 @@ private:
         surface_height_ = 1080;
         MD_LOGW("UpdateSurfaceSizeInGLThread: using default size %dx%d", 
                surface_width_, surface_height_);
-        
-        // 仍然清除脏标志，避免无限重试
-        surface_size_dirty_ = false;
-        pending_window_ref_ = nullptr;
     }
 
     // 初始化投影矩阵（分离的投影矩阵，用于触摸控制）
@@ -1304,8 +2260,23 @@ private:
         projection_matrix_[15] = 0.0f;
     }
     
+    // 触摸累积值变化时重新计算视图矩阵（只在GL线程调用）
+    void UpdateViewMatrixFromTouchIfNeeded(const RenderState& state) {
+        if (!state.use_touch_control) {
+            return;
+        }
+        if (!view_matrix_dirty_ && state.touch_delta_x == applied_touch_delta_x_ &&
+            state.touch_delta_y == applied_touch_delta_y_) {
+            return;
+        }
+        applied_touch_delta_x_ = state.touch_delta_x;
+        applied_touch_delta_y_ = state.touch_delta_y;
+        view_matrix_dirty_ = false;
+        UpdateMVPMatrixFromTouch(state.touch_delta_x, state.touch_delta_y);
+    }
+
     // 根据触摸 delta 更新 MVP 矩阵
-    void UpdateMVPMatrixFromTouch() {
+    void UpdateMVPMatrixFromTouch(float touch_delta_x, float touch_delta_y) {
         // 使用触摸delta计算旋转
         float rotation_x[16], rotation_y[16], combined_rotation[16];
         
@@ -1314,10 +2285,10 @@ private:
         SetIdentityMatrix(combined_rotation);
         
         // 绕X轴旋转（上下）
-        RotateMatrix(rotation_x, -touch_delta_y_, 1.0f, 0.0f, 0.0f);
+        RotateMatrix(rotation_x, -touch_delta_y, 1.0f, 0.0f, 0.0f);
         
         // 绕Y轴旋转（左右）
-        RotateMatrix(rotation_y, -touch_delta_x_, 0.0f, 1.0f, 0.0f);
+        RotateMatrix(rotation_y, -touch_delta_x, 0.0f, 1.0f, 0.0f);
         
         // 组合旋转：先绕Y轴，再绕X轴
         MultiplyMatrix(combined_rotation, rotation_y, rotation_x);
@@ -1384,16 +2355,6 @@ private:
         std::copy(temp, temp + 16, result);
     }
 
-    float clear_color_[4] = {0.0f, 0.0f, 0.0f, 1.0f}; // RGBA: 黑色（恢复正常）
-    bool cull_face_enabled_ = false;  // 禁用面剔除（VR 中需要从球体内部看，需要看到"背面"）
-    bool depth_test_enabled_ = true; // 默认启用深度测试
-
-    // 触摸控制相关
-    float touch_delta_x_ = 0.0f;
-    float touch_delta_y_ = 0.0f;
-    bool use_touch_control_ = false;  // 是否使用触摸控制（如果外部设置了 MVP 矩阵，则使用外部矩阵）
-    bool mvp_matrix_dirty_ = false;   // MVP 矩阵是否需要更新
-    
     // 投影矩阵和视图矩阵（分离存储，用于计算 MVP）
     float projection_matrix_[16] = {0};
     float view_matrix_[16] = {0};
@@ -1403,41 +2364,6 @@ private:
         0.0f, 0.0f, 1.0f, 0.0f,
         0.0f, 0.0f, 0.0f, 1.0f
     };
-    
-    // Viewport 相关
-    int viewport_x_ = 0;
-    int viewport_y_ = 0;
-    int viewport_width_ = 0;
-    int viewport_height_ = 0;
-    bool viewport_set_ = false; // 是否设置了自定义 viewport
-    
-    // Scissor 相关
-    int scissor_x_ = 0;
-    int scissor_y_ = 0;
-    int scissor_width_ = 0;
-    int scissor_height_ = 0;
-    bool scissor_enabled_ = false;
-    
-    // Blend 相关
-    bool blend_enabled_ = false;
-    int blend_src_ = GL_SRC_ALPHA; // 默认混合源因子
-    int blend_dst_ = GL_ONE_MINUS_SRC_ALPHA; // 默认混合目标因子
-    
-    // 投影模式相关
-    bool pending_projection_mode_change_ = false;
-    int pending_projection_mode_ = 201; // 默认 SPHERE
-
-    bool surface_size_dirty_ = false;
-    std::shared_ptr<MDNativeWindowRef> pending_window_ref_ = nullptr;
-    
-    // 运动传感器相关
-    float sensor_matrix_[16] = {
-        1.0f, 0.0f, 0.0f, 0.0f,
-        0.0f, 1.0f, 0.0f, 0.0f,
-        0.0f, 0.0f, 1.0f, 0.0f,
-        0.0f, 0.0f, 0.0f, 1.0f
-    };
-    bool sensor_matrix_updated_ = false;
 };
 
 std::shared_ptr<MD360RendererAPI> MD360RendererAPI::CreateRenderer() {
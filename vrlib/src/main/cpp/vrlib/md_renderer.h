@@ -7,9 +7,12 @@
 #ifndef MD360PLAYER4OH_MD_RENDERER_H
 #define MD360PLAYER4OH_MD_RENDERER_H
 
+#include <functional>
 #include <string>
 #include "md_lifecycle.h"
 #include "device/md_nativewindow_ref.h"
+#include "md_frame_scheduler.h"
+#include "md_frame_stats.h"
 
 namespace asha {
 namespace vrlib {
@@ -20,6 +23,12 @@ enum EyeType {
     RIGHT_EYE = 1
 };
 
+// 渲染模式（取值与 GLSurfaceView 保持一致）
+enum MDRenderMode {
+    MD_RENDER_MODE_WHEN_DIRTY = 0,   // 只有视频帧、姿态或渲染状态变化时才重绘
+    MD_RENDER_MODE_CONTINUOUSLY = 1  // 每个vsync都重绘
+};
+
 // VR模式配置结构体
 struct VRModeConfig {
     bool enabled = false;
@@ -40,6 +49,8 @@ public:
     virtual void UpdateMVPMatrix(float* matrix) = 0;
     virtual void UpdateTouchDelta(float deltaX, float deltaY) = 0;
     virtual uint64_t GetVideoSurfaceId() = 0;
+    // 与另一个实例共享视频纹理（需在 Init 之前调用）：只解码/送帧一次，投影、显示模式和姿态各自独立
+    virtual int ShareVideoFrom(std::shared_ptr<MD360RendererAPI> other) = 0;
     virtual void SetClearColor(float r, float g, float b, float a) = 0;
     virtual void SetCullFaceEnabled(bool enabled) = 0;
     virtual void SetDepthTestEnabled(bool enabled) = 0;
@@ -49,6 +60,13 @@ public:
     virtual void SetBlendEnabled(bool enabled) = 0;
     virtual void SetBlendFunc(int src, int dst) = 0;
     virtual void SetProjectionMode(int mode) = 0;
+    // 之前提交的设置都在GL线程生效后回调（在GL线程中调用），渲染器销毁时以 MD_ERR_CANCELLED 回调
+    virtual void Flush(std::function<void(int)> callback) = 0;
+    // 挂起渲染：宿主上所有渲染器都挂起时GL线程在条件变量上休眠；release_gpu_memory 为 true 时在GL线程释放
+    // 着色器程序、顶点缓冲和离屏缓冲（保留视频纹理，surface 仍然有效），Resume 后第一帧由内存中的网格数据和
+    // 程序二进制缓存重建。Pause() 等同于 Suspend(false)
+    virtual int Suspend(bool release_gpu_memory) = 0;
+    virtual MDSuspendStats GetSuspendStats() = 0;
 
     // 新增VR模式相关接口
     virtual void SetVRModeEnabled(bool enabled) = 0;
@@ -60,6 +78,70 @@ public:
     
     // 运动传感器接口
     virtual void UpdateSensorMatrix(float* matrix) = 0;
+
+    // 帧调度相关接口（需在 Init 之前设置时钟；默认挂在进程共享的渲染宿主上，使用vsync时钟，
+    // 指定时钟后单独使用一个渲染宿主）
+    virtual void SetFrameClock(std::shared_ptr<MDFrameClock> clock) = 0;
+    virtual MDFrameSchedulerStats GetFrameSchedulerStats() = 0;
+
+    // 按需渲染接口
+    virtual void SetRenderMode(int mode) = 0;
+    virtual void RequestRender() = 0;
+    virtual uint64_t GetSkippedFrameCount() = 0;
+
+    // 分阶段耗时统计（p50/p95/p99/max）
+    virtual void GetFrameStats(std::vector<MDStageStats>* stages) = 0;
+    virtual void ResetFrameStats() = 0;
+
+    // 头部姿态预测：把姿态外推到 下一个vsync + 管线延迟，latency_ms 小于0时使用一个帧周期
+    virtual void SetPosePrediction(bool enabled, float latency_ms) = 0;
+
+    // VR模式下的重投影：视频帧或渲染来不及时按最新姿态重投影上一帧，默认关闭
+    virtual void SetReprojectionEnabled(bool enabled) = 0;
+    virtual MDReprojectionStats GetReprojectionStats() = 0;
+
+    // 动态分辨率：按GPU耗时在 [min_scale, max_scale]（0.25 ~ 1）之间调整渲染分辨率，再放大到窗口，默认关闭
+    virtual void SetDynamicResolution(bool enabled, float min_scale, float max_scale) = 0;
+    virtual MDResolutionStats GetResolutionStats() = 0;
+
+    // 球面/穹顶网格的细分级别：level 为 MDMeshLodLevel，MD_MESH_LOD_AUTO（默认）时按输出分辨率和视野自动选择
+    virtual void SetMeshLodLevel(int level) = 0;
+    virtual MDMeshLodStats GetMeshLodStats() = 0;
+
+    // 视锥剔除：网格按角度分块，每只眼睛只提交视锥内的分块，默认开启
+    virtual void SetFrustumCullingEnabled(bool enabled) = 0;
+    virtual MDCullingStats GetCullingStats() = 0;
+
+    // 射线投射渲染：按投影模式（201 ~ 205，立方体不支持）选择不用网格、由片元着色器逐像素求视线采样，默认都关闭
+    virtual void SetRayCastEnabled(int projection_mode, bool enabled) = 0;
+    virtual MDRayCastStats GetRayCastStats() = 0;
+
+    // 加载 md_mesh_bake 烘焙的网格资源（fd 中 [offset, offset + length)，例如 rawfile 的描述符，调用后可以关闭 fd）
+    // 资源在进程内共享，之后缺少的网格直接映射上传、不再生成；返回 MD_OK、MD_ERR_ASSET_IO 或 MD_ERR_ASSET_INVALID
+    virtual int LoadMeshAsset(int fd, int64_t offset, int64_t length) = 0;
+
+    // 双鱼眼投影（210 左右排列、211 上下排列）的镜头标定：index 为0（朝前）或1（朝后），圆心和半径按帧宽高归一化
+    // （原点在左上角），fov 为镜头圆覆盖的视场角（度），两个镜头重叠的接缝带内混合；fov 小于等于0时恢复默认值
+    // 返回 MD_OK 或 MD_ERR_INVALID_PARAM
+    virtual int SetFisheyeLens(int index, float center_x, float center_y, float radius_x, float radius_y,
+                               float fov) = 0;
+
+    // 立方体贴图投影（214）的画面排列：layout 为 MDCubeLayoutType（3x2、6x1、EAC 排列），equi_angular 为 true 时
+    // 按等角立方体贴图（EAC）在片元着色器里变换面内坐标，padding 为每个面四边的边距（按面的宽高比例，0 ~ 0.25）
+    // 默认 3x2、不做等角变换、没有边距；返回 MD_OK 或 MD_ERR_INVALID_PARAM
+    virtual int SetCubeLayout(int layout, bool equi_angular, float padding) = 0;
+
+    // 立体球面投影（206 / 213 上下排列，212 左右排列）每只眼睛的球面绕 Y 轴偏转的角度（度，-180 ~ 180，
+    // 正值画面向左移），用于校正左右眼没有对齐的片源；只在VR模式下生效，返回 MD_OK 或 MD_ERR_INVALID_PARAM
+    virtual int SetStereoEyeOffset(float left_yaw, float right_yaw) = 0;
+
+    // 平面投影（207 / 208 / 209）的缩放方式（MDPlaneScaleType，DEFAULT 时按投影模式）和眼镜模式下弧形屏幕的
+    // 水平弧度（度，0 ~ 180，0 为平面屏幕）。宽高比取自视频缓冲区尺寸；返回 MD_OK 或 MD_ERR_INVALID_PARAM
+    virtual int SetPlaneOptions(int scale_type, float curve_degree) = 0;
+
+    // 按片源帧率出图：没有头部跟踪时按视频帧时间戳估计的帧率安排取帧的vsync（必要时 3:2 pulldown），默认开启
+    virtual void SetVideoCadenceEnabled(bool enabled) = 0;
+    virtual MDVideoCadenceStats GetVideoCadenceStats() = 0;
 };
 
 }
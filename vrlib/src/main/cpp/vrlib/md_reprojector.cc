@@ -0,0 +1,202 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#include "md_reprojector.h"
+#include <algorithm>
+#include "md_defines.h"
+#include "md_log.h"
+#include "md_matrix.h"
+#include "md_program_cache.h"
+
+namespace asha {
+namespace vrlib {
+
+// 全屏四边形：每个像素由 NDC 坐标反推出新视线方向，再投影回渲染时的画面取色
+static const char* WARP_VERTEX_SHADER = R"(
+    attribute vec2 a_Position;
+    varying vec2 vNdc;
+    void main() {
+        vNdc = a_Position;
+        gl_Position = vec4(a_Position, 0.0, 1.0);
+    }
+)";
+
+// 深度取视频球面所在的位置（半径18，near=0.1，far=100 时 NDC z 约为0.99），
+// 相机在球心，纯旋转下结果与深度无关，眼间距带来的平移在这个深度上也是正确的
+static const char* WARP_FRAGMENT_SHADER = R"(
+    precision mediump float;
+    varying vec2 vNdc;
+    uniform mat4 u_WarpMatrix;
+    uniform sampler2D u_EyeTexture;
+    void main() {
+        vec4 clip = u_WarpMatrix * vec4(vNdc, 0.99, 1.0);
+        if (clip.w <= 0.0) {
+            gl_FragColor = vec4(0.0, 0.0, 0.0, 1.0);
+            return;
+        }
+        vec2 uv = clip.xy / clip.w * 0.5 + 0.5;
+        if (uv.x < 0.0 || uv.x > 1.0 || uv.y < 0.0 || uv.y > 1.0) {
+            gl_FragColor = vec4(0.0, 0.0, 0.0, 1.0);
+        } else {
+            gl_FragColor = texture2D(u_EyeTexture, uv);
+        }
+    }
+)";
+
+static const float QUAD_VERTICES[] = {
+    -1.0f, -1.0f,
+     1.0f, -1.0f,
+    -1.0f,  1.0f,
+     1.0f,  1.0f,
+};
+
+int MDReprojector::CreateProgram() {
+    program_ = MDProgramCache::GetInstance().CreateProgram(WARP_VERTEX_SHADER, WARP_FRAGMENT_SHADER, {"a_Position"});
+    if (program_ == 0) {
+        MD_LOGE("MDReprojector: create program failed");
+        return MD_ERR;
+    }
+    warp_matrix_loc_ = glGetUniformLocation(program_, "u_WarpMatrix");
+    texture_loc_ = glGetUniformLocation(program_, "u_EyeTexture");
+
+    glGenBuffers(1, &quad_vbo_);
+    glBindBuffer(GL_ARRAY_BUFFER, quad_vbo_);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(QUAD_VERTICES), QUAD_VERTICES, GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    return MD_OK;
+}
+
+int MDReprojector::EnsureEyeTargets(int width, int height) {
+    if (width <= 0 || height <= 0) {
+        return MD_ERR;
+    }
+    if (program_ == 0 && CreateProgram() != MD_OK) {
+        return MD_ERR;
+    }
+    if (fbo_[0] != 0 && width == width_ && height == height_) {
+        return MD_OK;
+    }
+
+    DestroyTargets();
+    glGenFramebuffers(2, fbo_);
+    glGenTextures(2, color_texture_);
+    glGenRenderbuffers(2, depth_buffer_);
+    for (int i = 0; i < 2; i++) {
+        glBindTexture(GL_TEXTURE_2D, color_texture_[i]);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+        glBindRenderbuffer(GL_RENDERBUFFER, depth_buffer_[i]);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT16, width, height);
+
+        glBindFramebuffer(GL_FRAMEBUFFER, fbo_[i]);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, color_texture_[i], 0);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depth_buffer_[i]);
+        GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+        if (status != GL_FRAMEBUFFER_COMPLETE) {
+            MD_LOGE("MDReprojector: framebuffer incomplete: 0x%x", status);
+            glBindFramebuffer(GL_FRAMEBUFFER, 0);
+            DestroyTargets();
+            return MD_ERR;
+        }
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+    width_ = width;
+    height_ = height;
+    MD_LOGI("MDReprojector: eye targets created %dx%d", width, height);
+    return MD_OK;
+}
+
+void MDReprojector::BeginEye(int eye_index) {
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo_[eye_index]);
+    has_frame_[eye_index] = false;
+}
+
+void MDReprojector::EndEye(int eye_index, const float* render_mvp) {
+    std::copy(render_mvp, render_mvp + 16, render_mvp_[eye_index]);
+    has_frame_[eye_index] = true;
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+bool MDReprojector::HasEyeFrames(int width, int height) const {
+    return program_ != 0 && has_frame_[0] && has_frame_[1] && width == width_ && height == height_;
+}
+
+void MDReprojector::ComposeEye(int eye_index, const float* current_mvp, int x, int y, int width, int height) {
+    if (program_ == 0 || !has_frame_[eye_index]) {
+        return;
+    }
+    // 行向量约定下：clip_render = clip_current * inverse(current_mvp) * render_mvp
+    float warp_matrix[16];
+    if (!MDMatrix::Invert(warp_matrix, current_mvp)) {
+        return;
+    }
+    MDMatrix::Multiply(warp_matrix, warp_matrix, render_mvp_[eye_index]);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glViewport(x, y, width, height);
+    glDisable(GL_SCISSOR_TEST);
+    glDisable(GL_DEPTH_TEST);
+    glDisable(GL_CULL_FACE);
+    glDisable(GL_BLEND);
+
+    glUseProgram(program_);
+    glUniformMatrix4fv(warp_matrix_loc_, 1, GL_FALSE, warp_matrix);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, color_texture_[eye_index]);
+    glUniform1i(texture_loc_, 0);
+
+    glBindBuffer(GL_ARRAY_BUFFER, quad_vbo_);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
+    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+    glDisableVertexAttribArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void MDReprojector::Invalidate() {
+    has_frame_[0] = false;
+    has_frame_[1] = false;
+}
+
+void MDReprojector::DestroyTargets() {
+    if (fbo_[0] != 0) {
+        glDeleteFramebuffers(2, fbo_);
+        glDeleteTextures(2, color_texture_);
+        glDeleteRenderbuffers(2, depth_buffer_);
+    }
+    for (int i = 0; i < 2; i++) {
+        fbo_[i] = 0;
+        color_texture_[i] = 0;
+        depth_buffer_[i] = 0;
+    }
+    width_ = 0;
+    height_ = 0;
+    Invalidate();
+}
+
+void MDReprojector::Destroy() {
+    DestroyTargets();
+    if (quad_vbo_ != 0) {
+        glDeleteBuffers(1, &quad_vbo_);
+        quad_vbo_ = 0;
+    }
+    if (program_ != 0) {
+        glDeleteProgram(program_);
+        program_ = 0;
+    }
+    warp_matrix_loc_ = -1;
+    texture_loc_ = -1;
+}
+
+}
+}
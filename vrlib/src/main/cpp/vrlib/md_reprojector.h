@@ -0,0 +1,63 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef MD360PLAYER4OH_MD_REPROJECTOR_H
+#define MD360PLAYER4OH_MD_REPROJECTOR_H
+
+#include <GLES3/gl3.h>
+
+namespace asha {
+namespace vrlib {
+
+// 重投影（timewarp）：每只眼睛先渲染到离屏缓冲并记下渲染时的 MVP，
+// 上屏时按最新姿态的 MVP 对缓冲做旋转重投影；视频帧或渲染来不及时只做重投影，仍然每个vsync出一帧
+// 所有接口只能在GL线程调用
+class MDReprojector {
+public:
+    MDReprojector() = default;
+    ~MDReprojector() = default;
+
+    // 按眼睛尺寸创建离屏缓冲和重投影程序，尺寸变化时重建
+    int EnsureEyeTargets(int width, int height);
+    bool IsCreated() const { return program_ != 0; }
+
+    // 把这只眼睛的场景渲染重定向到离屏缓冲（视口为 0,0,width,height）
+    void BeginEye(int eye_index);
+    // 场景渲染完成，记录渲染时使用的 MVP，之后缓冲可以被重投影
+    void EndEye(int eye_index, const float* render_mvp);
+    // 两只眼睛都有可重投影的画面，且尺寸与当前眼睛尺寸一致
+    bool HasEyeFrames(int width, int height) const;
+
+    // 把眼睛缓冲按 current_mvp 重投影到默认帧缓冲的指定视口
+    void ComposeEye(int eye_index, const float* current_mvp, int x, int y, int width, int height);
+
+    // 丢弃已有画面（投影/VR模式切换后旧画面不能再用）
+    void Invalidate();
+    void Destroy();
+
+private:
+    int CreateProgram();
+    void DestroyTargets();
+
+private:
+    GLuint fbo_[2] = {0, 0};
+    GLuint color_texture_[2] = {0, 0};
+    GLuint depth_buffer_[2] = {0, 0};
+    int width_ = 0;
+    int height_ = 0;
+    bool has_frame_[2] = {false, false};
+    float render_mvp_[2][16] = {};
+
+    GLuint program_ = 0;
+    GLuint quad_vbo_ = 0;
+    GLint warp_matrix_loc_ = -1;
+    GLint texture_loc_ = -1;
+};
+
+}
+}
+
+#endif //MD360PLAYER4OH_MD_REPROJECTOR_H
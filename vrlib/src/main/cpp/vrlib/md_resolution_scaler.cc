@@ -0,0 +1,206 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#include "md_resolution_scaler.h"
+#include <algorithm>
+#include <cmath>
+#include "md_defines.h"
+#include "md_log.h"
+
+namespace asha {
+namespace vrlib {
+
+void MDResolutionScaler::SetEnabled(bool enabled) {
+    enabled_ = enabled;
+}
+
+void MDResolutionScaler::SetScaleRange(float min_scale, float max_scale) {
+    min_scale = std::max(0.25f, std::min(min_scale, 1.0f));
+    max_scale = std::max(min_scale, std::min(max_scale, 1.0f));
+    min_scale_ = min_scale;
+    max_scale_ = max_scale;
+}
+
+void MDResolutionScaler::GetStats(MDResolutionStats* stats) {
+    std::lock_guard<std::mutex> lock(stats_mutex_);
+    *stats = stats_;
+    stats->enabled = enabled_;
+    stats->min_scale = min_scale_;
+    stats->max_scale = max_scale_;
+}
+
+float MDResolutionScaler::ClampScale(float scale) const {
+    return std::max(min_scale_.load(), std::min(scale, max_scale_.load()));
+}
+
+int MDResolutionScaler::ScaledSize(int size) const {
+    if (size <= 0) {
+        return size;
+    }
+    int scaled = static_cast<int>(size * scale_ + 0.5f);
+    return scaled > 0 ? scaled : 1;
+}
+
+int MDResolutionScaler::EnsureTarget(int width, int height) {
+    if (fbo_ != 0 && width == target_width_ && height == target_height_) {
+        return MD_OK;
+    }
+    DestroyTarget();
+    glGenFramebuffers(1, &fbo_);
+    glGenTextures(1, &color_texture_);
+    glGenRenderbuffers(1, &depth_buffer_);
+
+    glBindTexture(GL_TEXTURE_2D, color_texture_);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindRenderbuffer(GL_RENDERBUFFER, depth_buffer_);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT16, width, height);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo_);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, color_texture_, 0);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depth_buffer_);
+    GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+    if (status != GL_FRAMEBUFFER_COMPLETE) {
+        MD_LOGE("MDResolutionScaler: framebuffer incomplete: 0x%x", status);
+        DestroyTarget();
+        return MD_ERR;
+    }
+    target_width_ = width;
+    target_height_ = height;
+    MD_LOGI("MDResolutionScaler: target created %dx%d", width, height);
+    return MD_OK;
+}
+
+void MDResolutionScaler::DestroyTarget() {
+    if (fbo_ != 0) {
+        glDeleteFramebuffers(1, &fbo_);
+        fbo_ = 0;
+    }
+    if (color_texture_ != 0) {
+        glDeleteTextures(1, &color_texture_);
+        color_texture_ = 0;
+    }
+    if (depth_buffer_ != 0) {
+        glDeleteRenderbuffers(1, &depth_buffer_);
+        depth_buffer_ = 0;
+    }
+    target_width_ = 0;
+    target_height_ = 0;
+}
+
+bool MDResolutionScaler::BeginTarget(int surface_width, int surface_height) {
+    if (!enabled_ || scale_ >= 1.0f || surface_width <= 0 || surface_height <= 0) {
+        if (fbo_ != 0) {
+            DestroyTarget();
+        }
+        return false;
+    }
+    if (EnsureTarget(ScaledSize(surface_width), ScaledSize(surface_height)) != MD_OK) {
+        return false;
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo_);
+    return true;
+}
+
+void MDResolutionScaler::EndTarget(int surface_width, int surface_height) {
+    if (fbo_ == 0) {
+        return;
+    }
+    // 深度不需要写回内存
+    const GLenum depth_attachment = GL_DEPTH_ATTACHMENT;
+    glInvalidateFramebuffer(GL_FRAMEBUFFER, 1, &depth_attachment);
+
+    // 裁剪测试会影响 blit，先关掉
+    glDisable(GL_SCISSOR_TEST);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, fbo_);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+    glBlitFramebuffer(0, 0, target_width_, target_height_, 0, 0, surface_width, surface_height,
+                      GL_COLOR_BUFFER_BIT, GL_LINEAR);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+void MDResolutionScaler::BeginGpuTiming() {
+    if (!enabled_) {
+        return;
+    }
+    gpu_timer_.Init();
+    gpu_timer_.Begin();
+}
+
+void MDResolutionScaler::EndGpuTiming() {
+    gpu_timer_.End();
+}
+
+int64_t MDResolutionScaler::Update(int64_t frame_period_ns, int64_t cpu_frame_ns) {
+    int64_t gpu_ns = -1;
+    bool has_gpu_result = gpu_timer_.Poll(&gpu_ns);
+    if (!has_gpu_result) {
+        gpu_ns = -1;
+    }
+    if (!enabled_) {
+        scale_ = 1.0f;
+        frame_ns_ = 0.0;
+        frames_since_change_ = 0;
+        std::lock_guard<std::mutex> lock(stats_mutex_);
+        stats_.scale = scale_;
+        return gpu_ns;
+    }
+
+    // 有 timer query 时只用GPU结果（晚几帧到达），否则退化为CPU侧的渲染+交换耗时
+    int64_t sample_ns = gpu_timer_.IsSupported() ? gpu_ns : cpu_frame_ns;
+    float scale = ClampScale(scale_);
+    if (sample_ns >= 0 && frame_period_ns > 0) {
+        frame_ns_ = frame_ns_ <= 0.0 ? sample_ns : frame_ns_ + (sample_ns - frame_ns_) * 0.2;
+        frames_since_change_++;
+        if (frames_since_change_ >= SETTLE_FRAMES) {
+            double target_ns = frame_period_ns * TARGET_RATIO;
+            if (frame_ns_ > target_ns) {
+                // 耗时近似与像素数成正比，像素数是比例的平方
+                scale = scale * static_cast<float>(std::sqrt(target_ns / frame_ns_));
+                scale = std::floor(scale / SCALE_STEP + 0.001f) * SCALE_STEP;
+            } else if (frame_ns_ < target_ns * SCALE_UP_RATIO) {
+                scale += SCALE_STEP;
+            }
+            scale = ClampScale(scale);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(stats_mutex_);
+    if (frames_since_change_ == SETTLE_FRAMES && stats_.frame_ms_before_change > 0.0) {
+        stats_.frame_ms_after_change = frame_ns_ / 1000000.0;
+    }
+    if (std::fabs(scale - scale_) >= SCALE_STEP * 0.5f) {
+        MD_LOGI("MDResolutionScaler: scale %.2f -> %.2f, frame time %.2fms, period %.2fms", scale_, scale,
+                frame_ns_ / 1000000.0, frame_period_ns / 1000000.0);
+        if (scale < scale_) {
+            stats_.scale_down_count++;
+        } else {
+            stats_.scale_up_count++;
+        }
+        stats_.frame_ms_before_change = frame_ns_ / 1000000.0;
+        stats_.frame_ms_after_change = 0.0;
+        frames_since_change_ = 0;
+    }
+    scale_ = scale;
+    stats_.scale = scale_;
+    stats_.frame_ms = frame_ns_ / 1000000.0;
+    stats_.gpu_timer_supported = gpu_timer_.IsSupported();
+    return gpu_ns;
+}
+
+void MDResolutionScaler::Destroy() {
+    DestroyTarget();
+    gpu_timer_.Destroy();
+}
+
+}
+}
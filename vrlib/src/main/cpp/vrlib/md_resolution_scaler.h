@@ -0,0 +1,79 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef MD360PLAYER4OH_MD_RESOLUTION_SCALER_H
+#define MD360PLAYER4OH_MD_RESOLUTION_SCALER_H
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <GLES3/gl3.h>
+#include "md_frame_stats.h"
+#include "md_gpu_timer.h"
+
+namespace asha {
+namespace vrlib {
+
+// 动态分辨率：场景先按缩放比例渲染到离屏缓冲，再放大到窗口；
+// 每帧根据测得的GPU耗时（不支持 timer query 时用CPU侧的渲染+交换耗时）在 [min, max] 之间调整比例
+// 配置和统计接口可以在任意线程调用，其余接口只能在GL线程调用
+class MDResolutionScaler {
+public:
+    static constexpr float SCALE_STEP = 0.05f;    // 比例按这个步长量化，避免每帧重建缓冲
+    static constexpr int SETTLE_FRAMES = 15;      // 调整后至少观察这么多帧再决定下一次调整
+    static constexpr float TARGET_RATIO = 0.8f;   // 目标耗时占帧周期的比例（给放大和合成留余量）
+    static constexpr float SCALE_UP_RATIO = 0.6f; // 耗时低于目标的这个比例时才放大
+
+    void SetEnabled(bool enabled);
+    void SetScaleRange(float min_scale, float max_scale);
+    void GetStats(MDResolutionStats* stats);
+
+    // 本帧使用的缩放比例（关闭时为1）
+    float GetScale() const { return scale_; }
+    int ScaledSize(int size) const;
+
+    // 比例小于1时把离屏缓冲绑定为渲染目标并返回 true，否则直接渲染到窗口
+    bool BeginTarget(int surface_width, int surface_height);
+    // 把离屏缓冲放大到窗口（默认帧缓冲）
+    void EndTarget(int surface_width, int surface_height);
+
+    // 包住一次完整渲染的GL命令
+    void BeginGpuTiming();
+    void EndGpuTiming();
+    // 帧交换后调用：更新平滑耗时并按需调整下一帧的比例，返回本次取到的GPU耗时（没有新结果时返回-1）
+    int64_t Update(int64_t frame_period_ns, int64_t cpu_frame_ns);
+
+    void Destroy();
+
+private:
+    int EnsureTarget(int width, int height);
+    void DestroyTarget();
+    float ClampScale(float scale) const;
+
+private:
+    std::atomic<bool> enabled_{false};
+    std::atomic<float> min_scale_{0.5f};
+    std::atomic<float> max_scale_{1.0f};
+
+    // 以下只在GL线程访问
+    float scale_ = 1.0f;
+    MDGpuTimer gpu_timer_;
+    GLuint fbo_ = 0;
+    GLuint color_texture_ = 0;
+    GLuint depth_buffer_ = 0;
+    int target_width_ = 0;
+    int target_height_ = 0;
+    double frame_ns_ = 0.0;  // 帧耗时的滑动平均
+    int frames_since_change_ = 0;
+
+    std::mutex stats_mutex_;
+    MDResolutionStats stats_;
+};
+
+}
+}
+
+#endif //MD360PLAYER4OH_MD_RESOLUTION_SCALER_H
@@ -0,0 +1,50 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#include "md_stereo_layout.h"
+#include <algorithm>
+
+namespace asha {
+namespace vrlib {
+
+int MDStereoLayout::FromProjectionMode(int mode) {
+    switch (mode) {
+        case 206: // PROJECTION_MODE_STEREO_SPHERE
+        case 213: // PROJECTION_MODE_STEREO_SPHERE_VERTICAL
+            return MD_STEREO_LAYOUT_TOP_BOTTOM;
+        case 212: // PROJECTION_MODE_STEREO_SPHERE_HORIZONTAL
+            return MD_STEREO_LAYOUT_SIDE_BY_SIDE;
+        default:
+            return MD_STEREO_LAYOUT_NONE;
+    }
+}
+
+void MDStereoLayout::TransformSTMatrix(int layout, int eye_index, const float* st_matrix, float* result) {
+    // 网格纹理坐标 t 向上：上半画面是 [0.5, 1]
+    float scale_s = 1.0f;
+    float scale_t = 1.0f;
+    float offset_s = 0.0f;
+    float offset_t = 0.0f;
+    if (layout == MD_STEREO_LAYOUT_TOP_BOTTOM) {
+        scale_t = 0.5f;
+        offset_t = eye_index == 0 ? 0.5f : 0.0f;
+    } else if (layout == MD_STEREO_LAYOUT_SIDE_BY_SIDE) {
+        scale_s = 0.5f;
+        offset_s = eye_index == 0 ? 0.0f : 0.5f;
+    }
+    // result = st_matrix × (缩放 + 平移)，只影响前两列和平移列
+    float temp[16];
+    for (int row = 0; row < 4; row++) {
+        temp[row] = st_matrix[row] * scale_s;
+        temp[4 + row] = st_matrix[4 + row] * scale_t;
+        temp[8 + row] = st_matrix[8 + row];
+        temp[12 + row] = st_matrix[row] * offset_s + st_matrix[4 + row] * offset_t + st_matrix[12 + row];
+    }
+    std::copy(temp, temp + 16, result);
+}
+
+}
+}
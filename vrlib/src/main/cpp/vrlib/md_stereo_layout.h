@@ -0,0 +1,34 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef MD360PLAYER4OH_MD_STEREO_LAYOUT_H
+#define MD360PLAYER4OH_MD_STEREO_LAYOUT_H
+
+namespace asha {
+namespace vrlib {
+
+// 立体 360 视频的画面排列（左眼在上 / 左）
+enum MDStereoLayoutType {
+    MD_STEREO_LAYOUT_NONE = 0,
+    MD_STEREO_LAYOUT_TOP_BOTTOM,    // 上下排列：上半为左眼，下半为右眼
+    MD_STEREO_LAYOUT_SIDE_BY_SIDE,  // 左右排列：左半为左眼，右半为右眼
+};
+
+// 立体投影的每只眼睛共用同一个球面网格，只是纹理坐标变换（u_STMatrix）不同，只采样自己的那一半画面
+class MDStereoLayout {
+public:
+    // 投影模式对应的排列：206 / 213 为上下，212 为左右，其余不是立体投影
+    static int FromProjectionMode(int mode);
+
+    // 在视频的纹理坐标变换 st_matrix 之前先把网格纹理坐标缩放、平移到 eye_index 这只眼睛的半边画面，
+    // 结果写入 result（列主序，可以与 st_matrix 相同）。NONE 时原样复制
+    static void TransformSTMatrix(int layout, int eye_index, const float* st_matrix, float* result);
+};
+
+}
+}
+
+#endif //MD360PLAYER4OH_MD_STEREO_LAYOUT_H
@@ -0,0 +1,67 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef MD360PLAYER4OH_MD_TRIPLE_BUFFER_H
+#define MD360PLAYER4OH_MD_TRIPLE_BUFFER_H
+
+#include <atomic>
+#include <mutex>
+
+namespace asha {
+namespace vrlib {
+
+// 三缓冲快照：多个写者（UI线程、传感器线程）修改状态后发布，单个读者（GL线程）无阻塞地取最新快照
+// 写者之间用 write_mutex_ 串行化，读者从不加锁，也不会被写者阻塞
+template <typename T>
+class MDTripleBuffer {
+public:
+    MDTripleBuffer() = default;
+    explicit MDTripleBuffer(const T& initial) : working_(initial) {
+        buffers_[0] = initial;
+        buffers_[1] = initial;
+        buffers_[2] = initial;
+    }
+
+    // 写端：在工作副本上修改并发布，fn 的签名为 void(T&)
+    template <typename F>
+    void Update(F&& fn) {
+        std::lock_guard<std::mutex> lock(write_mutex_);
+        fn(working_);
+        buffers_[write_index_] = working_;
+        // 把刚写好的缓冲区换到中间位置，拿回旧的中间缓冲区继续写
+        int prev = middle_.exchange(write_index_ | DIRTY_BIT, std::memory_order_acq_rel);
+        write_index_ = prev & INDEX_MASK;
+    }
+
+    // 读端（仅限单个读者线程）：返回最新发布的快照，在下一次 Read 之前保持有效
+    const T& Read(bool* updated = nullptr) {
+        bool has_new = (middle_.load(std::memory_order_acquire) & DIRTY_BIT) != 0;
+        if (has_new) {
+            int prev = middle_.exchange(read_index_, std::memory_order_acq_rel);
+            read_index_ = prev & INDEX_MASK;
+        }
+        if (updated != nullptr) {
+            *updated = has_new;
+        }
+        return buffers_[read_index_];
+    }
+
+private:
+    static constexpr int DIRTY_BIT = 0x4;
+    static constexpr int INDEX_MASK = 0x3;
+
+    T buffers_[3];
+    T working_;
+    std::mutex write_mutex_;
+    int write_index_ = 0;           // 只由写者访问（持有 write_mutex_）
+    int read_index_ = 1;            // 只由读者访问
+    std::atomic<int> middle_{2};    // 写者和读者交换的中间缓冲区，带“有新数据”标记
+};
+
+}
+}
+
+#endif //MD360PLAYER4OH_MD_TRIPLE_BUFFER_H
@@ -0,0 +1,138 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#include "md_video_cadence.h"
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include "md_log.h"
+
+namespace asha {
+namespace vrlib {
+
+// 帧间隔超出这个范围时认为是暂停、seek 或循环播放，重新开始统计
+static const int64_t MIN_FRAME_INTERVAL_NS = 5000000LL;
+static const int64_t MAX_FRAME_INTERVAL_NS = 200000000LL;
+// 与标准帧率相差不超过 1.5% 时吸附（有多个时取最接近的）
+static const double SNAP_TOLERANCE = 0.015;
+static const double STANDARD_FRAME_RATES[] = {
+    24000.0 / 1001.0, 24.0, 25.0, 30000.0 / 1001.0, 30.0, 48.0, 50.0, 60000.0 / 1001.0, 60.0,
+};
+
+void MDFrameRateEstimator::AddTimestamp(int64_t timestamp_ns) {
+    int64_t interval_ns = timestamp_ns - last_timestamp_ns_;
+    bool has_last = last_timestamp_ns_ != 0;
+    last_timestamp_ns_ = timestamp_ns;
+    if (!has_last) {
+        return;
+    }
+    if (interval_ns < MIN_FRAME_INTERVAL_NS || interval_ns > MAX_FRAME_INTERVAL_NS) {
+        // 时间戳不连续，保留已有估计，等新的样本覆盖
+        return;
+    }
+    intervals_[index_] = interval_ns;
+    index_ = (index_ + 1) % WINDOW;
+    if (count_ < WINDOW) {
+        count_++;
+    }
+    if (count_ < MIN_SAMPLES) {
+        return;
+    }
+
+    int64_t sorted[WINDOW];
+    std::copy(intervals_, intervals_ + count_, sorted);
+    std::nth_element(sorted, sorted + count_ / 2, sorted + count_);
+    int64_t median_ns = sorted[count_ / 2];
+
+    // 23.976 与 24、29.97 与 30 之间的差小于容差，吸附到最接近的一个
+    double fps = 1000000000.0 / median_ns;
+    double best_error = -1.0;
+    double snapped = fps;
+    for (double standard : STANDARD_FRAME_RATES) {
+        double error = std::fabs(fps - standard);
+        if (error <= standard * SNAP_TOLERANCE && (best_error < 0.0 || error < best_error)) {
+            snapped = standard;
+            best_error = error;
+        }
+    }
+    fps = snapped;
+    int64_t period_ns = static_cast<int64_t>(1000000000.0 / fps + 0.5);
+    int64_t old_period_ns = period_ns_.exchange(period_ns);
+    if (old_period_ns != period_ns) {
+        MD_LOGI("MDFrameRateEstimator: source frame rate %.3f fps", fps);
+    }
+}
+
+void MDFrameRateEstimator::Reset() {
+    last_timestamp_ns_ = 0;
+    count_ = 0;
+    index_ = 0;
+    period_ns_ = 0;
+}
+
+bool MDPresentCadence::Tick(int64_t vsync_ns, int64_t display_period_ns, int64_t content_period_ns) {
+    // 片源帧率未知、接近或高于刷新率时不需要调节节奏
+    if (content_period_ns <= 0 || display_period_ns <= 0 || content_period_ns * 10 < display_period_ns * 11) {
+        Reset();
+        return true;
+    }
+    if (content_period_ns != last_content_period_ns_ || display_period_ns != last_display_period_ns_) {
+        LogPattern(display_period_ns, content_period_ns);
+        last_content_period_ns_ = content_period_ns;
+        last_display_period_ns_ = display_period_ns;
+    }
+
+    // 按实际经过的时间累加，宿主休眠跳过的vsync也计算在内；间隔太久时重新开始并立即取帧
+    int64_t elapsed_ns = vsync_ns - last_vsync_ns_;
+    if (last_vsync_ns_ == 0 || elapsed_ns <= 0 || elapsed_ns > content_period_ns * 4) {
+        phase_ns_ = content_period_ns;
+    } else {
+        phase_ns_ += elapsed_ns;
+    }
+    last_vsync_ns_ = vsync_ns;
+
+    // 相位离下一个片源帧不到半个vsync时取帧，取整误差在各帧之间交替分摊（3:2）
+    if (phase_ns_ * 2 + display_period_ns >= content_period_ns * 2) {
+        phase_ns_ -= content_period_ns;
+        if (phase_ns_ > display_period_ns) {
+            phase_ns_ = 0;
+        }
+        return true;
+    }
+    return false;
+}
+
+void MDPresentCadence::Reset() {
+    phase_ns_ = 0;
+    last_vsync_ns_ = 0;
+    last_display_period_ns_ = 0;
+    last_content_period_ns_ = 0;
+}
+
+void MDPresentCadence::LogPattern(int64_t display_period_ns, int64_t content_period_ns) {
+    // 模拟几个周期，输出每个片源帧保持的vsync数，例如 24fps@60Hz 为 3,2,3,2...
+    std::string pattern;
+    int64_t phase_ns = content_period_ns;
+    int hold = 0;
+    int presents = 0;
+    for (int i = 0; i < 64 && presents < 9; i++) {
+        hold++;
+        if (phase_ns * 2 + display_period_ns >= content_period_ns * 2) {
+            phase_ns -= content_period_ns;
+            if (presents > 0) {
+                pattern += (pattern.empty() ? "" : ",") + std::to_string(hold);
+            }
+            presents++;
+            hold = 0;
+        }
+        phase_ns += display_period_ns;
+    }
+    MD_LOGI("MDPresentCadence: %.3f fps on %.2f Hz, vsyncs per frame %s", 1000000000.0 / content_period_ns,
+            1000000000.0 / display_period_ns, pattern.c_str());
+}
+
+}
+}
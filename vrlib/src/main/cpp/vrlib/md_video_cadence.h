@@ -0,0 +1,59 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef MD360PLAYER4OH_MD_VIDEO_CADENCE_H
+#define MD360PLAYER4OH_MD_VIDEO_CADENCE_H
+
+#include <atomic>
+#include <cstdint>
+
+namespace asha {
+namespace vrlib {
+
+// 根据视频帧的时间戳（NativeImage buffer timestamp）估计片源帧率
+// 取最近若干帧间隔的中位数，接近常见帧率（23.976/24/25/29.97/30/50/59.94/60）时吸附到标准值
+// AddTimestamp 只在GL线程调用，GetFramePeriodNs 可在任意线程调用
+class MDFrameRateEstimator {
+public:
+    static constexpr int WINDOW = 16;
+    static constexpr int MIN_SAMPLES = 6;
+
+    void AddTimestamp(int64_t timestamp_ns);
+    void Reset();
+    // 估计的帧周期，样本不足时为0
+    int64_t GetFramePeriodNs() const { return period_ns_.load(); }
+
+private:
+    int64_t last_timestamp_ns_ = 0;
+    int64_t intervals_[WINDOW] = {};
+    int count_ = 0;
+    int index_ = 0;
+    std::atomic<int64_t> period_ns_{0};
+};
+
+// 出图节奏：按片源帧周期在vsync上分配取帧时机（相位累加器）
+// 例如 60Hz 屏上的 24fps 视频每帧交替保持 3、2 个vsync（3:2 pulldown），30fps 每帧保持 2 个vsync；
+// 片源帧率接近或高于屏幕刷新率时每个vsync都取帧。只在GL线程调用
+class MDPresentCadence {
+public:
+    // 每次准备出图时调用，vsync_ns 为本帧上屏的vsync时间，返回这个vsync是否应该取新视频帧
+    bool Tick(int64_t vsync_ns, int64_t display_period_ns, int64_t content_period_ns);
+    void Reset();
+
+private:
+    void LogPattern(int64_t display_period_ns, int64_t content_period_ns);
+
+private:
+    int64_t phase_ns_ = 0;
+    int64_t last_vsync_ns_ = 0;
+    int64_t last_display_period_ns_ = 0;
+    int64_t last_content_period_ns_ = 0;
+};
+
+}
+}
+
+#endif //MD360PLAYER4OH_MD_VIDEO_CADENCE_H
@@ -0,0 +1,123 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#include "md_video_source.h"
+#include <algorithm>
+#include <GLES2/gl2ext.h>
+#include "md_defines.h"
+#include "md_log.h"
+
+namespace asha {
+namespace vrlib {
+
+int MDVideoSource::AcquireGL() {
+    gl_users_++;
+    if (image_ref_ != nullptr) {
+        return MD_OK;
+    }
+
+    glGenTextures(1, &texture_id_);
+    MD_LOGI("MDVideoSource::AcquireGL: Generated texture_id=%u", texture_id_);
+
+    // 绑定纹理并设置纹理参数（必须在创建 NativeImage 之前）
+    glBindTexture(GL_TEXTURE_EXTERNAL_OES, texture_id_);
+    glTexParameteri(GL_TEXTURE_EXTERNAL_OES, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_EXTERNAL_OES, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_EXTERNAL_OES, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_EXTERNAL_OES, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    // 创建NativeImage
+    image_ref_ = std::make_shared<MDNativeImageRef>(texture_id_);
+    if (!image_ref_->IsValid()) {
+        MD_LOGE("MDVideoSource::AcquireGL: Failed to create valid MDNativeImageRef!");
+    }
+    surface_id_ = image_ref_->GetSurfaceId();
+    MD_LOGI("MDVideoSource::AcquireGL: Created NativeImage, surface_id=%llu",
+            (unsigned long long)surface_id_.load());
+
+    // 一个 NativeImage 只能注册一个回调，在这里分发给所有使用者
+    frame_listener_ok_ = image_ref_->SetOnFrameAvailableListener([this]() { NotifyFrameAvailable(); });
+
+    // 解绑纹理
+    glBindTexture(GL_TEXTURE_EXTERNAL_OES, 0);
+    return image_ref_->IsValid() ? MD_OK : MD_ERR;
+}
+
+void MDVideoSource::ReleaseGL() {
+    if (gl_users_ <= 0) {
+        return;
+    }
+    gl_users_--;
+    if (gl_users_ > 0) {
+        return;
+    }
+    // 先销毁 NativeImage（会注销回调），再删除纹理
+    image_ref_ = nullptr;
+    frame_listener_ok_ = false;
+    surface_id_ = 0;
+    if (texture_id_ != 0) {
+        glDeleteTextures(1, &texture_id_);
+        texture_id_ = 0;
+    }
+    has_updated_ = false;
+    buffer_width_ = 0;
+    buffer_height_ = 0;
+    frame_rate_.Reset();
+    MD_LOGI("MDVideoSource::ReleaseGL: released");
+}
+
+int MDVideoSource::Update(uint64_t frame_serial, float* st_matrix) {
+    if (image_ref_ == nullptr) {
+        return MD_ERR;
+    }
+    if (!has_updated_ || frame_serial != updated_serial_) {
+        has_updated_ = true;
+        updated_serial_ = frame_serial;
+        last_result_ = image_ref_->UpdateSurface(st_matrix_);
+        if (image_ref_->HasNewFrame()) {
+            frame_generation_++;
+            frame_rate_.AddTimestamp(image_ref_->GetTimestamp());
+            // 换片源时尺寸会变，每个新帧都读一次（只是取生产者窗口的属性）
+            image_ref_->GetBufferSize(&buffer_width_, &buffer_height_);
+        }
+    }
+    std::copy(st_matrix_, st_matrix_ + 16, st_matrix);
+    return last_result_;
+}
+
+bool MDVideoSource::GetBufferSize(int* width, int* height) const {
+    if (buffer_width_ <= 0 || buffer_height_ <= 0) {
+        return false;
+    }
+    *width = buffer_width_;
+    *height = buffer_height_;
+    return true;
+}
+
+bool MDVideoSource::AddFrameListener(void* owner, std::function<void()> listener) {
+    std::lock_guard<std::mutex> lock(listener_mutex_);
+    listeners_.emplace_back(owner, listener);
+    return frame_listener_ok_;
+}
+
+void MDVideoSource::RemoveFrameListener(void* owner) {
+    std::lock_guard<std::mutex> lock(listener_mutex_);
+    listeners_.erase(std::remove_if(listeners_.begin(), listeners_.end(),
+                                    [owner](const std::pair<void*, std::function<void()>>& item) {
+                                        return item.first == owner;
+                                    }),
+                     listeners_.end());
+}
+
+void MDVideoSource::NotifyFrameAvailable() {
+    std::lock_guard<std::mutex> lock(listener_mutex_);
+    for (auto& item : listeners_) {
+        item.second();
+    }
+}
+
+}
+}
@@ -0,0 +1,85 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef MD360PLAYER4OH_MD_VIDEO_SOURCE_H
+#define MD360PLAYER4OH_MD_VIDEO_SOURCE_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <GLES3/gl3.h>
+#include "device/md_nativeimage_ref.h"
+#include "md_video_cadence.h"
+
+namespace asha {
+namespace vrlib {
+
+// 视频源：一个外部纹理加一个 NativeImage（解码器的输出surface）
+// 同一个渲染宿主上的多个渲染器可以共享同一个视频源，视频只需解码/送帧一次，
+// 每个宿主帧只 UpdateSurface 一次，其余渲染器直接复用纹理和变换矩阵
+// 除 GetSurfaceId 和帧监听外，所有接口只能在宿主GL线程中调用
+class MDVideoSource {
+public:
+    MDVideoSource() = default;
+    ~MDVideoSource() = default;
+
+    // 第一个使用者创建纹理和 NativeImage，之后只增加引用计数
+    int AcquireGL();
+    // 最后一个使用者释放时销毁 NativeImage 和纹理
+    void ReleaseGL();
+
+    // 更新视频帧：同一个宿主帧号只真正 UpdateSurface 一次，返回结果和变换矩阵会被缓存给其他使用者
+    int Update(uint64_t frame_serial, float* st_matrix);
+    // 每取到一个新的视频帧加一，使用者和自己上次看到的值比较即可知道是否有新帧
+    uint64_t GetFrameGeneration() const { return frame_generation_; }
+    // 按视频帧时间戳估计的片源帧周期，还没有足够样本时为0（任意线程可调用）
+    int64_t GetFramePeriodNs() const { return frame_rate_.GetFramePeriodNs(); }
+
+    // 视频缓冲区的尺寸（取到新帧时从 NativeImage 读取），还不知道时返回 false
+    bool GetBufferSize(int* width, int* height) const;
+
+    GLuint GetTextureId() const { return texture_id_; }
+    uint64_t GetSurfaceId() const { return surface_id_.load(); }
+
+    // 新帧到达回调（在生产者线程中触发），owner 用于注销；返回新帧通知是否可用
+    bool AddFrameListener(void* owner, std::function<void()> listener);
+    void RemoveFrameListener(void* owner);
+
+private:
+    void NotifyFrameAvailable();
+
+private:
+    int gl_users_ = 0;
+    GLuint texture_id_ = 0;
+    std::shared_ptr<MDNativeImageRef> image_ref_;
+    bool frame_listener_ok_ = false;
+    std::atomic<uint64_t> surface_id_{0};
+
+    uint64_t updated_serial_ = 0;
+    bool has_updated_ = false;
+    int last_result_ = 0;
+    uint64_t frame_generation_ = 0;
+    int buffer_width_ = 0;
+    int buffer_height_ = 0;
+    MDFrameRateEstimator frame_rate_;
+    float st_matrix_[16] = {
+        1.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 1.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 1.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.0f
+    };
+
+    std::mutex listener_mutex_;
+    std::vector<std::pair<void*, std::function<void()>>> listeners_;
+};
+
+}
+}
+
+#endif //MD360PLAYER4OH_MD_VIDEO_SOURCE_H
@@ -62,10 +62,26 @@ public:
     virtual int Pause() override {
         return renderer_->Pause();
     }
+
+    virtual int Suspend(bool release_gpu_memory) override {
+        return renderer_->Suspend(release_gpu_memory);
+    }
+
+    virtual MDSuspendStats GetSuspendStats() override {
+        return renderer_->GetSuspendStats();
+    }
     
     virtual uint64_t GetVideoSurfaceId() override {
         return renderer_->GetVideoSurfaceId();
     }
+
+    virtual int ShareVideoFrom(std::shared_ptr<MDVRLibraryAPI> other) override {
+        auto library = std::dynamic_pointer_cast<MDVRLibraryOH>(other);
+        if (library == nullptr) {
+            return MD_ERR;
+        }
+        return renderer_->ShareVideoFrom(library->renderer_);
+    }
     
     virtual void SetClearColor(float r, float g, float b, float a) override {
         MD_LOGI("MDVRLibraryOH::SetClearColor called: r=%.3f, g=%.3f, b=%.3f, a=%.3f", r, g, b, a);
@@ -109,6 +125,10 @@ public:
         renderer_->SetProjectionMode(mode);
     }
 
+    virtual void Flush(std::function<void(int)> callback) override {
+        renderer_->Flush(std::move(callback));
+    }
+
     // VR模式相关接口实现（新增）
     virtual void SetVRModeEnabled(bool enabled) override {
         MD_LOGI("MDVRLibraryOH::SetVRModeEnabled: %s", enabled ? "true" : "false");
@@ -142,6 +162,107 @@ public:
     virtual void UpdateSensorMatrix(float* matrix) override {
         renderer_->UpdateSensorMatrix(matrix);
     }
+
+    virtual void SetFrameClock(std::shared_ptr<MDFrameClock> clock) override {
+        renderer_->SetFrameClock(clock);
+    }
+
+    virtual MDFrameSchedulerStats GetFrameSchedulerStats() override {
+        return renderer_->GetFrameSchedulerStats();
+    }
+
+    virtual void SetRenderMode(int mode) override {
+        renderer_->SetRenderMode(mode);
+    }
+
+    virtual void RequestRender() override {
+        renderer_->RequestRender();
+    }
+
+    virtual uint64_t GetSkippedFrameCount() override {
+        return renderer_->GetSkippedFrameCount();
+    }
+
+    virtual void GetFrameStats(std::vector<MDStageStats>* stages) override {
+        renderer_->GetFrameStats(stages);
+    }
+
+    virtual void ResetFrameStats() override {
+        renderer_->ResetFrameStats();
+    }
+
+    virtual void SetReprojectionEnabled(bool enabled) override {
+        renderer_->SetReprojectionEnabled(enabled);
+    }
+
+    virtual MDReprojectionStats GetReprojectionStats() override {
+        return renderer_->GetReprojectionStats();
+    }
+
+    virtual void SetDynamicResolution(bool enabled, float min_scale, float max_scale) override {
+        renderer_->SetDynamicResolution(enabled, min_scale, max_scale);
+    }
+
+    virtual MDResolutionStats GetResolutionStats() override {
+        return renderer_->GetResolutionStats();
+    }
+
+    virtual void SetMeshLodLevel(int level) override {
+        renderer_->SetMeshLodLevel(level);
+    }
+
+    virtual MDMeshLodStats GetMeshLodStats() override {
+        return renderer_->GetMeshLodStats();
+    }
+
+    virtual void SetFrustumCullingEnabled(bool enabled) override {
+        renderer_->SetFrustumCullingEnabled(enabled);
+    }
+
+    virtual MDCullingStats GetCullingStats() override {
+        return renderer_->GetCullingStats();
+    }
+
+    virtual void SetRayCastEnabled(int projection_mode, bool enabled) override {
+        renderer_->SetRayCastEnabled(projection_mode, enabled);
+    }
+
+    virtual MDRayCastStats GetRayCastStats() override {
+        return renderer_->GetRayCastStats();
+    }
+
+    virtual int LoadMeshAsset(int fd, int64_t offset, int64_t length) override {
+        return renderer_->LoadMeshAsset(fd, offset, length);
+    }
+
+    virtual int SetFisheyeLens(int index, float center_x, float center_y, float radius_x, float radius_y,
+                               float fov) override {
+        return renderer_->SetFisheyeLens(index, center_x, center_y, radius_x, radius_y, fov);
+    }
+
+    virtual int SetCubeLayout(int layout, bool equi_angular, float padding) override {
+        return renderer_->SetCubeLayout(layout, equi_angular, padding);
+    }
+
+    virtual int SetStereoEyeOffset(float left_yaw, float right_yaw) override {
+        return renderer_->SetStereoEyeOffset(left_yaw, right_yaw);
+    }
+
+    virtual int SetPlaneOptions(int scale_type, float curve_degree) override {
+        return renderer_->SetPlaneOptions(scale_type, curve_degree);
+    }
+
+    virtual void SetVideoCadenceEnabled(bool enabled) override {
+        renderer_->SetVideoCadenceEnabled(enabled);
+    }
+
+    virtual MDVideoCadenceStats GetVideoCadenceStats() override {
+        return renderer_->GetVideoCadenceStats();
+    }
+
+    virtual void SetPosePrediction(bool enabled, float latency_ms) override {
+        renderer_->SetPosePrediction(enabled, latency_ms);
+    }
    
 private:
     std::shared_ptr<MD360RendererAPI> renderer_ = MD360RendererAPI::CreateRenderer();
@@ -7,8 +7,11 @@
 #ifndef MD360PLAYER4OH_MD_VR_LIBRARY_H
 #define MD360PLAYER4OH_MD_VR_LIBRARY_H
 
+#include <functional>
 #include <string>
 #include "md_lifecycle.h"
+#include "md_frame_scheduler.h"
+#include "md_frame_stats.h"
 
 namespace asha {
 namespace vrlib {
@@ -21,6 +24,8 @@ public:
     virtual void UpdateMVPMatrix(float* matrix) = 0;
     virtual void UpdateTouchDelta(float deltaX, float deltaY) = 0;
     virtual uint64_t GetVideoSurfaceId() = 0;
+    // 与另一个实例共享视频纹理（需在 Init 之前调用）：只解码/送帧一次，投影、显示模式和姿态各自独立
+    virtual int ShareVideoFrom(std::shared_ptr<MDVRLibraryAPI> other) = 0;
     virtual void SetClearColor(float r, float g, float b, float a) = 0;
     virtual void SetCullFaceEnabled(bool enabled) = 0;
     virtual void SetDepthTestEnabled(bool enabled) = 0;
@@ -30,6 +35,13 @@ public:
     virtual void SetBlendEnabled(bool enabled) = 0;
     virtual void SetBlendFunc(int src, int dst) = 0;
     virtual void SetProjectionMode(int mode) = 0;
+    // 之前提交的设置都在GL线程生效后回调（在GL线程中调用），销毁时以 MD_ERR_CANCELLED 回调
+    virtual void Flush(std::function<void(int)> callback) = 0;
+    // 挂起渲染：宿主上所有渲染器都挂起时GL线程在条件变量上休眠；release_gpu_memory 为 true 时在GL线程释放
+    // 着色器程序、顶点缓冲和离屏缓冲（保留视频纹理，surface 仍然有效），Resume 后第一帧由内存中的网格数据和
+    // 程序二进制缓存重建。Pause() 等同于 Suspend(false)
+    virtual int Suspend(bool release_gpu_memory) = 0;
+    virtual MDSuspendStats GetSuspendStats() = 0;
 
     // VR模式相关接口（新增）
     virtual void SetVRModeEnabled(bool enabled) = 0;
@@ -41,6 +53,63 @@ public:
     
     // 运动传感器接口
     virtual void UpdateSensorMatrix(float* matrix) = 0;
+
+    // 帧调度相关接口
+    virtual void SetFrameClock(std::shared_ptr<MDFrameClock> clock) = 0;
+    virtual MDFrameSchedulerStats GetFrameSchedulerStats() = 0;
+
+    // 按需渲染接口
+    virtual void SetRenderMode(int mode) = 0;
+    virtual void RequestRender() = 0;
+    virtual uint64_t GetSkippedFrameCount() = 0;
+
+    // 分阶段耗时统计（p50/p95/p99/max）
+    virtual void GetFrameStats(std::vector<MDStageStats>* stages) = 0;
+    virtual void ResetFrameStats() = 0;
+
+    // 头部姿态预测：把姿态外推到 下一个vsync + 管线延迟，latency_ms 小于0时使用一个帧周期
+    virtual void SetPosePrediction(bool enabled, float latency_ms) = 0;
+
+    // VR模式下的重投影：视频帧或渲染来不及时按最新姿态重投影上一帧，默认关闭
+    virtual void SetReprojectionEnabled(bool enabled) = 0;
+    virtual MDReprojectionStats GetReprojectionStats() = 0;
+
+    // 动态分辨率：按GPU耗时在 [min_scale, max_scale]（0.25 ~ 1）之间调整渲染分辨率，默认关闭
+    virtual void SetDynamicResolution(bool enabled, float min_scale, float max_scale) = 0;
+    virtual MDResolutionStats GetResolutionStats() = 0;
+
+    // 球面/穹顶网格的细分级别：level 为 MDMeshLodLevel，MD_MESH_LOD_AUTO（默认）时按输出分辨率和视野自动选择
+    virtual void SetMeshLodLevel(int level) = 0;
+    virtual MDMeshLodStats GetMeshLodStats() = 0;
+
+    // 视锥剔除：网格按角度分块，每只眼睛只提交视锥内的分块，默认开启
+    virtual void SetFrustumCullingEnabled(bool enabled) = 0;
+    virtual MDCullingStats GetCullingStats() = 0;
+
+    // 射线投射渲染：按投影模式（201 ~ 205，立方体不支持）选择不用网格、由片元着色器逐像素求视线采样，默认都关闭
+    virtual void SetRayCastEnabled(int projection_mode, bool enabled) = 0;
+    virtual MDRayCastStats GetRayCastStats() = 0;
+
+    // 加载 md_mesh_bake 烘焙的网格资源（fd 中 [offset, offset + length)，例如 rawfile 的描述符，调用后可以关闭 fd）
+    // 资源在进程内共享，之后缺少的网格直接映射上传、不再生成；返回 MD_OK、MD_ERR_ASSET_IO 或 MD_ERR_ASSET_INVALID
+    virtual int LoadMeshAsset(int fd, int64_t offset, int64_t length) = 0;
+
+    // 双鱼眼投影（210 / 211）的镜头标定，参数见 MD360Renderer::SetFisheyeLens；返回 MD_OK 或 MD_ERR_INVALID_PARAM
+    virtual int SetFisheyeLens(int index, float center_x, float center_y, float radius_x, float radius_y,
+                               float fov) = 0;
+
+    // 立方体贴图投影（214）的画面排列、是否为 EAC 和面的边距，参数见 MD360Renderer::SetCubeLayout
+    virtual int SetCubeLayout(int layout, bool equi_angular, float padding) = 0;
+
+    // 立体球面投影每只眼睛的球面偏转角度（度），参数见 MD360Renderer::SetStereoEyeOffset
+    virtual int SetStereoEyeOffset(float left_yaw, float right_yaw) = 0;
+
+    // 平面投影的缩放方式和眼镜模式下屏幕的弧度，参数见 MD360Renderer::SetPlaneOptions
+    virtual int SetPlaneOptions(int scale_type, float curve_degree) = 0;
+
+    // 按片源帧率出图：没有头部跟踪时按视频帧时间戳估计的帧率安排取帧的vsync（必要时 3:2 pulldown），默认开启
+    virtual void SetVideoCadenceEnabled(bool enabled) = 0;
+    virtual MDVideoCadenceStats GetVideoCadenceStats() = 0;
 };
 
 }
@@ -0,0 +1,47 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#include "md_vsync_period_estimator.h"
+#include <algorithm>
+#include <cmath>
+
+namespace asha {
+namespace vrlib {
+
+// 只接受合理范围内的单个周期（20Hz ~ 250Hz）
+static const int64_t MIN_PERIOD_NS = 4000000LL;
+static const int64_t MAX_PERIOD_NS = 50000000LL;
+// 间隔超过这么多个周期（暂停、切后台）时不参与估计
+static const int64_t MAX_SKIPPED_PERIODS = 8;
+
+MDVsyncPeriodEstimator::MDVsyncPeriodEstimator(int64_t period_ns) : period_ns_(period_ns) {
+}
+
+int64_t MDVsyncPeriodEstimator::OnVsync(int64_t timestamp_ns) {
+    int64_t delta = timestamp_ns - last_vsync_ns_;
+    bool has_last = last_vsync_ns_ > 0;
+    last_vsync_ns_ = timestamp_ns;
+    if (!has_last || delta <= 0) {
+        return period_ns_;
+    }
+    int64_t periods = std::max<int64_t>(1, std::llround(static_cast<double>(delta) / period_ns_));
+    if (periods > MAX_SKIPPED_PERIODS) {
+        return period_ns_;
+    }
+    int64_t interval = delta / periods;
+    if (interval > MIN_PERIOD_NS && interval < MAX_PERIOD_NS) {
+        period_ns_ = (period_ns_ * 7 + interval) / 8;
+    }
+    return period_ns_;
+}
+
+void MDVsyncPeriodEstimator::Reset(int64_t period_ns) {
+    period_ns_ = period_ns;
+    last_vsync_ns_ = 0;
+}
+
+}
+}
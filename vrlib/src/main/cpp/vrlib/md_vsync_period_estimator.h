@@ -0,0 +1,36 @@
+//
+// Created on 2026/10/16.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef MD360PLAYER4OH_MD_VSYNC_PERIOD_ESTIMATOR_H
+#define MD360PLAYER4OH_MD_VSYNC_PERIOD_ESTIMATOR_H
+
+#include <cstdint>
+#include "md_frame_clock.h"
+
+namespace asha {
+namespace vrlib {
+
+// 拿不到 OH_NativeVSync_GetPeriod 时用vsync回调的间隔估计刷新周期
+// 每帧只请求一次vsync，长帧或按需渲染空闲后两次回调之间会跨过多个vsync，间隔按最接近的整数个周期折算
+class MDVsyncPeriodEstimator {
+public:
+    explicit MDVsyncPeriodEstimator(int64_t period_ns = MD_DEFAULT_FRAME_PERIOD_NS);
+
+    // 记录一次vsync回调的时间戳，返回更新后的周期（ns）
+    int64_t OnVsync(int64_t timestamp_ns);
+    int64_t GetPeriodNs() const { return period_ns_; }
+    // 重新开始估计（例如重新创建 vsync 之后），period_ns 为初始值
+    void Reset(int64_t period_ns);
+
+private:
+    int64_t period_ns_;
+    int64_t last_vsync_ns_ = 0;
+};
+
+}
+}
+
+#endif //MD360PLAYER4OH_MD_VSYNC_PERIOD_ESTIMATOR_H